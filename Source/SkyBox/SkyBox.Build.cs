@@ -20,10 +20,18 @@ public class SkyBox : ModuleRules
                 "SlateCore",
                 "Renderer",
                 "RenderCore",
-                "RHI"
+                "RHI",
+                "ImageWrapper"
             }
             );
 
+        //流式PNG编码
+        AddEngineThirdPartyPrivateStaticDependencies(Target, "zlib");
+
+        //SkyBoxServer是给渲染节点用的精简版：去掉VR、HUD，启动直接进采集服务器模式
+        bool bCaptureServer = Target.Name == "SkyBoxServer";
+        PublicDefinitions.Add("SKYBOX_CAPTURE_SERVER=" + (bCaptureServer ? "1" : "0"));
+
         if ((Target.Platform == UnrealTargetPlatform.Win64) || (Target.Platform == UnrealTargetPlatform.Win32))
         {
             //PublicDefinitions.Add("GOOGLE_PROTOBUF_NO_RTTI=1");
@@ -51,7 +59,6 @@ public class SkyBox : ModuleRules
             //UE自带的库（编译gRPC时需要指定）
             //AddEngineThirdPartyPrivateStaticDependencies(Target, "CryptoPP"); //不需要
             AddEngineThirdPartyPrivateStaticDependencies(Target, "OpenSSL");
-            AddEngineThirdPartyPrivateStaticDependencies(Target, "zlib");
 
             PublicAdditionalLibraries.Add("absl_hash.lib");
             PublicAdditionalLibraries.Add("absl_city.lib");
@@ -86,6 +93,53 @@ public class SkyBox : ModuleRules
         }
         else if (Target.IsInPlatformGroup(UnrealPlatformGroup.Unix))
         {
+            //和Windows一样，gRPC用UE的clang和libc++单独编译成静态库
+            string GrpcSdkPath = "/opt/grpc_sdk/linux_ue423";
+            PublicIncludePaths.Add(GrpcSdkPath + "/include");
+
+            //静态库之间有依赖，被依赖的放后面
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libgrpc++_reflection.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libgrpc++.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libgrpc.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libgpr.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libaddress_sorting.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libupb.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libcares.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libre2.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libprotobuf.a");
+
+            AddEngineThirdPartyPrivateStaticDependencies(Target, "OpenSSL");
+
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libabsl_hash.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libabsl_city.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libabsl_wyhash.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libabsl_raw_hash_set.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libabsl_hashtablez_sampler.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libabsl_exponential_biased.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libabsl_statusor.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libabsl_bad_variant_access.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libabsl_status.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libabsl_cord.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libabsl_str_format_internal.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libabsl_synchronization.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libabsl_stacktrace.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libabsl_symbolize.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libabsl_debugging_internal.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libabsl_demangle_internal.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libabsl_graphcycles_internal.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libabsl_malloc_internal.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libabsl_time.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libabsl_strings.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libabsl_throw_delegate.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libabsl_strings_internal.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libabsl_base.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libabsl_spinlock_wait.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libabsl_int128.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libabsl_civil_time.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libabsl_time_zone.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libabsl_bad_optional_access.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libabsl_raw_logging_internal.a");
+            PublicAdditionalLibraries.Add(GrpcSdkPath + "/lib/libabsl_log_severity.a");
         }
     }
 }
@@ -2,6 +2,27 @@
 
 #include "SkyBox.h"
 #include "Modules/ModuleManager.h"
+#include "SkyBoxWorker.h"
+#include "SkyBoxLog.h"
 
-IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, SkyBox, "SkyBox" );
- 
\ No newline at end of file
+// ZZW
+class FSkyBoxModule : public FDefaultGameModuleImpl
+{
+public:
+    virtual void StartupModule() override
+    {
+        SkyBoxLog::StartUp();
+#if !WITH_EDITOR
+        //打包出来的采集节点一启动就开端口，不等地图加载；健康检查在准备好之前报NOT_SERVING
+        SkyBoxWorker::StartUp();
+#endif
+    }
+
+    virtual void ShutdownModule() override
+    {
+        SkyBoxWorker::Shutdown();
+        SkyBoxLog::Shutdown();  //RPC线程已经停了，剩下的日志写完
+    }
+};
+
+IMPLEMENT_PRIMARY_GAME_MODULE( FSkyBoxModule, SkyBox, "SkyBox" );
@@ -0,0 +1,271 @@
+#include "SkyBoxCaptureBackend.h"
+#include "CoreMinimal.h"
+#include "Camera/CameraActor.h"
+#include "Camera/CameraComponent.h"
+#include "Components/SceneCaptureComponent2D.h"
+#include "Engine/Engine.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "RenderingThread.h"
+#include "RHIGPUReadback.h"
+#include "Async/Async.h"
+#include "SkyBoxLog.h"
+#include "SkyBoxTrace.h"
+
+
+SkyBoxCaptureBackend* SkyBoxCaptureBackend::CreateRender(AActor* owner, ACameraActor* camera, bool use_viewport, SkyBoxReadbackQueue* sink)
+{
+    return new SkyBoxRenderBackend(owner, camera, use_viewport, sink);
+}
+
+SkyBoxCaptureBackend* SkyBoxCaptureBackend::CreateSynthetic(float render_latency, SkyBoxReadbackQueue* sink)
+{
+    return new SkyBoxSyntheticBackend(render_latency, sink);
+}
+
+
+SkyBoxRenderBackend::SkyBoxRenderBackend(AActor* owner, ACameraActor* camera, bool use_viewport, SkyBoxReadbackQueue* sink)
+{
+    m_owner = owner;
+    m_capture_camera = camera;
+    m_use_viewport = use_viewport;
+    m_sink = sink;
+    m_hdr_capture = NULL;
+    m_readback_target_size = 0;
+    m_readback_size = 0;
+    m_readback_ticket = 0;
+    m_readback_pending = false;
+}
+
+SkyBoxRenderBackend::~SkyBoxRenderBackend()
+{
+    //还在排队的读回命令引用着this；staging纹理在渲染线程释放
+    FRHIGPUTextureReadback* readback = m_readback.Release();
+    ENQUEUE_RENDER_COMMAND(SkyBoxReleaseReadback)(
+        [readback](FRHICommandListImmediate& RHICmdList)
+        {
+            delete readback;
+        });
+    FlushRenderingCommands();
+}
+
+void SkyBoxRenderBackend::Tick()
+{
+    if (!m_readback_pending.Load())
+        return;
+    SkyBoxRenderBackend* self = this;
+    ENQUEUE_RENDER_COMMAND(SkyBoxPollReadback)(
+        [self](FRHICommandListImmediate& RHICmdList)
+        {
+            self->PollReadback_RenderThread();
+        });
+}
+
+void SkyBoxRenderBackend::EnsureHDRCapture(int32 size)
+{
+    if (!m_hdr_target.IsValid())
+    {
+        m_hdr_target.Reset(NewObject<UTextureRenderTarget2D>());
+        m_hdr_target->InitCustomFormat(size, size, PF_FloatRGBA, true);
+    }
+    else if (m_hdr_target->SizeX != size || m_hdr_target->SizeY != size)
+    {
+        m_hdr_target->ResizeTarget(size, size);
+    }
+    if (m_hdr_capture == NULL)
+    {
+        //挂在采集相机上，跟着相机旋转
+        UCameraComponent* camera_component = m_capture_camera->GetCameraComponent();
+        m_hdr_capture = NewObject<USceneCaptureComponent2D>(m_capture_camera);
+        m_hdr_capture->RegisterComponent();
+        m_hdr_capture->AttachToComponent(camera_component, FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+        m_hdr_capture->FOVAngle = camera_component->FieldOfView;
+        m_hdr_capture->CaptureSource = ESceneCaptureSource::SCS_SceneColorHDR;
+        m_hdr_capture->bCaptureEveryFrame = false;
+        m_hdr_capture->bCaptureOnMovement = false;
+    }
+    m_hdr_capture->TextureTarget = m_hdr_target.Get();
+}
+
+void SkyBoxRenderBackend::Warmup(const SkyBoxFaceRequest& request)
+{
+    //请求可以要HDR格式，SceneCapture那条路径每个rig都要走一遍，不用读回
+    EnsureHDRCapture(request.size);
+    m_hdr_capture->bUseCustomProjectionMatrix = false;
+    m_hdr_capture->CaptureScene();
+}
+
+void SkyBoxRenderBackend::CaptureFace(const SkyBoxFaceRequest& request)
+{
+    if (!request.screenshot_path.IsEmpty())
+    {
+        FString cmd = FString::Printf(TEXT("HighResShot %dx%d filename=\"%s\""), request.size, request.size, *request.screenshot_path);
+        SKYBOX_LOG(Verbose, TEXT("HighResShot"), TEXT("%s"), *cmd);
+        GEngine->Exec(m_owner->GetWorld(), *cmd);
+        return;
+    }
+    //渲染目标的边长对齐到ReadbackAlignment，多出来的右边、下边在读回时裁掉，输出还是request.size
+    int32 target_size = Align(request.size, ReadbackAlignment);
+    EnsureHDRCapture(target_size);
+    if (request.tile_count > 1 || target_size != request.size)
+    {
+        int32 tile_x = request.tile_index % request.tile_count;
+        int32 tile_y = request.tile_index / request.tile_count;
+        //整个面的透视投影，再在裁剪空间里放大平移，只留下从像素(tile_x * size, tile_y * size)开始的target_size x target_size一块
+        //面的边长不是size的整数倍时，最后一行、一列的视锥伸出面外，多出来的像素由rig裁掉
+        float half_fov = FMath::DegreesToRadians(m_hdr_capture->FOVAngle * 0.5f);
+        FMatrix projection = FReversedZPerspectiveMatrix(half_fov, half_fov, 1.0f, 1.0f, GNearClippingPlane, GNearClippingPlane);
+        float n = (float)request.face_size / target_size;
+        float left = 2.0f * tile_x * request.size / target_size;
+        float top = 2.0f * tile_y * request.size / target_size;
+        FMatrix tile(
+            FPlane(n, 0.0f, 0.0f, 0.0f),
+            FPlane(0.0f, n, 0.0f, 0.0f),
+            FPlane(0.0f, 0.0f, 1.0f, 0.0f),
+            FPlane(n - 1.0f - left, top + 1.0f - n, 0.0f, 1.0f));
+        m_hdr_capture->bUseCustomProjectionMatrix = true;
+        m_hdr_capture->CustomProjectionMatrix = projection * tile;
+    }
+    else
+    {
+        m_hdr_capture->bUseCustomProjectionMatrix = false;
+    }
+    m_hdr_capture->CaptureScene();
+    FTextureRenderTargetResource* resource = m_hdr_target->GameThread_GetRenderTargetResource();
+    SkyBoxRenderBackend* self = this;
+    uint32 ticket = request.ticket;
+    int32 size = request.size;
+    ENQUEUE_RENDER_COMMAND(SkyBoxReadHDR)(
+        [self, resource, ticket, size](FRHICommandListImmediate& RHICmdList)
+        {
+            self->BeginReadback_RenderThread(RHICmdList, resource, ticket, size);
+        });
+}
+
+void SkyBoxRenderBackend::BeginReadback_RenderThread(FRHICommandListImmediate& RHICmdList, FTextureRenderTargetResource* resource, uint32 ticket, int32 size)
+{
+    //拷到staging纹理后写一个GPU fence就返回；上一个面还没取走的（超时重采）直接覆盖
+    int32 target_size = resource->GetSizeX();
+    if (!m_readback.IsValid() || m_readback_target_size != target_size)
+    {
+        //staging纹理按第一次拷贝的尺寸建，尺寸变了要换一个
+        m_readback.Reset(new FRHIGPUTextureReadback(TEXT("SkyBoxReadHDR")));
+        m_readback_target_size = target_size;
+    }
+    m_readback->EnqueueCopy(RHICmdList, resource->GetRenderTargetTexture());
+    m_readback_size = size;
+    m_readback_ticket = ticket;
+    m_readback_pending = true;
+}
+
+void SkyBoxRenderBackend::PollReadback_RenderThread()
+{
+    if (!m_readback_pending.Load() || !m_readback->IsReady())
+        return;
+    SKYBOX_TRACE_SCOPE(TEXT("ReadbackCopy"), 0);
+    SkyBoxReadbackResult result;
+    result.type = SkyBoxReadbackResult::HDR;
+    result.ticket = m_readback_ticket;
+    result.size_x = m_readback_size;
+    result.size_y = m_readback_size;
+    result.hdr.SetNumUninitialized(m_readback_size * m_readback_size);
+    //一行m_readback_target_size个像素，只要左上角m_readback_size x m_readback_size
+    const FFloat16Color* data = static_cast<const FFloat16Color*>(m_readback->Lock(m_readback_target_size * m_readback_target_size * sizeof(FFloat16Color)));
+    if (data != NULL)
+    {
+        for (int32 y = 0; y < m_readback_size; ++y)
+            FMemory::Memcpy(&result.hdr[y * m_readback_size], data + y * m_readback_target_size, m_readback_size * sizeof(FFloat16Color));
+    }
+    m_readback->Unlock();
+    m_readback_pending = false;
+    if (data == NULL)
+    {
+        SKYBOX_LOG(Warning, TEXT("ReadbackLockFailed"), TEXT("size=%d"), m_readback_size);
+        return;  //rig的看门狗会重采这个面
+    }
+    m_sink->Enqueue(MoveTemp(result));
+}
+
+
+SkyBoxSyntheticBackend::SkyBoxSyntheticBackend(float render_latency, SkyBoxReadbackQueue* sink)
+{
+    m_render_latency = FMath::Max(render_latency, 0.0f);
+    m_sink = sink;
+    m_ready_time = 0.0;
+}
+
+SkyBoxSyntheticBackend::~SkyBoxSyntheticBackend()
+{
+    DiscardPending();
+}
+
+void SkyBoxSyntheticBackend::DiscardPending()
+{
+    //任务只按值拿着请求，还在跑也没关系，跑完后结果随共享状态一起释放
+    m_pending = TFuture<TSharedPtr<SkyBoxReadbackResult, ESPMode::ThreadSafe>>();
+}
+
+void SkyBoxSyntheticBackend::Tick()
+{
+    //生成完、也到了模拟的渲染时间才交出去；入队在游戏线程，和rig是同一个线程
+    if (!m_pending.IsValid() || !m_pending.IsReady() || FPlatformTime::Seconds() < m_ready_time)
+        return;
+    TSharedPtr<SkyBoxReadbackResult, ESPMode::ThreadSafe> result = m_pending.Get();
+    m_pending = TFuture<TSharedPtr<SkyBoxReadbackResult, ESPMode::ThreadSafe>>();
+    m_sink->Enqueue(MoveTemp(*result));
+}
+
+void SkyBoxSyntheticBackend::CaptureFace(const SkyBoxFaceRequest& request)
+{
+    //超时重采时上一个面可能还没交出去，已经过期了
+    DiscardPending();
+    m_ready_time = FPlatformTime::Seconds() + m_render_latency;
+    SkyBoxFaceRequest face = request;
+    m_pending = Async(EAsyncExecution::ThreadPool, [face]()
+    {
+        SKYBOX_TRACE_SCOPE(TEXT("SyntheticFace"), face.job_id);
+        TSharedPtr<SkyBoxReadbackResult, ESPMode::ThreadSafe> result = MakeShared<SkyBoxReadbackResult, ESPMode::ThreadSafe>();
+        result->type = SkyBoxReadbackResult::HDR;
+        result->ticket = face.ticket;
+        result->size_x = face.size;
+        result->size_y = face.size;
+        result->hdr.SetNumUninitialized(face.size * face.size);
+        //和SceneCapture一样的透视：X朝前，Y朝右，Z朝上；分块时只算整个面里的这一块
+        float focal = 1.0f / FMath::Tan(FMath::DegreesToRadians(face.fov * 0.5f));
+        int32 face_size = face.face_size;
+        int32 left = face.tile_index % face.tile_count * face.size;
+        int32 top = face.tile_index / face.tile_count * face.size;
+        FRotationMatrix rotation(face.rotation);
+        for (int32 y = 0; y < face.size; ++y)
+        {
+            float v = (top + y + 0.5f) / face_size * 2.0f - 1.0f;
+            for (int32 x = 0; x < face.size; ++x)
+            {
+                float u = (left + x + 0.5f) / face_size * 2.0f - 1.0f;
+                FVector direction = rotation.TransformVector(FVector(focal, u, -v)).GetSafeNormal();
+                result->hdr[y * face.size + x] = FFloat16Color(Radiance(direction, face.location));
+            }
+        }
+        return result;
+    });
+}
+
+FLinearColor SkyBoxSyntheticBackend::Radiance(const FVector& direction, const FVector& location)
+{
+    //天空：地平线到天顶的渐变加一个太阳；地面：按位置投影的棋盘格，不同位置采出来不一样
+    static const FVector sun_direction = FVector(0.3f, 0.2f, 0.9f).GetSafeNormal();
+    if (direction.Z >= 0.0f)
+    {
+        FLinearColor horizon(0.8f, 0.85f, 0.9f);
+        FLinearColor zenith(0.15f, 0.3f, 0.8f);
+        FLinearColor sky = FMath::Lerp(horizon, zenith, FMath::Sqrt(direction.Z));
+        float sun = FMath::Pow(FMath::Max(FVector::DotProduct(direction, sun_direction), 0.0f), 512.0f) * 50.0f;
+        return sky + FLinearColor(sun, sun * 0.95f, sun * 0.85f);
+    }
+    float height = FMath::Max(location.Z, 1.0f);
+    FVector hit = location + direction * (height / -direction.Z);
+    const float cell = 200.0f;
+    int32 parity = (FMath::FloorToInt(hit.X / cell) + FMath::FloorToInt(hit.Y / cell)) & 1;
+    float albedo = parity ? 0.35f : 0.15f;
+    float fade = FMath::Clamp(-direction.Z * 4.0f, 0.0f, 1.0f);  //远处融进地平线，减少走样
+    return FMath::Lerp(FLinearColor(0.4f, 0.4f, 0.4f), FLinearColor(albedo, albedo * 0.9f, albedo * 0.8f), fade);
+}
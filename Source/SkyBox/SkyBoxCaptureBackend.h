@@ -0,0 +1,123 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Containers/Queue.h"
+#include "Templates/Atomic.h"
+#include "Templates/UniquePtr.h"
+#include "UObject/StrongObjectPtr.h"
+
+class ACameraActor;
+class AActor;
+class USceneCaptureComponent2D;
+class UTextureRenderTarget2D;
+class FTextureRenderTargetResource;
+class FRHICommandListImmediate;
+class FRHIGPUTextureReadback;
+
+
+//渲染线程、后端读回的结果，经无锁队列交给游戏线程
+struct SkyBoxReadbackResult
+{
+    enum Type
+    {
+        Luminance,
+        BackBuffer,
+        HDR,
+    };
+    Type type;
+    uint32 ticket;  //发起时的阶段号，和游戏线程当前的对不上就是过期结果
+    float luminance;
+    TArray<FColor> ldr;
+    TArray<FFloat16Color> hdr;
+    uint32 size_x;
+    uint32 size_y;
+};
+
+typedef TQueue<SkyBoxReadbackResult, EQueueMode::Spsc> SkyBoxReadbackQueue;
+
+
+//采一个面，或者分块时的一块；相机的位置、朝向由请求带过去
+struct SkyBoxFaceRequest
+{
+    FVector location;
+    FRotator rotation;
+    float fov;  //度
+    int32 size;  //这次输出的边长，分块时是一块的边长
+    int32 face_size;  //整个面的边长；分块时最后一行、一列的块超出面的部分由rig裁掉
+    int32 tile_count;  //每个面tile_count x tile_count块，1表示不分块
+    int32 tile_index;
+    FString screenshot_path;  //非空时截屏直接写这个文件，完成由截图回调通知，只有CanScreenshot()的后端用
+    uint32 ticket;
+    int32 job_id;
+};
+
+
+//采集后端：rig只管状态机和写盘，画面从哪来由后端决定
+//结果一律以SkyBoxReadbackResult::HDR放进rig的读回队列；一个rig同一时间只有一个面在采，队列只有一个生产者
+class SkyBoxCaptureBackend
+{
+public:
+    static SkyBoxCaptureBackend* CreateRender(AActor* owner, ACameraActor* camera, bool use_viewport, SkyBoxReadbackQueue* sink);
+    static SkyBoxCaptureBackend* CreateSynthetic(float render_latency, SkyBoxReadbackQueue* sink);
+    virtual ~SkyBoxCaptureBackend() {}
+    virtual bool NeedsSettle() const = 0;  //要不要等流送、TAA和曝光稳定
+    virtual bool CanScreenshot() const { return false; }
+    virtual void Tick() {}  //rig每帧在取读回结果之前调用
+    virtual void Warmup(const SkyBoxFaceRequest& request) {}  //只渲染不读回，编译shader和PSO
+    virtual void CaptureFace(const SkyBoxFaceRequest& request) = 0;
+};
+
+
+//引擎渲染：SceneCapture采HDR再读回；ViewTarget那套rig的PNG走HighResShot
+class SkyBoxRenderBackend : public SkyBoxCaptureBackend
+{
+public:
+    SkyBoxRenderBackend(AActor* owner, ACameraActor* camera, bool use_viewport, SkyBoxReadbackQueue* sink);
+    virtual ~SkyBoxRenderBackend();
+    virtual bool NeedsSettle() const override { return true; }
+    virtual bool CanScreenshot() const override { return m_use_viewport; }
+    virtual void Tick() override;
+    virtual void Warmup(const SkyBoxFaceRequest& request) override;
+    virtual void CaptureFace(const SkyBoxFaceRequest& request) override;
+public:
+    static const int32 ReadbackAlignment = 32;  //FloatRGBA一行对齐到256字节，staging纹理锁住后按紧密排列读
+private:
+    void EnsureHDRCapture(int32 size);
+    void BeginReadback_RenderThread(FRHICommandListImmediate& RHICmdList, FTextureRenderTargetResource* resource, uint32 ticket, int32 size);
+    void PollReadback_RenderThread();
+private:
+    AActor* m_owner;
+    ACameraActor* m_capture_camera;
+    bool m_use_viewport;
+    SkyBoxReadbackQueue* m_sink;
+    USceneCaptureComponent2D* m_hdr_capture;  //挂在相机Actor上，由Actor持有
+    TStrongObjectPtr<UTextureRenderTarget2D> m_hdr_target;
+    //异步读回：渲染线程发起拷贝，rig每帧Tick时让渲染线程查一下，拷完了才锁住取数据，不等GPU
+    TUniquePtr<FRHIGPUTextureReadback> m_readback;  //下面四个只在渲染线程读写
+    int32 m_readback_target_size;
+    int32 m_readback_size;
+    uint32 m_readback_ticket;
+    TAtomic<bool> m_readback_pending;  //渲染线程发起拷贝时置上、交出结果后清掉，游戏线程只读
+};
+
+
+//不用GPU：按位置和方向算出确定的程序化天空和地面，过了设定的渲染延迟才交出结果
+//调度、编码、写盘、IBL的压测在没有显卡的Linux机器上也能跑
+class SkyBoxSyntheticBackend : public SkyBoxCaptureBackend
+{
+public:
+    SkyBoxSyntheticBackend(float render_latency, SkyBoxReadbackQueue* sink);
+    virtual ~SkyBoxSyntheticBackend();
+    virtual bool NeedsSettle() const override { return false; }
+    virtual void Tick() override;
+    virtual void CaptureFace(const SkyBoxFaceRequest& request) override;
+    static FLinearColor Radiance(const FVector& direction, const FVector& location);
+private:
+    void DiscardPending();
+private:
+    float m_render_latency;  //秒
+    SkyBoxReadbackQueue* m_sink;
+    //在线程池里生成，游戏线程到时间后入队；结果归共享状态所有，过期的直接丢掉future，不用等任务跑完
+    TFuture<TSharedPtr<SkyBoxReadbackResult, ESPMode::ThreadSafe>> m_pending;
+    double m_ready_time;
+};
@@ -0,0 +1,735 @@
+#include "SkyBoxCaptureRig.h"
+#include "CoreMinimal.h"
+#include "Camera/CameraActor.h"
+#include "Camera/CameraComponent.h"
+#include "ContentStreaming.h"
+#include "RenderingThread.h"
+#include "RHIGPUReadback.h"
+#include "Async/Async.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "UnrealClient.h"
+#include <ImageUtils.h>
+#include <FileHelper.h>
+#include "SkyBoxCharacter.h"
+#include "SkyBoxRPC.h"
+#include "SkyBoxTrace.h"
+#include "SkyBoxMetrics.h"
+#include "SkyBoxLog.h"
+
+
+namespace
+{
+    //backbuffer常见的几种格式，亮度统一按0~255算，和稳定判断的容差一致
+    bool IsLuminanceFormat(EPixelFormat format)
+    {
+        return format == PF_B8G8R8A8 || format == PF_R8G8B8A8 || format == PF_A2B10G10R10;
+    }
+
+    float AverageLuminance(const uint8* data, EPixelFormat format, int32 count)
+    {
+        float sum = 0.0f;
+        for (int32 i = 0; i < count; ++i, data += 4)
+        {
+            float r, g, b;
+            if (format == PF_A2B10G10R10)
+            {
+                uint32 packed = *(const uint32*)data;
+                const float scale = 255.0f / 1023.0f;
+                r = (packed & 0x3FF) * scale;
+                g = ((packed >> 10) & 0x3FF) * scale;
+                b = ((packed >> 20) & 0x3FF) * scale;
+            }
+            else if (format == PF_R8G8B8A8)
+            {
+                r = data[0];
+                g = data[1];
+                b = data[2];
+            }
+            else
+            {
+                r = data[2];
+                g = data[1];
+                b = data[0];
+            }
+            sum += 0.2126f * r + 0.7152f * g + 0.0722f * b;
+        }
+        return sum / count;
+    }
+}
+
+
+SkyBoxCaptureRig::SkyBoxCaptureRig(ASkyBoxCharacter* owner, int32 index, ACameraActor* camera, bool use_viewport, const SkyBoxRigConfig& config)
+{
+    m_owner = owner;
+    m_index = index;
+    m_capture_camera = camera;
+    m_use_viewport = use_viewport;
+    m_config = config;
+    if (config.synthetic)
+        m_backend.Reset(SkyBoxCaptureBackend::CreateSynthetic(config.synthetic_latency, &m_Readbacks));
+    else
+        m_backend.Reset(SkyBoxCaptureBackend::CreateRender(owner, camera, use_viewport, &m_Readbacks));
+    m_SixDirection.Push(FRotator(0.0f, 0.0f, 0.0f));  //前
+    m_SixDirection.Push(FRotator(0.0f, 90.0f, 0.0f));  //右
+    m_SixDirection.Push(FRotator(0.0f, 180.0f, 0.0f));  //后
+    m_SixDirection.Push(FRotator(0.0f, -90.0f, 0.0f));  //左
+    m_SixDirection.Push(FRotator(90.0f, 0.0f, 0.0f));  //上
+    m_SixDirection.Push(FRotator(-90.0f, 0.0f, 0.0f));  //下
+    m_current_job = NULL;
+    m_CurrentDirection = -1;
+    m_CurrentState = CaptureState::Invalid;
+    m_Ticket = 0;
+    m_StateEnterTime = 0.0;
+    m_StateWord = CaptureState::Invalid;
+    m_ScreenshotTicket = 0;
+    m_BackBufferSizeX = 0;
+    m_BackBufferSizeY = 0;
+    m_FaceSize = 2048;
+    m_FaceFormat = SkyBoxImageFormat::PNG;
+    m_TileCount = 0;
+    m_TileSize = 0;
+    m_TileIndex = 0;
+    m_SettleStartTime = 0.0;
+    m_SettleFrames = 0;
+    m_WatchedTicket = 0;
+    m_StageStartTime = 0.0;
+    m_FaceAttempts = 0;
+    m_LastLuminance = -1.0f;
+    m_StableSamples = 0;
+    m_LuminanceTicket = 0;
+    m_LuminancePending = false;
+    m_WarmupStep = 0;
+}
+
+SkyBoxCaptureRig::~SkyBoxCaptureRig()
+{
+    //后端还没交出来的结果引用着m_Readbacks，先停掉后端
+    m_backend.Reset();
+    //采亮度的小图和staging纹理在渲染线程释放，调用时backbuffer回调已经摘掉了
+    FRHIGPUTextureReadback* readback = m_LuminanceReadback.Release();
+    FTexture2DRHIRef texture = m_LuminanceTexture;
+    m_LuminanceTexture.SafeRelease();
+    ENQUEUE_RENDER_COMMAND(SkyBoxReleaseLuminance)(
+        [readback, texture](FRHICommandListImmediate& RHICmdList) mutable
+        {
+            delete readback;
+            texture.SafeRelease();
+        });
+    FlushRenderingCommands();
+    //换地图时RPC服务还在（打包版），手上的任务不能就这么丢了，不然一直是Working
+    if (m_current_job != NULL)
+    {
+        SkyBoxServiceImpl::Instance()->RequeueJob(m_current_job);
+        m_current_job = NULL;
+    }
+}
+
+void SkyBoxCaptureRig::Tick()
+{
+    SKYBOX_TRACE_SCOPE(TEXT("Rig.Tick"), m_current_job != NULL ? m_current_job->JobID() : 0);
+    m_backend->Tick();
+    DrainReadbacks();
+    if (m_CurrentState == CaptureState::Warming)
+    {
+        TickWarmup();
+        return;
+    }
+    if (m_current_job == NULL)
+    {
+        m_current_job = m_owner->AcquireJob();
+        if (m_current_job == NULL)
+            return;
+        SKYBOX_LOG(Verbose, TEXT("GetNewJob"), TEXT("rig=%d job_id=%d scene_id=%d position=(%.1f,%.1f,%.1f)"),
+            m_index, m_current_job->JobID(), m_current_job->m_position.scene_id, m_current_job->m_position.x, m_current_job->m_position.y, m_current_job->m_position.z);
+        {
+            SKYBOX_TRACE_SCOPE(TEXT("Teleport"), m_current_job->JobID());
+            FVector location(m_current_job->m_position.x, m_current_job->m_position.y, m_current_job->m_position.z);
+            if (m_use_viewport)
+                m_owner->SetActorLocation(location);
+            m_capture_camera->SetActorLocation(location);
+        }
+        m_CurrentDirection = 0;
+        m_FaceAttempts = 0;
+        m_FaceFilePaths.Reset();
+        PrepareJobSettings();
+        m_capture_camera->SetActorRotation(m_SixDirection[m_CurrentDirection]);
+        BeginSettle();
+        SKYBOX_LOG(Verbose, TEXT("ChangeDirection"), TEXT("rig=%d job_id=%d direction=%d"), m_index, m_current_job->JobID(), m_CurrentDirection);
+        return;
+    }
+    if (!m_use_viewport)
+    {
+        //纹理流送只跟着玩家视角走，其他rig的位置要单独告诉它
+        IStreamingManager::Get().AddViewSlaveLocation(m_capture_camera->GetActorLocation());
+    }
+    if ((m_CurrentState == CaptureState::Settling || m_CurrentState == CaptureState::Saved) && SkyBoxServiceImpl::Instance()->IsJobCancelled(m_current_job))
+    {
+        //只在面与面之间停，不会留下写了一半的文件
+        AbortJob();
+        return;
+    }
+    if (CheckWatchdog())
+        return;
+    if (m_CurrentState == CaptureState::Settling)
+    {
+        //稳定了马上采，不稳定就等，超时也采
+        bool settled = IsSceneSettled();
+        double elapsed = FPlatformTime::Seconds() - m_SettleStartTime;
+        if (!settled && elapsed < m_config.settle_timeout)
+            return;
+        if (!settled)
+        {
+            SKYBOX_LOG(Warning, TEXT("SettleTimeout"), TEXT("rig=%d job_id=%d direction=%d streaming=%d stable=%d"),
+                m_index, m_current_job->JobID(), m_CurrentDirection, IStreamingManager::Get().GetNumWantingResources(), m_StableSamples);
+        }
+        SetState(CaptureState::Waiting1);
+    }
+    if (m_CurrentState == CaptureState::Waiting1)
+    {
+        //m_CurrentState = CaptureState::Prepared;
+
+        m_BackBufferFilePath = FString::Printf(TEXT("%s_%d.%s"), *GetJobFilePrefix(), m_CurrentDirection, SkyBoxImageWriter::GetExtension(m_FaceFormat));
+        if (m_FaceSize > MaxUntiledFaceSize)
+        {
+            if (!BeginTiledFace())
+                RetryFace();
+            return;
+        }
+        if (m_FaceFormat != SkyBoxImageFormat::PNG || !m_backend->CanScreenshot())
+        {
+            CaptureHDR();
+            return;
+        }
+
+        //截图回调带回当前阶段号，还在Waiting1就算存好了
+        SkyBoxFaceRequest request = MakeFaceRequest(m_FaceSize);
+        request.screenshot_path = m_BackBufferFilePath;
+        m_backend->CaptureFace(request);
+        //m_CurrentState = CaptureState::Saved;
+        return;
+    }
+    if (m_CurrentState == CaptureState::Captured)
+    {
+        bool ok = false;
+        double write_start = FPlatformTime::Seconds();
+        if (m_TileWriter.IsValid())
+        {
+            ok = AppendTile();  //成功时已经进入下一块或者Saved
+            SkyBoxStats::Stage(TEXT("EncodeWrite")).Observe(FPlatformTime::Seconds() - write_start);
+        }
+        else
+        {
+            ok = m_BackBufferData.Num() != 0 ? SavePNGToFile() : SaveHDRToFile();
+            SkyBoxStats::Stage(TEXT("EncodeWrite")).Observe(FPlatformTime::Seconds() - write_start);
+            if (ok)
+                SetState(CaptureState::Saved);
+        }
+        if (!ok)
+            RetryFace();
+        return;
+    }
+    if (m_CurrentState == CaptureState::Saved)
+    {
+        m_FaceFilePaths.Add(m_BackBufferFilePath);
+        ++m_CurrentDirection;
+        m_FaceAttempts = 0;
+        if (m_CurrentDirection < m_SixDirection.Num())
+        {
+            m_capture_camera->SetActorRotation(m_SixDirection[m_CurrentDirection]);
+            BeginSettle();
+            SKYBOX_LOG(Verbose, TEXT("ChangeDirection"), TEXT("rig=%d job_id=%d direction=%d"), m_index, m_current_job->JobID(), m_CurrentDirection);
+        }
+        else if (m_current_job->m_settings.ibl == skybox::IblMode::IblOff)
+        {
+            CompleteJob(true);
+        }
+        else
+        {
+            //六个面都存好了，在线程池里做IBL预过滤，不卡游戏线程
+            SetState(CaptureState::Filtering);
+            TArray<FString> face_files = m_FaceFilePaths;
+            TArray<FRotator> directions = m_SixDirection;
+            float fov = m_capture_camera->GetCameraComponent()->FieldOfView;
+            FString prefix = GetJobFilePrefix();
+            SkyBoxImageFormat format = m_FaceFormat;
+            bool sh_only = m_current_job->m_settings.ibl == skybox::IblMode::IblShOnly;
+            m_FilterResult = Async(EAsyncExecution::ThreadPool, [face_files, directions, fov, prefix, format, sh_only]()
+            {
+                return SkyBoxIBL::Bake(face_files, directions, fov, prefix, format, sh_only);
+            });
+        }
+        return;
+    }
+    if (m_CurrentState == CaptureState::Filtering)
+    {
+        if (!m_FilterResult.IsReady())
+            return;
+        //六个面已经写好了，烘焙失败只单独报，不算任务失败
+        const SkyBoxBakeResult& result = m_FilterResult.Get();
+        if (result.m_success)
+            m_current_job->m_sh_coefficients = result.m_sh_coefficients;
+        else
+            SKYBOX_LOG(Warning, TEXT("IBLBakeFailed"), TEXT("rig=%d job_id=%d"), m_index, m_current_job->JobID());
+        m_current_job->m_ibl_status = result.m_success ? skybox::IblStatus::IblBaked : skybox::IblStatus::IblBakeFailed;
+        CompleteJob(true);
+        m_FilterResult = TFuture<SkyBoxBakeResult>();
+        return;
+    }
+}
+
+void SkyBoxCaptureRig::BeginWarmup(const TArray<FVector>& positions)
+{
+    if (positions.Num() == 0 || m_current_job != NULL)
+        return;
+    UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！Begin Warmup, rig = %d, positions = %d"), m_index, positions.Num());
+    m_WarmupPositions = positions;
+    m_WarmupStep = 0;
+    SetState(CaptureState::Warming);
+}
+
+void SkyBoxCaptureRig::TickWarmup()
+{
+    //每帧摆一个位置和方向，渲染时用到的shader和PSO就编译好了，真正采集时不会卡
+    int32 step_count = m_WarmupPositions.Num() * m_SixDirection.Num();
+    if (m_WarmupStep >= step_count)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！Warmup Done, rig = %d, steps = %d"), m_index, step_count);
+        m_WarmupPositions.Empty();
+        SetState(CaptureState::Invalid);
+        return;
+    }
+    FVector location = m_WarmupPositions[m_WarmupStep / m_SixDirection.Num()];
+    if (m_use_viewport)
+        m_owner->SetActorLocation(location);
+    m_capture_camera->SetActorLocation(location);
+    m_capture_camera->SetActorRotation(m_SixDirection[m_WarmupStep % m_SixDirection.Num()]);
+    m_backend->Warmup(MakeFaceRequest(WarmupCaptureSize));
+    ++m_WarmupStep;
+}
+
+FVector SkyBoxCaptureRig::GetLocation() const
+{
+    return m_capture_camera->GetActorLocation();
+}
+
+void SkyBoxCaptureRig::CompleteJob(bool success)
+{
+    SKYBOX_LOG(Info, TEXT("JobEnded"), TEXT("status=%s rig=%d job_id=%d scene_id=%d position=(%.1f,%.1f,%.1f)"), success ? TEXT("Succeeded") : TEXT("Failed"),
+        m_index, m_current_job->JobID(), m_current_job->m_position.scene_id, m_current_job->m_position.x, m_current_job->m_position.y, m_current_job->m_position.z);
+    m_current_job->SetStatus(success ? skybox::JobStatus::Succeeded : skybox::JobStatus::Failed);
+    ReleaseJob();
+}
+
+void SkyBoxCaptureRig::AbortJob()
+{
+    SKYBOX_LOG(Info, TEXT("JobAborted"), TEXT("rig=%d job_id=%d direction=%d"), m_index, m_current_job->JobID(), m_CurrentDirection);
+    m_current_job->SetStatus(skybox::JobStatus::Cancelled);
+    ReleaseJob();
+}
+
+void SkyBoxCaptureRig::ReleaseJob()
+{
+    SkyBoxServiceImpl::Instance()->OnJobCompleted(m_current_job);
+    m_current_job = NULL;
+    m_CurrentDirection = -1;
+    SetState(CaptureState::Invalid);
+}
+
+void SkyBoxCaptureRig::RetryFace()
+{
+    //丢掉这个面做了一半的东西，包括没写完的分块文件
+    m_TileWriter.Reset();
+    m_TileStrip.Empty();
+    m_BackBufferData.Empty();
+    m_HDRData.Empty();
+    ++m_FaceAttempts;
+    if (m_FaceAttempts > m_config.max_face_retries)
+    {
+        SKYBOX_LOG(Warning, TEXT("FaceFailed"), TEXT("rig=%d job_id=%d direction=%d attempts=%d"), m_index, m_current_job->JobID(), m_CurrentDirection, m_FaceAttempts);
+        CompleteJob(false);
+        return;
+    }
+    SkyBoxStats::FaceRetries().Add();
+    SKYBOX_LOG(Warning, TEXT("RetryFace"), TEXT("rig=%d job_id=%d direction=%d attempt=%d"), m_index, m_current_job->JobID(), m_CurrentDirection, m_FaceAttempts + 1);
+    m_capture_camera->SetActorRotation(m_SixDirection[m_CurrentDirection]);
+    BeginSettle();
+}
+
+bool SkyBoxCaptureRig::CheckWatchdog()
+{
+    //按阶段号计时，分块时每块都换一次阶段号，各自计时
+    double now = FPlatformTime::Seconds();
+    if (m_Ticket != m_WatchedTicket)
+    {
+        m_WatchedTicket = m_Ticket;
+        m_StageStartTime = now;
+        return false;
+    }
+    //只管等截图回调、等读回这几个会一直等下去的阶段；稳定阶段有自己的超时，IBL在线程池里没法打断
+    if (m_CurrentState != CaptureState::Waiting1 && m_CurrentState != CaptureState::Prepared && m_CurrentState != CaptureState::ReadingBack)
+        return false;
+    if (now - m_StageStartTime < m_config.stage_timeout)
+        return false;
+    SKYBOX_LOG(Warning, TEXT("StageTimeout"), TEXT("rig=%d job_id=%d direction=%d state=%d elapsed=%.1f"),
+        m_index, m_current_job->JobID(), m_CurrentDirection, (int32)m_CurrentState, now - m_StageStartTime);
+    RetryFace();
+    return true;
+}
+
+void SkyBoxCaptureRig::BeginSettle()
+{
+    SetState(CaptureState::Settling);
+    m_SettleStartTime = FPlatformTime::Seconds();
+    m_SettleFrames = 0;
+    m_LastLuminance = -1.0f;
+    m_StableSamples = 0;
+    if (m_use_viewport)
+    {
+        //瞬移之后丢掉TAA历史，不然会拖影；后面再等它重新收敛
+        APlayerCameraManager* camera_manager = UGameplayStatics::GetPlayerCameraManager(m_owner, 0);
+        if (camera_manager != NULL)
+            camera_manager->SetGameCameraCutThisFrame();
+    }
+}
+
+bool SkyBoxCaptureRig::IsSceneSettled()
+{
+    ++m_SettleFrames;
+    //合成的画面和场景无关
+    if (!m_backend->NeedsSettle())
+        return true;
+    //纹理还在流送，采出来是糊的
+    if (IStreamingManager::Get().GetNumWantingResources() > 0)
+        return false;
+    //SceneCapture没有TAA历史，采的又是曝光之前的HDR颜色，流送完就可以采
+    if (!m_use_viewport)
+        return true;
+    //ViewTarget的画面要等TAA和自动曝光收敛：画面中心的平均亮度连续几帧基本不变
+    const int32 min_stable_samples = 2;
+    return m_SettleFrames > 1 && m_StableSamples >= min_stable_samples;
+}
+
+void SkyBoxCaptureRig::SetState(int32 state)
+{
+    //跨帧的阶段在这里按进入、离开的时间记
+    double now = FPlatformTime::Seconds();
+    const TCHAR* stage = NULL;
+    switch (m_CurrentState)
+    {
+    case CaptureState::Settling:
+        stage = TEXT("Settle");
+        break;
+    case CaptureState::Waiting1:
+    case CaptureState::Prepared:
+        stage = TEXT("Render");
+        break;
+    case CaptureState::ReadingBack:
+        stage = TEXT("Readback");
+        break;
+    case CaptureState::Filtering:
+        stage = TEXT("IBL");
+        break;
+    case CaptureState::Warming:
+        stage = TEXT("Warmup");
+        break;
+    default:
+        break;
+    }
+    if (stage != NULL)
+    {
+        SkyBoxTrace::Record(stage, m_StateEnterTime, now, m_current_job != NULL ? m_current_job->JobID() : 0);
+        SkyBoxStats::Stage(stage).Observe(now - m_StateEnterTime);
+    }
+    m_StateEnterTime = now;
+    m_CurrentState = (CaptureState)state;
+    ++m_Ticket;
+    m_StateWord = (m_Ticket << 8) | (uint32)state;
+}
+
+void SkyBoxCaptureRig::DrainReadbacks()
+{
+    SkyBoxReadbackResult result;
+    while (m_Readbacks.Dequeue(result))
+    {
+        if (result.ticket != (m_Ticket & 0xFFFFFF))
+            continue;  //阶段已经变了（超时重试、取消），过期的结果不要
+        if (result.type == SkyBoxReadbackResult::Luminance && m_CurrentState == CaptureState::Settling)
+        {
+            const float tolerance = 0.01f;
+            if (m_LastLuminance >= 0.0f && FMath::Abs(result.luminance - m_LastLuminance) <= tolerance * FMath::Max(m_LastLuminance, 1.0f))
+                ++m_StableSamples;
+            else
+                m_StableSamples = 0;
+            m_LastLuminance = result.luminance;
+        }
+        else if (result.type == SkyBoxReadbackResult::BackBuffer && m_CurrentState == CaptureState::Prepared)
+        {
+            m_BackBufferData = MoveTemp(result.ldr);
+            m_BackBufferSizeX = result.size_x;
+            m_BackBufferSizeY = result.size_y;
+            m_BackBufferFilePath = m_config.output_dir / FString::Printf(TEXT("SkyBox(%dX%d)_Scene%d_(%.1f，%.1f，%.1f)_%d.png"),
+                m_BackBufferSizeX, m_BackBufferSizeY, m_current_job->m_position.scene_id, m_current_job->m_position.x, m_current_job->m_position.y, m_current_job->m_position.z, m_CurrentDirection);
+            SetState(CaptureState::Captured);
+        }
+        else if (result.type == SkyBoxReadbackResult::HDR && m_CurrentState == CaptureState::ReadingBack)
+        {
+            m_HDRData = MoveTemp(result.hdr);
+            SetState(CaptureState::Captured);
+        }
+    }
+    if (m_CurrentState == CaptureState::Waiting1 && m_ScreenshotTicket.Load() == (m_Ticket & 0xFFFFFF))
+        SetState(CaptureState::Saved);
+}
+
+void SkyBoxCaptureRig::SampleBackBuffer_RenderThread(const FTexture2DRHIRef& BackBuffer)
+{
+    //同步读backbuffer每帧都要等GPU跑完，改成拷一小块异步读回，结果晚一两帧再比较
+    FRHICommandListImmediate& RHICmdList = FRHICommandListExecutor::GetImmediateCommandList();
+    if (m_LuminancePending && m_LuminanceReadback->IsReady())
+    {
+        SKYBOX_TRACE_SCOPE(TEXT("SampleLuminance"), 0);
+        m_LuminancePending = false;
+        EPixelFormat format = m_LuminanceTexture->GetFormat();
+        int32 count = m_LuminanceTexture->GetSizeX() * m_LuminanceTexture->GetSizeY();
+        const uint8* data = (const uint8*)m_LuminanceReadback->Lock(count * 4);
+        if (data != NULL)
+        {
+            //阶段号用发起拷贝时的，阶段变了游戏线程会丢掉
+            SkyBoxReadbackResult result;
+            result.type = SkyBoxReadbackResult::Luminance;
+            result.ticket = m_LuminanceTicket;
+            result.luminance = AverageLuminance(data, format, count);
+            m_Readbacks.Enqueue(MoveTemp(result));
+        }
+        m_LuminanceReadback->Unlock();
+    }
+    uint32 word = m_StateWord.Load();
+    if ((word & 0xFF) != CaptureState::Settling || m_LuminancePending)
+        return;
+    //只拷中心一小块，同一时间只有一个读回在路上
+    //宽度取64像素的整数倍：一行正好对齐到256字节，staging纹理锁住后按紧密排列读
+    const int32 sample_size = 256;
+    EPixelFormat format = BackBuffer->GetFormat();
+    int32 width = FMath::Min((int32)BackBuffer->GetSizeX(), sample_size) & ~63;
+    int32 height = FMath::Min((int32)BackBuffer->GetSizeY(), sample_size);
+    if (width == 0 || height == 0 || !IsLuminanceFormat(format))
+        return;
+    if (!m_LuminanceTexture.IsValid() || m_LuminanceTexture->GetSizeX() != width || m_LuminanceTexture->GetSizeY() != height || m_LuminanceTexture->GetFormat() != format)
+    {
+        //staging纹理按第一次拷贝的大小建，窗口大小或格式变了要一起重建
+        FRHIResourceCreateInfo create_info;
+        m_LuminanceTexture = RHICreateTexture2D(width, height, format, 1, 1, TexCreate_ShaderResource, create_info);
+        m_LuminanceReadback.Reset(new FRHIGPUTextureReadback(TEXT("SkyBoxLuminance")));
+    }
+    FRHICopyTextureInfo copy_info;
+    copy_info.Size = FIntVector(width, height, 1);
+    copy_info.SourcePosition = FIntVector((BackBuffer->GetSizeX() - width) / 2, (BackBuffer->GetSizeY() - height) / 2, 0);
+    RHICmdList.CopyTexture(BackBuffer, m_LuminanceTexture, copy_info);
+    m_LuminanceReadback->EnqueueCopy(RHICmdList, m_LuminanceTexture);
+    m_LuminanceTicket = word >> 8;
+    m_LuminancePending = true;
+}
+
+void SkyBoxCaptureRig::OnScreenshotProcessed_RenderThread()
+{
+    uint32 word = m_StateWord.Load();
+    if ((word & 0xFF) != CaptureState::Waiting1)
+        return;
+    m_ScreenshotTicket = word >> 8;
+}
+
+void SkyBoxCaptureRig::CaptureBackBufferToPNG(const FTexture2DRHIRef& BackBuffer)
+{
+    uint32 word = m_StateWord.Load();
+    if ((word & 0xFF) != CaptureState::Prepared)
+        return;
+    SKYBOX_LOG(Verbose, TEXT("Capture"), TEXT("rig=%d"), m_index);
+    SKYBOX_TRACE_SCOPE(TEXT("ReadBackBuffer"), 0);
+    SkyBoxReadbackResult result;
+    result.type = SkyBoxReadbackResult::BackBuffer;
+    result.ticket = word >> 8;
+    FRHICommandListImmediate& RHICmdList = FRHICommandListExecutor::GetImmediateCommandList();
+    FIntRect Rect(0, 0, BackBuffer->GetSizeX(), BackBuffer->GetSizeY());
+    RHICmdList.ReadSurfaceData(BackBuffer, Rect, result.ldr, FReadSurfaceDataFlags(RCM_UNorm));
+    for (FColor& Color : result.ldr)
+    {
+        Color.A = 255;
+    }
+    result.size_x = BackBuffer->GetSizeX();
+    result.size_y = BackBuffer->GetSizeY();
+    m_Readbacks.Enqueue(MoveTemp(result));
+}
+
+SkyBoxFaceRequest SkyBoxCaptureRig::MakeFaceRequest(int32 size) const
+{
+    SkyBoxFaceRequest request;
+    request.location = m_capture_camera->GetActorLocation();
+    request.rotation = m_capture_camera->GetActorRotation();
+    request.fov = m_capture_camera->GetCameraComponent()->FieldOfView;
+    request.size = size;
+    request.face_size = size;
+    request.tile_count = 1;
+    request.tile_index = 0;
+    request.ticket = m_Ticket & 0xFFFFFF;
+    request.job_id = m_current_job != NULL ? m_current_job->JobID() : 0;
+    return request;
+}
+
+void SkyBoxCaptureRig::CaptureHDR()
+{
+    SKYBOX_LOG(Verbose, TEXT("CaptureHDR"), TEXT("rig=%d job_id=%d direction=%d"), m_index, m_current_job->JobID(), m_CurrentDirection);
+    SetState(CaptureState::ReadingBack);
+    m_backend->CaptureFace(MakeFaceRequest(m_FaceSize));
+}
+
+bool SkyBoxCaptureRig::BeginTiledFace()
+{
+    //块不超过不分块的上限，分块的面至少是2x2块；最后一行、一列的块只写面里面的部分，输出正好是请求的尺寸
+    int32 tile_size = FMath::Clamp(m_config.tile_size, 64, (int32)MaxUntiledFaceSize);
+    m_TileSize = tile_size;
+    m_TileCount = FMath::DivideAndRoundUp(m_FaceSize, tile_size);
+    int32 face_size = m_FaceSize;
+    SKYBOX_LOG(Verbose, TEXT("BeginTiledFace"), TEXT("rig=%d job_id=%d direction=%d size=%dX%d tiles=%d"),
+        m_index, m_current_job->JobID(), m_CurrentDirection, face_size, face_size, m_TileCount * m_TileCount);
+    m_TileWriter.Reset(SkyBoxImageWriter::Create(m_FaceFormat));
+    if (!m_TileWriter->Open(m_BackBufferFilePath, face_size, face_size))
+    {
+        m_TileWriter.Reset();
+        return false;
+    }
+    m_TileStrip.SetNumUninitialized(face_size * tile_size);
+    m_TileIndex = 0;
+    CaptureTile();
+    return true;
+}
+
+void SkyBoxCaptureRig::CaptureTile()
+{
+    SetState(CaptureState::ReadingBack);
+    SkyBoxFaceRequest request = MakeFaceRequest(m_TileSize);
+    request.face_size = m_FaceSize;
+    request.tile_count = m_TileCount;
+    request.tile_index = m_TileIndex;
+    m_backend->CaptureFace(request);
+}
+
+bool SkyBoxCaptureRig::AppendTile()
+{
+    int32 tile_size = m_TileSize;
+    int32 face_size = m_FaceSize;
+    if (m_HDRData.Num() != tile_size * tile_size)
+        return false;
+    SKYBOX_TRACE_SCOPE(TEXT("AppendTile"), m_current_job->JobID());
+    int32 tile_x = m_TileIndex % m_TileCount;
+    int32 tile_y = m_TileIndex / m_TileCount;
+    //最后一列、一行的块伸出面外，只要面里面的列和行
+    int32 width = FMath::Min(tile_size, face_size - tile_x * tile_size);
+    int32 height = FMath::Min(tile_size, face_size - tile_y * tile_size);
+    for (int32 y = 0; y < height; ++y)
+        FMemory::Memcpy(&m_TileStrip[y * face_size + tile_x * tile_size], &m_HDRData[y * tile_size], width * sizeof(FFloat16Color));
+    m_HDRData.Empty();
+    ++m_TileIndex;
+    if (tile_x == m_TileCount - 1)
+    {
+        //一行tile拼满了，写出去之后这块内存给下一行用
+        if (!m_TileWriter->WriteRows(m_TileStrip.GetData(), height))
+            return false;
+    }
+    if (m_TileIndex < m_TileCount * m_TileCount)
+    {
+        CaptureTile();
+        return true;
+    }
+    bool ok = m_TileWriter->Close();
+    m_TileWriter.Reset();
+    m_TileStrip.Empty();
+    if (!ok)
+        return false;
+    SKYBOX_LOG(Verbose, TEXT("SaveTiledFace"), TEXT("rig=%d job_id=%d direction=%d path=%s"), m_index, m_current_job->JobID(), m_CurrentDirection, *m_BackBufferFilePath);
+    SetState(CaptureState::Saved);
+    return true;
+}
+
+bool SkyBoxCaptureRig::SaveHDRToFile()
+{
+    int32 width = m_FaceSize;
+    int32 height = m_FaceSize;
+    if (m_HDRData.Num() != width * height)
+        return false;
+    SKYBOX_LOG(Verbose, TEXT("SaveHDR"), TEXT("rig=%d job_id=%d position=(%.1f,%.1f,%.1f) direction=%d"),
+        m_index, m_current_job->JobID(), m_current_job->m_position.x, m_current_job->m_position.y, m_current_job->m_position.z, m_CurrentDirection);
+    //直接从读回的数据逐行编码写盘，不再复制一份整图
+    SKYBOX_TRACE_SCOPE(TEXT("EncodeWrite"), m_current_job->JobID());
+    TUniquePtr<SkyBoxImageWriter> writer(SkyBoxImageWriter::Create(m_FaceFormat));
+    bool ok = writer->Open(m_BackBufferFilePath, width, height) && writer->WriteRows(m_HDRData.GetData(), height);
+    ok = writer->Close() && ok;
+    m_HDRData.Empty();
+    if (!ok)
+    {
+        SKYBOX_LOG(Warning, TEXT("SaveHDRFailed"), TEXT("path=%s"), *m_BackBufferFilePath);
+        return false;
+    }
+    return true;
+}
+
+void SkyBoxCaptureRig::PrepareJobSettings()
+{
+    //请求里没指定的，按编辑器里的配置
+    const SkyBoxCaptureSettings& settings = m_current_job->m_settings;
+    m_FaceSize = settings.resolution > 0 ? settings.resolution : m_config.default_face_size;
+    switch (settings.format)
+    {
+    case skybox::ImageFormat::PNG:
+        m_FaceFormat = SkyBoxImageFormat::PNG;
+        break;
+    case skybox::ImageFormat::EXR:
+        m_FaceFormat = SkyBoxImageFormat::EXR;
+        break;
+    case skybox::ImageFormat::RGBE:
+        m_FaceFormat = SkyBoxImageFormat::RGBE;
+        break;
+    default:
+        if (!m_config.hdr_capture)
+            m_FaceFormat = SkyBoxImageFormat::PNG;
+        else
+            m_FaceFormat = m_config.hdr_write_exr ? SkyBoxImageFormat::EXR : SkyBoxImageFormat::RGBE;
+        break;
+    }
+    SKYBOX_LOG(Verbose, TEXT("JobSettings"), TEXT("rig=%d job_id=%d size=%d format=%s quality=%d"),
+        m_index, m_current_job->JobID(), m_FaceSize, SkyBoxImageWriter::GetExtension(m_FaceFormat), (int32)settings.quality);
+}
+
+FString SkyBoxCaptureRig::GetJobFilePrefix() const
+{
+    //画质档位也是去重key的一部分，不同档位的结果不能互相覆盖
+    FString quality;
+    if (m_current_job->m_settings.quality == skybox::QualityPreset::Draft)
+        quality = TEXT("_Draft");
+    else if (m_current_job->m_settings.quality == skybox::QualityPreset::Final)
+        quality = TEXT("_Final");
+    return m_config.output_dir / FString::Printf(TEXT("SkyBox(%dX%d)_Scene%d_(%.1f，%.1f，%.1f)%s"),
+        m_FaceSize, m_FaceSize, m_current_job->m_position.scene_id, m_current_job->m_position.x, m_current_job->m_position.y, m_current_job->m_position.z, *quality);
+}
+
+bool SkyBoxCaptureRig::SavePNGToFile()
+{
+    if (m_BackBufferData.Num() == 0)
+        return false;
+    SKYBOX_LOG(Verbose, TEXT("SavePNG"), TEXT("job_id=%d position=(%.1f,%.1f,%.1f) direction=%d"),
+        m_current_job->JobID(), m_current_job->m_position.x, m_current_job->m_position.y, m_current_job->m_position.z, m_CurrentDirection);
+    TArray<uint8> CompressedBitmap;
+    {
+        SKYBOX_TRACE_SCOPE(TEXT("Encode"), m_current_job->JobID());
+        FImageUtils::CompressImageArray(m_BackBufferSizeX, m_BackBufferSizeY, m_BackBufferData, CompressedBitmap);
+    }
+    SKYBOX_TRACE_SCOPE(TEXT("Write"), m_current_job->JobID());
+    bool Success = FFileHelper::SaveArrayToFile(CompressedBitmap, *m_BackBufferFilePath);
+    if (!Success)
+    {
+        SKYBOX_LOG(Warning, TEXT("SavePNGFailed"), TEXT("path=%s"), *m_BackBufferFilePath);
+        return false;
+    }
+    m_BackBufferData.Reset();
+    return true;
+}
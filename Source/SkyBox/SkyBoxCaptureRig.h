@@ -0,0 +1,126 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Templates/Atomic.h"
+#include "RHIResources.h"
+#include "SkyBoxIBL.h"
+#include "SkyBoxCaptureBackend.h"
+
+class ACameraActor;
+class ASkyBoxCharacter;
+class SkyBoxJob;
+
+
+//采集参数，来自ASkyBoxCharacter上编辑器里的配置
+struct SkyBoxRigConfig
+{
+    bool hdr_capture;
+    bool hdr_write_exr;
+    int32 default_face_size;  //请求没指定分辨率时用
+    int32 tile_size;
+    float settle_timeout;  //秒，场景迟迟稳定不下来也照样采集
+    float stage_timeout;  //秒，截图、读回卡在一个阶段超过这么久就当这个面失败
+    int32 max_face_retries;  //一个面失败后最多重采几次，再失败整个任务失败
+    bool synthetic;  //用SkyBoxSyntheticBackend代替引擎渲染
+    float synthetic_latency;  //秒，合成后端模拟的每个面（块）的渲染时间
+    FString output_dir;  //六个面和IBL结果写到这个目录
+};
+
+
+//一套采集设备：一个相机加上挂在它上面的SceneCapture，自己从队列取任务、跑自己的状态机
+//同一个world里可以有多套，每帧各自采集，GPU没跑满时吞吐随rig数增长
+class SkyBoxCaptureRig
+{
+public:
+    //use_viewport的rig是玩家的ViewTarget，PNG走HighResShot；其他rig都走SceneCapture；合成后端不能是ViewTarget
+    SkyBoxCaptureRig(ASkyBoxCharacter* owner, int32 index, ACameraActor* camera, bool use_viewport, const SkyBoxRigConfig& config);
+    ~SkyBoxCaptureRig();
+    void Tick();
+    bool IsBusy() const { return m_current_job != NULL; }
+    bool UsesViewport() const { return m_use_viewport; }
+    void BeginWarmup(const TArray<FVector>& positions);  //对外报SERVING之前，在这些位置把六个方向都渲染一遍
+    bool IsWarmingUp() const { return m_CurrentState == CaptureState::Warming; }
+    FVector GetLocation() const;
+    void OnScreenshotProcessed_RenderThread();
+    void CaptureBackBufferToPNG(const FTexture2DRHIRef& BackBuffer);
+    void SampleBackBuffer_RenderThread(const FTexture2DRHIRef& BackBuffer);
+public:
+    static const int32 MaxUntiledFaceSize = 4096;
+    static const int32 WarmupCaptureSize = 256;  //预热只为了编译shader和PSO，尺寸无所谓
+private:
+    void TickWarmup();
+    void PrepareJobSettings();
+    void CompleteJob(bool success);
+    void AbortJob();  //任务被取消，只在面与面之间调用
+    void RetryFace();  //当前面失败：次数没用完就从稳定阶段重来，否则整个任务失败
+    bool CheckWatchdog();  //当前阶段卡住时返回true，已经处理过了
+    void ReleaseJob();
+    void BeginSettle();
+    bool IsSceneSettled();
+    bool SavePNGToFile();
+    SkyBoxFaceRequest MakeFaceRequest(int32 size) const;
+    void CaptureHDR();
+    void SetState(int32 state);  //只在游戏线程调用，同时发布给渲染线程
+    void DrainReadbacks();
+    bool SaveHDRToFile();
+    bool BeginTiledFace();
+    void CaptureTile();
+    bool AppendTile();
+    FString GetJobFilePrefix() const;
+private:
+    enum CaptureState
+    {
+        Invalid = 0,
+        Waiting1,
+        Prepared,
+        Captured,
+        Saved,
+        Filtering,
+        ReadingBack,
+        Settling,
+        Warming,
+    };
+    ASkyBoxCharacter* m_owner;
+    int32 m_index;
+    ACameraActor* m_capture_camera;
+    bool m_use_viewport;
+    SkyBoxRigConfig m_config;
+    TUniquePtr<SkyBoxCaptureBackend> m_backend;
+    TArray<FRotator> m_SixDirection;
+    SkyBoxJob* m_current_job;
+    int32 m_CurrentDirection;
+    CaptureState m_CurrentState;  //只有游戏线程读写
+    uint32 m_Ticket;  //每次换阶段加1
+    double m_StateEnterTime;  //进入当前阶段的时间，换阶段时记一条trace
+    //渲染线程不碰游戏线程的数据，也不等锁：只读这个状态字（m_Ticket << 8 | m_CurrentState），结果放进SPSC队列
+    TAtomic<uint32> m_StateWord;
+    TAtomic<uint32> m_ScreenshotTicket;  //截图回调不一定在渲染线程，不能当队列的第二个生产者，只记下阶段号
+    SkyBoxReadbackQueue m_Readbacks;
+    TArray<FColor> m_BackBufferData;
+    uint32 m_BackBufferSizeX;
+    uint32 m_BackBufferSizeY;
+    FString m_BackBufferFilePath;
+    TArray<FFloat16Color> m_HDRData;
+    FTexture2DRHIRef m_LuminanceTexture;  //下面四个只在渲染线程读写：backbuffer中心拷到这张小图再读回
+    TUniquePtr<FRHIGPUTextureReadback> m_LuminanceReadback;
+    uint32 m_LuminanceTicket;
+    bool m_LuminancePending;
+    double m_SettleStartTime;
+    int32 m_SettleFrames;
+    uint32 m_WatchedTicket;  //看门狗记录的阶段号和进入时间
+    double m_StageStartTime;
+    int32 m_FaceAttempts;  //当前面已经失败的次数
+    float m_LastLuminance;  //ViewTarget画面中心的平均亮度，渲染线程异步读回后更新
+    int32 m_StableSamples;  //连续几帧亮度基本不变
+    int32 m_FaceSize;  //当前任务每个面的边长
+    SkyBoxImageFormat m_FaceFormat;
+    int32 m_TileCount;  //每个面m_TileCount x m_TileCount块
+    int32 m_TileSize;
+    int32 m_TileIndex;
+    TArray<FFloat16Color> m_TileStrip;  //只缓存一行tile，拼满就写出
+    TUniquePtr<SkyBoxImageWriter> m_TileWriter;
+    TArray<FString> m_FaceFilePaths;
+    TArray<FVector> m_WarmupPositions;
+    int32 m_WarmupStep;  //位置序号 * 6 + 方向
+    TFuture<SkyBoxBakeResult> m_FilterResult;
+};
@@ -15,11 +15,23 @@
 // ZZW
 #include <Private/PostProcess/SceneRenderTargets.h>
 #include <SlateApplication.h>
-#include <ImageUtils.h>
-#include <FileHelper.h>
 #include "UnrealClient.h"
 #include "SkyBoxRPC.h"
 #include "SkyBoxWorker.h"
+#include "SkyBoxCaptureRig.h"
+#include "SkyBoxLevelPool.h"
+#include "SkyBoxTrace.h"
+#include "ContentStreaming.h"
+#include "Engine/WorldComposition.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/HUD.h"
+#include "Misc/App.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "RenderingThread.h"
+#include "ShaderCompiler.h"
+#include "ShaderPipelineCache.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogFPChar, Warning, All);
 
@@ -68,6 +80,8 @@ ASkyBoxCharacter::ASkyBoxCharacter()
 	// Note: The ProjectileClass and the skeletal mesh/anim blueprints for Mesh1P, FP_Gun, and VR_Gun 
 	// are set in the derived blueprint asset named MyCharacter to avoid direct content references in C++.
 
+    // ZZW 渲染节点的SkyBoxServer不需要VR
+#if !SKYBOX_CAPTURE_SERVER
 	// Create VR Controllers.
 	R_MotionController = CreateDefaultSubobject<UMotionControllerComponent>(TEXT("R_MotionController"));
 	R_MotionController->MotionSource = FXRMotionControllerBase::RightHandSourceId;
@@ -88,24 +102,39 @@ ASkyBoxCharacter::ASkyBoxCharacter()
 	VR_MuzzleLocation->SetupAttachment(VR_Gun);
 	VR_MuzzleLocation->SetRelativeLocation(FVector(0.000004, 53.999992, 10.000000));
 	VR_MuzzleLocation->SetRelativeRotation(FRotator(0.0f, 90.0f, 0.0f));		// Counteract the rotation of the VR gun model.
+#else
+	R_MotionController = NULL;
+	L_MotionController = NULL;
+	VR_Gun = NULL;
+	VR_MuzzleLocation = NULL;
+#endif
 
 	// Uncomment the following line to turn motion controllers on by default:
 	//bUsingMotionControllers = true;
 
     // ZZW
     PrimaryActorTick.bCanEverTick = true; //为了在编辑器里执行Tick
-    m_SixDirection.Push(FRotator(0.0f, 0.0f, 0.0f));  //前
-    m_SixDirection.Push(FRotator(0.0f, 90.0f, 0.0f));  //右
-    m_SixDirection.Push(FRotator(0.0f, 180.0f, 0.0f));  //后
-    m_SixDirection.Push(FRotator(0.0f, -90.0f, 0.0f));  //左
-    m_SixDirection.Push(FRotator(90.0f, 0.0f, 0.0f));  //上
-    m_SixDirection.Push(FRotator(-90.0f, 0.0f, 0.0f));  //下
-    //m_SixDirection.Push(FRotator(0.0f, 0.0f, 0.0f));  //前
-    m_current_job = NULL;
-    m_CurrentDirection = -1;
-    m_CurrentState = CaptureState::Invalid;
-
     m_capture_camera = NULL;
+    HDRCapture = false;
+    HDRWriteEXR = true;
+    TiledFaceSize = 0;
+    TileSize = 1024;
+    CaptureRigCount = 1;
+    SettleTimeout = 5.0f;
+    StageTimeout = 30.0f;
+    MaxFaceRetries = 2;
+    LookaheadCount = 2;
+    ResidentSceneCount = 2;
+    MaxQueueDepth = 100000;
+    MaxClientInFlight = 20000;
+    SyntheticCapture = false;
+    SyntheticRenderLatency = 0.05f;
+    CaptureServerMode = false;
+    m_LevelPool = NULL;
+    m_ViewportRig = NULL;
+    m_AppliedQuality = skybox::QualityPreset::Standard;
+    m_Serving = false;
+    m_InCaptureServerMode = false;
 }
 
 void ASkyBoxCharacter::BeginPlay()
@@ -116,6 +145,7 @@ void ASkyBoxCharacter::BeginPlay()
 	//Attach gun mesh component to Skeleton, doing it here because the skeleton is not yet created in the constructor
 	FP_Gun->AttachToComponent(Mesh1P, FAttachmentTransformRules(EAttachmentRule::SnapToTarget, true), TEXT("GripPoint"));
 
+#if !SKYBOX_CAPTURE_SERVER
 	// Show or hide the two versions of the gun based on whether or not we're using motion controllers.
 	if (bUsingMotionControllers)
 	{
@@ -127,6 +157,7 @@ void ASkyBoxCharacter::BeginPlay()
 		VR_Gun->SetHiddenInGame(true, true);
 		Mesh1P->SetHiddenInGame(false, true);
 	}
+#endif
 
     // ZZW
     UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！ASkyBoxCharacter::BeginPlay()"));
@@ -141,8 +172,79 @@ void ASkyBoxCharacter::BeginPlay()
 
     APlayerController* OurPlayerController = UGameplayStatics::GetPlayerController(this, 0);
     OurPlayerController->SetViewTarget(m_capture_camera);
+    m_DefaultQualityLevels = Scalability::GetQualityLevels();
+    if (IsCaptureServerMode())
+        EnterCaptureServerMode();
+
+    m_LevelPool = new SkyBoxLevelPool(GetWorld(), SceneLevels, ResidentSceneCount);
+    SkyBoxServiceImpl::Instance()->SetSceneCount(m_LevelPool->SceneCount());
+    SkyBoxServiceImpl::Instance()->SetAdmissionLimits(MaxQueueDepth, MaxClientInFlight);
+    for (const TPair<FString, float>& pair : ClientWeights)
+        SkyBoxServiceImpl::Instance()->SetClientWeight(TCHAR_TO_UTF8(*pair.Key), pair.Value);
+
+    SkyBoxRigConfig config;
+    config.hdr_capture = HDRCapture;
+    config.hdr_write_exr = HDRWriteEXR;
+    config.default_face_size = TiledFaceSize > 0 ? TiledFaceSize : 2048;
+    config.tile_size = TileSize;
+    config.settle_timeout = SettleTimeout;
+    config.stage_timeout = StageTimeout;
+    config.max_face_retries = MaxFaceRetries;
+    config.synthetic = IsSyntheticCapture();
+    config.synthetic_latency = SyntheticRenderLatency;
+    config.output_dir = GetOutputDir();
+    //只有一套rig时，它就是ViewTarget，PNG照旧走HighResShot；多套时都走SceneCapture，输出一致；合成的不用ViewTarget
+    int32 rig_count = FMath::Max(CaptureRigCount, 1);
+    for (int32 i = 0; i < rig_count; ++i)
+    {
+        ACameraActor* camera = m_capture_camera;
+        if (i > 0)
+        {
+            camera = GetWorld()->SpawnActor<ACameraActor>(GetActorLocation(), GetActorRotation());
+            camera->GetCameraComponent()->bUsePawnControlRotation = false;
+            camera->GetCameraComponent()->SetFieldOfView(camera_component->FieldOfView);
+            camera->GetCameraComponent()->SetAspectRatio(1.0f);
+            camera->GetCameraComponent()->SetConstraintAspectRatio(true);
+        }
+        m_rigs.Add(new SkyBoxCaptureRig(this, i, camera, rig_count == 1 && !config.synthetic, config));
+    }
+    //渲染线程的回调不碰m_rigs，只读这个指针；rig都建好之后再发布、再注册回调
+    m_ViewportRig = m_rigs[0]->UsesViewport() ? m_rigs[0] : NULL;
     FSlateApplication::Get().GetRenderer()->OnBackBufferReadyToPresent().AddUObject(this, &ASkyBoxCharacter::OnBackBufferReady_RenderThread);
     FScreenshotRequest::OnScreenshotRequestProcessed().AddUObject(this, &ASkyBoxCharacter::OnScreenshotProcessed_RenderThread);
+
+    //预热：PSO缓存全速预编译，各rig在代表位置把六个方向渲染一遍，都完成后才报SERVING
+    FShaderPipelineCache::SetBatchMode(FShaderPipelineCache::BatchMode::Fast);
+    TArray<FVector> warmup_positions = WarmupPositions;
+    if (warmup_positions.Num() == 0)
+        warmup_positions.Add(GetActorLocation());
+    for (SkyBoxCaptureRig* rig : m_rigs)
+        rig->BeginWarmup(warmup_positions);
+}
+
+void ASkyBoxCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    m_Serving = false;
+    SkyBoxServiceImpl::Instance()->SetServing(false);
+    //先让渲染线程的回调看不到rig，等已经排进去的渲染命令跑完，再解绑、删rig
+    m_ViewportRig = NULL;
+    FlushRenderingCommands();
+    if (FSlateApplication::IsInitialized())
+        FSlateApplication::Get().GetRenderer()->OnBackBufferReadyToPresent().RemoveAll(this);
+    FScreenshotRequest::OnScreenshotRequestProcessed().RemoveAll(this);
+    for (SkyBoxCaptureRig* rig : m_rigs)
+        delete rig;
+    m_rigs.Empty();
+    delete m_LevelPool;
+    m_LevelPool = NULL;
+    //scalability也是全局的，换回启动时的设置
+    if (m_AppliedQuality != skybox::QualityPreset::Standard)
+    {
+        Scalability::SetQualityLevels(m_DefaultQualityLevels);
+        m_AppliedQuality = skybox::QualityPreset::Standard;
+    }
+    ExitCaptureServerMode();
+    Super::EndPlay(EndPlayReason);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -153,6 +255,10 @@ void ASkyBoxCharacter::SetupPlayerInputComponent(class UInputComponent* PlayerIn
 	// set up gameplay key bindings
 	check(PlayerInputComponent);
 
+    // ZZW
+    if (IsCaptureServerMode())
+        return;  //采集服务器不需要开火、移动、触屏、VR这些输入
+
 	// Bind jump events
 	PlayerInputComponent->BindAction("Jump", IE_Pressed, this, &ACharacter::Jump);
 	PlayerInputComponent->BindAction("Jump", IE_Released, this, &ACharacter::StopJumping);
@@ -346,8 +452,9 @@ ASkyBoxCharacter::~ASkyBoxCharacter()
     // ZZW
     UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！ASkyBoxCharacter::~ASkyBoxCharacter"));
     m_capture_camera = NULL;
-    SkyBoxWorker::Shutdown();
-    //FSlateApplication::Get().GetRenderer()->OnBackBufferReadyToPresent().RemoveAll(this);
+#if WITH_EDITOR
+    SkyBoxWorker::Shutdown();  //打包版的RPC服务跟着模块走，换地图不关
+#endif
 }
 
 void ASkyBoxCharacter::Tick(float DeltaSeconds)
@@ -355,77 +462,165 @@ void ASkyBoxCharacter::Tick(float DeltaSeconds)
     Super::Tick(DeltaSeconds);
     if (m_capture_camera == NULL)
         return;
+    SKYBOX_TRACE_SCOPE(TEXT("Character.Tick"), 0);
+    UpdateServingStatus();
+    //每套rig各自推进，同一帧里可以有好几个位置在采集
+    for (SkyBoxCaptureRig* rig : m_rigs)
+        rig->Tick();
+    PrestreamUpcoming();
+}
 
-    FScopeLock lock(&m_lock);
-    
-    if (m_current_job == NULL)
+bool ASkyBoxCharacter::IsRendererWarm() const
+{
+    //shader还在编译、PSO还在预编译时采集会卡顿，这时候接活p99会很难看
+    if (GShaderCompilingManager != NULL && GShaderCompilingManager->IsCompiling())
+        return false;
+    if (FShaderPipelineCache::NumPrecompilesRemaining() > 0)
+        return false;
+    return true;
+}
+
+void ASkyBoxCharacter::UpdateServingStatus()
+{
+    if (m_Serving)
+        return;
+    if (m_rigs.Num() == 0 || !IsRendererWarm())
+        return;
+    for (SkyBoxCaptureRig* rig : m_rigs)
     {
-        m_current_job = SkyBoxServiceImpl::Instance()->GetJob();
-        if (m_current_job == NULL)
+        if (rig->IsWarmingUp())
             return;
-        UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！Get New Job, job_id = %d, scene_id = %d, position = (%.1f, %.1f, %.1f)"),
-            m_current_job->JobID(), m_current_job->m_position.scene_id, m_current_job->m_position.x, m_current_job->m_position.y, m_current_job->m_position.z);
-        SetActorLocation(FVector(m_current_job->m_position.x, m_current_job->m_position.y, m_current_job->m_position.z));
-        m_capture_camera->SetActorLocation(FVector(m_current_job->m_position.x, m_current_job->m_position.y, m_current_job->m_position.z));
-        m_CurrentDirection = 0;
-        m_CurrentState = CaptureState::Waiting1;
-        m_capture_camera->SetActorRotation(m_SixDirection[m_CurrentDirection]);
-        UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！Change Direction, job_id = %d, m_CurrentDirection = %d"), m_current_job->JobID(), m_CurrentDirection);
-        return;
     }
-    if (m_CurrentState == CaptureState::Waiting1)
+    m_Serving = true;
+    FShaderPipelineCache::SetBatchMode(FShaderPipelineCache::BatchMode::Background);
+    SkyBoxServiceImpl::Instance()->SetServing(true);
+}
+
+bool ASkyBoxCharacter::IsCaptureServerMode() const
+{
+#if SKYBOX_CAPTURE_SERVER
+    return true;
+#else
+    return CaptureServerMode || FParse::Param(FCommandLine::Get(), TEXT("SkyBoxCaptureServer"));
+#endif
+}
+
+bool ASkyBoxCharacter::IsSyntheticCapture() const
+{
+    return SyntheticCapture || FParse::Param(FCommandLine::Get(), TEXT("SkyBoxSynthetic"));
+}
+
+FString ASkyBoxCharacter::GetOutputDir() const
+{
+    //命令行-SkyBoxOutputDir=优先，其次是Game.ini里[SkyBox]的OutputDir，都没有就放Saved/SkyBox
+    FString dir;
+    if (!FParse::Value(FCommandLine::Get(), TEXT("SkyBoxOutputDir="), dir) || dir.IsEmpty())
     {
-        //m_CurrentState = CaptureState::Prepared;
+        if (!GConfig->GetString(TEXT("SkyBox"), TEXT("OutputDir"), dir, GGameIni) || dir.IsEmpty())
+            dir = FPaths::ProjectSavedDir() / TEXT("SkyBox");
+    }
+    dir = FPaths::ConvertRelativePathToFull(dir);
+    if (!IFileManager::Get().MakeDirectory(*dir, true))
+        UE_LOG(LogTemp, Error, TEXT("！！！！！！！！！！ASkyBoxCharacter::GetOutputDir() FAIL %s"), *dir);
+    UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！SkyBox output dir = %s"), *dir);
+    return dir;
+}
 
-        m_BackBufferFilePath = FString::Printf(TEXT("I:/UE4Workspace/png/SkyBox(%dX%d)_Scene%d_(%.1f，%.1f，%.1f)_%d.png"),
-            m_BackBufferSizeX, m_BackBufferSizeY, m_current_job->m_position.scene_id, m_current_job->m_position.x, m_current_job->m_position.y, m_current_job->m_position.z, m_CurrentDirection);
+void ASkyBoxCharacter::EnterCaptureServerMode()
+{
+    UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！ASkyBoxCharacter::EnterCaptureServerMode()"));
+    //第一人称的手臂和枪、VR手柄都不要了：隐藏并且停掉tick（包括动画）
+    USceneComponent* gameplay_components[] = { Mesh1P, FP_Gun, VR_Gun, R_MotionController, L_MotionController };
+    for (USceneComponent* component : gameplay_components)
+    {
+        if (component == NULL)
+            continue;
+        component->SetHiddenInGame(true, true);
+        component->SetComponentTickEnabled(false);
+    }
+    //角色只是跟着任务瞬移，不需要移动组件和碰撞
+    GetCharacterMovement()->DisableMovement();
+    GetCharacterMovement()->SetComponentTickEnabled(false);
+    SetActorEnableCollision(false);
+
+    //不画HUD（准星）
+    APlayerController* controller = UGameplayStatics::GetPlayerController(this, 0);
+    if (controller != NULL && controller->MyHUD != NULL)
+    {
+        controller->MyHUD->bShowHUD = false;
+        controller->MyHUD->SetActorTickEnabled(false);
+    }
 
-        FString cmd = FString::Printf(TEXT("HighResShot 2048x2048 filename=\"%s\""), *m_BackBufferFilePath);
-        UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！%s"), *cmd);
+    //物理和声音都停掉
+    UWorld* world = GetWorld();
+    m_SavedSimulatePhysics = world->bShouldSimulatePhysics;
+    m_SavedAllowAudioPlayback = world->bAllowAudioPlayback;
+    world->bShouldSimulatePhysics = false;
+    world->bAllowAudioPlayback = false;
+
+    //固定步长，不按真实时间限帧，能跑多快跑多快
+    m_SavedUseFixedTimeStep = FApp::UseFixedTimeStep();
+    m_SavedFixedDeltaTime = FApp::GetFixedDeltaTime();
+    m_SavedSmoothFrameRate = GEngine->bSmoothFrameRate != 0;
+    m_InCaptureServerMode = true;
+    FApp::SetUseFixedTimeStep(true);
+    FApp::SetFixedDeltaTime(1.0 / 30.0);
+    GEngine->bSmoothFrameRate = false;
+}
 
-        GEngine->Exec(GetWorld(), *cmd);
-        //m_CurrentState = CaptureState::Saved;
+void ASkyBoxCharacter::ExitCaptureServerMode()
+{
+    if (!m_InCaptureServerMode)
         return;
-    }
-    if (m_CurrentState == CaptureState::Captured)
+    m_InCaptureServerMode = false;
+    UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！ASkyBoxCharacter::ExitCaptureServerMode()"));
+    FApp::SetUseFixedTimeStep(m_SavedUseFixedTimeStep);
+    FApp::SetFixedDeltaTime(m_SavedFixedDeltaTime);
+    GEngine->bSmoothFrameRate = m_SavedSmoothFrameRate;
+    UWorld* world = GetWorld();
+    if (world != NULL)
     {
-        bool ok = SavePNGToFile();
-        if (!ok)
-        {
-            UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！Job Failed, job_id = %d, scene_id = %d, position = (%.1f, %.1f, %.1f)"),
-                m_current_job->JobID(), m_current_job->m_position.scene_id, m_current_job->m_position.x, m_current_job->m_position.y, m_current_job->m_position.z);
-            m_current_job->SetStatus(skybox::JobStatus::Failed);
-            SkyBoxServiceImpl::Instance()->OnJobCompleted(m_current_job);
-            m_current_job = NULL;
-            m_CurrentDirection = -1;
-            m_CurrentState = CaptureState::Invalid;
-        }
-        else
-        {
-            m_CurrentState = CaptureState::Saved;
-        }
+        world->bShouldSimulatePhysics = m_SavedSimulatePhysics;
+        world->bAllowAudioPlayback = m_SavedAllowAudioPlayback;
+    }
+}
+
+void ASkyBoxCharacter::PrestreamUpcoming()
+{
+    SKYBOX_TRACE_SCOPE(TEXT("Prestream"), 0);
+    //当前场景干完后要切过去的场景，先在后台加载着
+    int32 next_scene = SkyBoxServiceImpl::Instance()->PickScene(m_LevelPool->GetResidentScenes(), m_LevelPool->GetActiveScene());
+    if (next_scene >= 0)
+        m_LevelPool->Preload(next_scene);
+    if (LookaheadCount <= 0)
+        return;
+    //采当前任务的同时，让接下来几个位置的纹理和关卡先流送起来，瞬移过去时不用从零开始等
+    TArray<SkyBoxPosition> upcoming;
+    SkyBoxServiceImpl::Instance()->PeekWaitingPositions(m_LevelPool->GetActiveScene(), LookaheadCount, upcoming);
+    if (upcoming.Num() == 0)
         return;
+    TArray<FVector> locations;
+    for (const SkyBoxPosition& position : upcoming)
+    {
+        FVector location(position.x, position.y, position.z);
+        IStreamingManager::Get().AddViewSlaveLocation(location);
+        locations.Add(location);
     }
-    if (m_CurrentState == CaptureState::Saved)
+    UWorldComposition* composition = GetWorld()->WorldComposition;
+    if (composition != NULL)
     {
-        ++m_CurrentDirection;
-        if (m_CurrentDirection < m_SixDirection.Num())
-        {
-            m_CurrentState = CaptureState::Waiting1;
-            m_capture_camera->SetActorRotation(m_SixDirection[m_CurrentDirection]);
-            UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！Change Direction, job_id = %d, m_CurrentDirection = %d"), m_current_job->JobID(), m_CurrentDirection);
-        }
-        else
+        //关卡流送按这组位置重新算，正在采的rig和玩家视角也要带上，不然会把它们的关卡卸掉
+        for (SkyBoxCaptureRig* rig : m_rigs)
+            locations.Add(rig->GetLocation());
+        APlayerController* controller = UGameplayStatics::GetPlayerController(this, 0);
+        if (controller != NULL)
         {
-            UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！Job Succeeded, job_id = %d, scene_id = %d, position = (%.1f, %.1f, %.1f)"),
-                m_current_job->JobID(), m_current_job->m_position.scene_id, m_current_job->m_position.x, m_current_job->m_position.y, m_current_job->m_position.z);
-            m_current_job->SetStatus(skybox::JobStatus::Succeeded);
-            SkyBoxServiceImpl::Instance()->OnJobCompleted(m_current_job);
-            m_current_job = NULL;
-            m_CurrentDirection = -1;
-            m_CurrentState = CaptureState::Invalid;
+            FVector view_location;
+            FRotator view_rotation;
+            controller->GetPlayerViewPoint(view_location, view_rotation);
+            locations.Add(view_location);
         }
-        return;
+        composition->UpdateStreamingState(locations.GetData(), locations.Num());
     }
 }
 
@@ -436,56 +631,67 @@ bool ASkyBoxCharacter::ShouldTickIfViewportsOnly() const
 
 void ASkyBoxCharacter::OnBackBufferReady_RenderThread(SWindow& SlateWindow, const FTexture2DRHIRef& BackBuffer)
 {
-    CaptureBackBufferToPNG(BackBuffer);
+    SkyBoxCaptureRig* rig = m_ViewportRig.Load();
+    if (rig != NULL)
+    {
+        rig->SampleBackBuffer_RenderThread(BackBuffer);
+        rig->CaptureBackBufferToPNG(BackBuffer);
+    }
 }
 
 void ASkyBoxCharacter::OnScreenshotProcessed_RenderThread()
 {
-    FScopeLock lock(&m_lock);
-    m_CurrentState = CaptureState::Saved;
+    //HighResShot只有ViewTarget那套rig会用
+    SkyBoxCaptureRig* rig = m_ViewportRig.Load();
+    if (rig != NULL)
+        rig->OnScreenshotProcessed_RenderThread();
 }
 
-void ASkyBoxCharacter::CaptureBackBufferToPNG(const FTexture2DRHIRef& BackBuffer)
+SkyBoxJob* ASkyBoxCharacter::AcquireJob()
 {
+    if (!m_Serving)
+        return NULL;  //还没准备好，请求先排着
     FScopeLock lock(&m_lock);
-
-    if (m_CurrentState != CaptureState::Prepared)
-        return;
-    if (m_BackBufferData.Num() != 0)
-        return;
-    UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！CAPTURE, job_id = %d, m_CurrentDirection = %d"), m_current_job->JobID(), m_CurrentDirection);
-    FRHICommandListImmediate& RHICmdList = FRHICommandListExecutor::GetImmediateCommandList();
-    FIntRect Rect(0, 0, BackBuffer->GetSizeX(), BackBuffer->GetSizeY());
-    RHICmdList.ReadSurfaceData(BackBuffer, Rect, m_BackBufferData, FReadSurfaceDataFlags(RCM_UNorm));
-    for (FColor& Color : m_BackBufferData)
+    //scalability是全局的，还有rig在干活时只能接同一档画质的任务
+    bool busy = false;
+    for (SkyBoxCaptureRig* rig : m_rigs)
+        busy = busy || rig->IsBusy();
+    //可见性也是全局的，所有rig都闲下来、当前场景的活也干完了才换场景，尽量少切关卡
+    //当前场景排在驻留列表最前面，有活就不会换
+    int32 scene_id = m_LevelPool->GetActiveScene();
+    if (!busy)
     {
-        Color.A = 255;
+        int32 next = SkyBoxServiceImpl::Instance()->PickScene(m_LevelPool->GetResidentScenes(), -1);
+        if (next >= 0)
+        {
+            m_LevelPool->Activate(next);
+            scene_id = next;
+        }
     }
-    m_BackBufferSizeX = BackBuffer->GetSizeX();
-    m_BackBufferSizeY = BackBuffer->GetSizeY();
-
-    FDateTime Time = FDateTime::Now();
-    /*m_BackBufferFilePath = FString::Printf(TEXT("I:\\UE4Workspace\\png\\BACK(%dX%d)_%d__%04d-%02d-%02d_%02d-%02d-%02d_%d.png"),
-        m_BackBufferSizeX, m_BackBufferSizeY, m_CurrentDirection, Time.GetYear(), Time.GetMonth(), Time.GetDay(), Time.GetHour(), Time.GetMinute(), Time.GetSecond(), Time.GetMillisecond());*/
-    m_BackBufferFilePath = FString::Printf(TEXT("I:\\UE4Workspace\\png\\SkyBox(%dX%d)_Scene%d_(%.1f，%.1f，%.1f)_%d.png"),
-        m_BackBufferSizeX, m_BackBufferSizeY, m_current_job->m_position.scene_id, m_current_job->m_position.x, m_current_job->m_position.y, m_current_job->m_position.z, m_CurrentDirection);
-    m_CurrentState = CaptureState::Captured;
+    if (!m_LevelPool->IsReady(scene_id))
+        return NULL;  //关卡还在加载或者变可见
+    SkyBoxJob* job = SkyBoxServiceImpl::Instance()->GetJob(scene_id, busy ? m_AppliedQuality : -1);
+    if (job != NULL)
+        ApplyQualityPreset(job->m_settings.quality);
+    return job;
 }
 
-bool ASkyBoxCharacter::SavePNGToFile()
+void ASkyBoxCharacter::ApplyQualityPreset(int32 quality)
 {
-    if (m_BackBufferData.Num() == 0)
-        return false;
-    UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！SAVE, job_id = %d, position = (%.1f, %.1f, %.1f), m_CurrentDirection = %d"),
-        m_current_job->JobID(), m_current_job->m_position.x, m_current_job->m_position.y, m_current_job->m_position.z, m_CurrentDirection);
-    TArray<uint8> CompressedBitmap;
-    FImageUtils::CompressImageArray(m_BackBufferSizeX, m_BackBufferSizeY, m_BackBufferData, CompressedBitmap);
-    bool Success = FFileHelper::SaveArrayToFile(CompressedBitmap, *m_BackBufferFilePath);
-    if (!Success)
+    //和上一个任务同档就不用动，切换scalability会重新加载一部分资源
+    if (quality == m_AppliedQuality)
+        return;
+    m_AppliedQuality = quality;
+    Scalability::FQualityLevels levels = m_DefaultQualityLevels;
+    if (quality == skybox::QualityPreset::Draft)
     {
-        UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！SavePNGToFile() FAIL %s"), *m_BackBufferFilePath);
-        return false;
+        levels.SetFromSingleQualityLevel(0);
+        levels.ResolutionQuality = 50.0f;
     }
-    m_BackBufferData.Reset();
-    return true;
+    else if (quality == skybox::QualityPreset::Final)
+    {
+        levels.SetFromSingleQualityLevel(4);  //Cinematic
+        levels.ResolutionQuality = 100.0f;
+    }
+    Scalability::SetQualityLevels(levels);
 }
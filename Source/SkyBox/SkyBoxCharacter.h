@@ -4,10 +4,14 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
+#include "Scalability.h"
+#include "Templates/Atomic.h"
 #include "SkyBoxCharacter.generated.h"
 
 class UInputComponent;
+class SkyBoxCaptureRig;
 class SkyBoxJob;
+class SkyBoxLevelPool;
 
 UCLASS(config=Game)
 class ASkyBoxCharacter : public ACharacter
@@ -50,6 +54,60 @@ class ASkyBoxCharacter : public ACharacter
     UPROPERTY(EditAnywhere)
     AActor* SBCamera;
 
+    UPROPERTY(EditAnywhere)
+    bool HDRCapture;  //用float16的SceneCapture采集tonemap之前的场景颜色，代替HighResShot
+
+    UPROPERTY(EditAnywhere)
+    bool HDRWriteEXR;  //HDR模式下写half float的EXR，否则写RGBE(.hdr)
+
+    UPROPERTY(EditAnywhere)
+    int32 TiledFaceSize;  //大于0时作为请求没指定分辨率时的面尺寸；超过SkyBoxCaptureRig::MaxUntiledFaceSize的面分块采集，边采集边按行写盘
+
+    UPROPERTY(EditAnywhere)
+    int32 TileSize;  //分块采集时每块的尺寸
+
+    UPROPERTY(EditAnywhere)
+    int32 CaptureRigCount;  //同一个world里同时采集的rig数，GPU没跑满时加大
+
+    UPROPERTY(EditAnywhere)
+    float SettleTimeout;  //秒，移动相机后等场景稳定（流送完、TAA和曝光收敛）的上限
+
+    UPROPERTY(EditAnywhere)
+    float StageTimeout;  //秒，截图回调、HDR读回超过这么久没回来就重采这个面
+
+    UPROPERTY(EditAnywhere)
+    int32 MaxFaceRetries;  //一个面最多重采几次
+
+    UPROPERTY(EditAnywhere)
+    int32 LookaheadCount;  //提前流送队列里接下来几个位置，0表示不预流送
+
+    UPROPERTY(EditAnywhere)
+    TArray<FVector> WarmupPositions;  //启动预热时渲染的代表位置，空时用出生点
+
+    UPROPERTY(EditAnywhere)
+    TArray<FName> SceneLevels;  //scene_id对应的流送子关卡名，空名字表示只用持久关卡；不填时只有scene 0
+
+    UPROPERTY(EditAnywhere)
+    int32 ResidentSceneCount;  //同时保持加载的场景数，切回这些场景只改可见性
+
+    UPROPERTY(EditAnywhere)
+    int32 MaxQueueDepth;  //排队任务数上限，超过的请求返回RESOURCE_EXHAUSTED，0表示不限
+
+    UPROPERTY(EditAnywhere)
+    int32 MaxClientInFlight;  //每个客户端还没完成的任务数上限，0表示不限
+
+    UPROPERTY(EditAnywhere)
+    TMap<FString, float> ClientWeights;  //客户端（x-skybox-client）的调度权重，没配的是1；运行时可以用SetClientWeight改
+
+    UPROPERTY(EditAnywhere)
+    bool CaptureServerMode;  //采集服务器模式，关掉HUD、第一人称模型、物理、声音和输入，固定步长；命令行-SkyBoxCaptureServer也可以打开
+
+    UPROPERTY(EditAnywhere)
+    bool SyntheticCapture;  //不渲染，用程序化生成的画面压测调度、编码和写盘；命令行-SkyBoxSynthetic也可以打开
+
+    UPROPERTY(EditAnywhere)
+    float SyntheticRenderLatency;  //秒，合成画面时模拟的每个面的渲染时间
+
     ACameraActor* m_capture_camera;
 
 public:
@@ -149,27 +207,32 @@ public:
 public:
     virtual void Tick(float DeltaSeconds) override;
     virtual bool ShouldTickIfViewportsOnly() const override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+    SkyBoxJob* AcquireJob();  //给rig取任务用
 private:
     void OnBackBufferReady_RenderThread(SWindow& SlateWindow, const FTexture2DRHIRef& BackBuffer);
     void OnScreenshotProcessed_RenderThread();
-    void CaptureBackBufferToPNG(const FTexture2DRHIRef& BackBuffer);
-    bool SavePNGToFile();
-    TArray<FRotator> m_SixDirection;
-    enum CaptureState
-    {
-        Invalid = 0,
-        Waiting1,
-        Prepared,
-        Captured,
-        Saved,
-    };
+    void ApplyQualityPreset(int32 quality);
+    void PrestreamUpcoming();
+    bool IsCaptureServerMode() const;
+    bool IsSyntheticCapture() const;
+    FString GetOutputDir() const;
+    void EnterCaptureServerMode();
+    void ExitCaptureServerMode();  //固定步长、限帧这些是进程全局的，EndPlay时还原，不然编辑器PIE结束后还是固定步长
+    bool IsRendererWarm() const;
+    void UpdateServingStatus();
     FCriticalSection m_lock;
-    SkyBoxJob* m_current_job;
-    int32 m_CurrentDirection;
-    CaptureState m_CurrentState;
-    TArray<FColor> m_BackBufferData;
-    uint32 m_BackBufferSizeX;
-    uint32 m_BackBufferSizeY;
-    FString m_BackBufferFilePath;
+    TArray<SkyBoxCaptureRig*> m_rigs;
+    TAtomic<SkyBoxCaptureRig*> m_ViewportRig;  //ViewTarget那套rig，渲染线程的回调只读这个；没有时为NULL
+    SkyBoxLevelPool* m_LevelPool;
+    int32 m_AppliedQuality;  //skybox::QualityPreset
+    Scalability::FQualityLevels m_DefaultQualityLevels;  //Standard档用启动时的设置
+    bool m_Serving;  //已经对外报SERVING，之前不取任务
+    bool m_InCaptureServerMode;
+    bool m_SavedUseFixedTimeStep;  //进入采集服务器模式之前的全局设置
+    double m_SavedFixedDeltaTime;
+    bool m_SavedSmoothFrameRate;
+    bool m_SavedSimulatePhysics;
+    bool m_SavedAllowAudioPlayback;
 };
 
@@ -13,8 +13,10 @@ ASkyBoxGameMode::ASkyBoxGameMode()
 	static ConstructorHelpers::FClassFinder<APawn> PlayerPawnClassFinder(TEXT("/Game/FirstPersonCPP/Blueprints/FirstPersonCharacter"));
 	DefaultPawnClass = PlayerPawnClassFinder.Class;
 
+#if !SKYBOX_CAPTURE_SERVER
 	// use our custom HUD class
 	HUDClass = ASkyBoxHUD::StaticClass();
+#endif
 }
 
 ASkyBoxGameMode::~ASkyBoxGameMode()
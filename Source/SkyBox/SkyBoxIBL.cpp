@@ -0,0 +1,535 @@
+#include "SkyBoxIBL.h"
+#include "CoreMinimal.h"
+#include "Misc/Paths.h"
+#include "Async/ParallelFor.h"
+#include "Modules/ModuleManager.h"
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
+#include <FileHelper.h>
+
+
+void SkyBoxCubemap::Init(int32 size, float fov, const TArray<FRotator>& directions)
+{
+    check(directions.Num() == 6);
+    m_size = size;
+    m_tan_half_fov = FMath::Tan(FMath::DegreesToRadians(fov * 0.5f));
+    for (int32 face = 0; face < 6; ++face)
+    {
+        FRotationMatrix basis(directions[face]);
+        m_forward[face] = basis.GetScaledAxis(EAxis::X);
+        m_right[face] = basis.GetScaledAxis(EAxis::Y);
+        m_up[face] = basis.GetScaledAxis(EAxis::Z);
+        m_faces[face].SetNumZeroed(size * size);
+    }
+}
+
+FVector SkyBoxCubemap::TexelDirection(int32 face, float x, float y) const
+{
+    //x、y是面内的像素坐标，像素中心在+0.5处；图片的y向下，所以up取反
+    float u = (2.0f * x / m_size - 1.0f) * m_tan_half_fov;
+    float v = (2.0f * y / m_size - 1.0f) * m_tan_half_fov;
+    return (m_forward[face] + m_right[face] * u - m_up[face] * v).GetUnsafeNormal();
+}
+
+VectorRegister SkyBoxCubemap::Sample(const FVector& dir) const
+{
+    int32 face = 0;
+    float forward = FVector::DotProduct(dir, m_forward[0]);
+    for (int32 i = 1; i < 6; ++i)
+    {
+        float d = FVector::DotProduct(dir, m_forward[i]);
+        if (d > forward)
+        {
+            forward = d;
+            face = i;
+        }
+    }
+    float scale = 0.5f / (forward * m_tan_half_fov);
+    float u = FVector::DotProduct(dir, m_right[face]) * scale + 0.5f;
+    float v = -FVector::DotProduct(dir, m_up[face]) * scale + 0.5f;
+    float x = FMath::Clamp(u * m_size - 0.5f, 0.0f, (float)(m_size - 1));
+    float y = FMath::Clamp(v * m_size - 0.5f, 0.0f, (float)(m_size - 1));
+    int32 x0 = (int32)x;
+    int32 y0 = (int32)y;
+    int32 x1 = FMath::Min(x0 + 1, m_size - 1);
+    int32 y1 = FMath::Min(y0 + 1, m_size - 1);
+    float fx = x - x0;
+    float fy = y - y0;
+
+    const FLinearColor* texels = m_faces[face].GetData();
+    VectorRegister c00 = VectorLoad(&texels[y0 * m_size + x0].R);
+    VectorRegister c10 = VectorLoad(&texels[y0 * m_size + x1].R);
+    VectorRegister c01 = VectorLoad(&texels[y1 * m_size + x0].R);
+    VectorRegister c11 = VectorLoad(&texels[y1 * m_size + x1].R);
+    VectorRegister result = VectorMultiply(c00, VectorSetFloat1((1.0f - fx) * (1.0f - fy)));
+    result = VectorMultiplyAdd(c10, VectorSetFloat1(fx * (1.0f - fy)), result);
+    result = VectorMultiplyAdd(c01, VectorSetFloat1((1.0f - fx) * fy), result);
+    result = VectorMultiplyAdd(c11, VectorSetFloat1(fx * fy), result);
+    return result;
+}
+
+
+SkyBoxBakeResult SkyBoxIBL::Bake(const TArray<FString>& face_files, const TArray<FRotator>& directions, float capture_fov, const FString& output_prefix, SkyBoxImageFormat format, bool sh_only)
+{
+    UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！SkyBoxIBL::Bake(), %s"), *output_prefix);
+    double start_time = FPlatformTime::Seconds();
+    SkyBoxBakeResult result;
+
+    SkyBoxCubemap captured;
+    if (!LoadFaces(face_files, directions, capture_fov, captured))
+        return result;
+
+    //先重采样成90度的立方体，再生成mip链，供过滤时按采样密度选mip
+    TArray<SkyBoxCubemap> source;
+    source.AddDefaulted(1);
+    source[0].Init(SourceSize, 90.0f, directions);
+    Resample(captured, source[0]);
+    BuildMipChain(source);
+
+    //球谐只需要低频，用64的mip投影就够了
+    for (const SkyBoxCubemap& mip : source)
+    {
+        if (mip.m_size <= SHSourceSize)
+        {
+            ProjectSH(mip, result.m_sh_coefficients);
+            break;
+        }
+    }
+    if (sh_only)
+    {
+        result.m_success = result.m_sh_coefficients.Num() > 0;
+        return result;
+    }
+
+    TArray<SkyBoxCubemap> specular;
+    specular.AddDefaulted(SpecularMipCount);
+    for (int32 level = 0; level < SpecularMipCount; ++level)
+        specular[level].Init(FMath::Max(SpecularSize >> level, 1), 90.0f, directions);
+    SkyBoxCubemap irradiance;
+    irradiance.Init(IrradianceSize, 90.0f, directions);
+    Prefilter(source, specular, irradiance);
+
+    for (int32 level = 0; level < SpecularMipCount; ++level)
+    {
+        if (!SaveCubemap(specular[level], FString::Printf(TEXT("%s_Specular_Mip%d"), *output_prefix, level), format))
+            return result;
+    }
+    if (!SaveCubemap(irradiance, FString::Printf(TEXT("%s_Irradiance"), *output_prefix), format))
+        return result;
+
+    UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！SkyBoxIBL::Bake() done, %.3f seconds"), FPlatformTime::Seconds() - start_time);
+    result.m_success = true;
+    return result;
+}
+
+void SkyBoxIBL::ProjectSH(const SkyBoxCubemap& cube, TArray<float>& sh_coefficients)
+{
+    //每行先各自累加到9个寄存器里，最后再归并，行之间没有共享写
+    const int32 size = cube.m_size;
+    TArray<FLinearColor> row_sums;
+    TArray<float> row_weights;
+    row_sums.SetNumZeroed(6 * size * SHCoefficientCount);
+    row_weights.SetNumZeroed(6 * size);
+    ParallelFor(6 * size, [&](int32 index)
+    {
+        int32 face = index / size;
+        int32 y = index % size;
+        const FLinearColor* row = &cube.m_faces[face][y * size];
+        VectorRegister sum[SHCoefficientCount];
+        for (int32 i = 0; i < SHCoefficientCount; ++i)
+            sum[i] = VectorZero();
+        float weight_sum = 0.0f;
+        float v = (2.0f * (y + 0.5f) / size - 1.0f) * cube.m_tan_half_fov;
+        for (int32 x = 0; x < size; ++x)
+        {
+            float u = (2.0f * (x + 0.5f) / size - 1.0f) * cube.m_tan_half_fov;
+            float t = 1.0f + u * u + v * v;
+            float solid_angle = 1.0f / (t * FMath::Sqrt(t));  //乘上常数(2/size)^2，归一化时会约掉
+            FVector d = cube.TexelDirection(face, x + 0.5f, y + 0.5f);
+            float basis[SHCoefficientCount] =
+            {
+                0.282095f,
+                0.488603f * d.Y,
+                0.488603f * d.Z,
+                0.488603f * d.X,
+                1.092548f * d.X * d.Y,
+                1.092548f * d.Y * d.Z,
+                0.315392f * (3.0f * d.Z * d.Z - 1.0f),
+                1.092548f * d.X * d.Z,
+                0.546274f * (d.X * d.X - d.Y * d.Y),
+            };
+            VectorRegister color = VectorMultiply(VectorLoad(&row[x].R), VectorSetFloat1(solid_angle));
+            for (int32 i = 0; i < SHCoefficientCount; ++i)
+                sum[i] = VectorMultiplyAdd(color, VectorSetFloat1(basis[i]), sum[i]);
+            weight_sum += solid_angle;
+        }
+        for (int32 i = 0; i < SHCoefficientCount; ++i)
+            VectorStore(sum[i], &row_sums[index * SHCoefficientCount + i].R);
+        row_weights[index] = weight_sum;
+    });
+
+    FLinearColor total[SHCoefficientCount];
+    for (int32 i = 0; i < SHCoefficientCount; ++i)
+        total[i] = FLinearColor(0.0f, 0.0f, 0.0f, 0.0f);
+    float total_weight = 0.0f;
+    for (int32 index = 0; index < 6 * size; ++index)
+    {
+        for (int32 i = 0; i < SHCoefficientCount; ++i)
+            total[i] += row_sums[index * SHCoefficientCount + i];
+        total_weight += row_weights[index];
+    }
+    //立体角之和应为4PI，用实际的和归一化，抵消离散误差
+    float scale = 4.0f * PI / total_weight;
+    sh_coefficients.Reset(SHCoefficientCount * 3);
+    for (int32 i = 0; i < SHCoefficientCount; ++i)
+    {
+        sh_coefficients.Add(total[i].R * scale);
+        sh_coefficients.Add(total[i].G * scale);
+        sh_coefficients.Add(total[i].B * scale);
+    }
+}
+
+bool SkyBoxIBL::LoadFace(const FString& file_path, int32& width, int32& height, TArray<FLinearColor>& pixels)
+{
+    FString extension = FPaths::GetExtension(file_path).ToLower();
+    if (extension == TEXT("hdr"))
+        return SkyBoxImageReader::ReadRGBE(file_path, width, height, pixels);
+
+    TArray<uint8> compressed;
+    if (!FFileHelper::LoadFileToArray(compressed, *file_path))
+        return false;
+    bool is_exr = (extension == TEXT("exr"));
+    IImageWrapperModule& image_wrapper_module = FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
+    TSharedPtr<IImageWrapper> image_wrapper = image_wrapper_module.CreateImageWrapper(is_exr ? EImageFormat::EXR : EImageFormat::PNG);
+    const TArray<uint8>* raw = NULL;
+    if (!image_wrapper.IsValid() || !image_wrapper->SetCompressed(compressed.GetData(), compressed.Num()))
+        return false;
+    if (!image_wrapper->GetRaw(is_exr ? ERGBFormat::RGBA : ERGBFormat::BGRA, is_exr ? 16 : 8, raw) || raw == NULL)
+        return false;
+    width = image_wrapper->GetWidth();
+    height = image_wrapper->GetHeight();
+    pixels.SetNumUninitialized(width * height);
+    if (is_exr)
+    {
+        //EXR本身就是线性的half float
+        const FFloat16Color* colors = reinterpret_cast<const FFloat16Color*>(raw->GetData());
+        for (int32 i = 0; i < width * height; ++i)
+            pixels[i] = FLinearColor(colors[i]);
+    }
+    else
+    {
+        //BGRA8和FColor的内存布局一致，PNG是sRGB，转成线性空间再过滤
+        const FColor* colors = reinterpret_cast<const FColor*>(raw->GetData());
+        for (int32 i = 0; i < width * height; ++i)
+            pixels[i] = FLinearColor(colors[i]);
+    }
+    return true;
+}
+
+bool SkyBoxIBL::LoadFaces(const TArray<FString>& face_files, const TArray<FRotator>& directions, float capture_fov, SkyBoxCubemap& cube)
+{
+    if (face_files.Num() != 6 || directions.Num() != 6)
+        return false;
+    for (int32 face = 0; face < 6; ++face)
+    {
+        int32 width = 0;
+        int32 height = 0;
+        TArray<FLinearColor> pixels;
+        if (!LoadFace(face_files[face], width, height, pixels))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！SkyBoxIBL::LoadFaces() FAIL %s"), *face_files[face]);
+            return false;
+        }
+        //8K、16K的面读进来先box下采样，六个面同时在内存里也不会太大
+        if (width == height)
+        {
+            int32 factor = 1;
+            while (width / factor > MaxFaceSize && width % (factor * 2) == 0)
+                factor *= 2;
+            if (factor > 1)
+            {
+                Downsample(pixels, width, factor);
+                width /= factor;
+                height = width;
+            }
+        }
+        if (width != height || (face > 0 && width != cube.m_size))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！SkyBoxIBL::LoadFaces() BAD SIZE %s (%dX%d)"), *face_files[face], width, height);
+            return false;
+        }
+        if (face == 0)
+            cube.Init(width, capture_fov, directions);
+        cube.m_faces[face] = MoveTemp(pixels);
+    }
+    return true;
+}
+
+void SkyBoxIBL::Downsample(TArray<FLinearColor>& pixels, int32 size, int32 factor)
+{
+    const int32 dst_size = size / factor;
+    const float weight = 1.0f / (factor * factor);
+    TArray<FLinearColor> dst;
+    dst.SetNumUninitialized(dst_size * dst_size);
+    ParallelFor(dst_size, [&](int32 y)
+    {
+        for (int32 x = 0; x < dst_size; ++x)
+        {
+            VectorRegister sum = VectorZero();
+            for (int32 sy = 0; sy < factor; ++sy)
+            {
+                const FLinearColor* src = &pixels[(y * factor + sy) * size + x * factor];
+                for (int32 sx = 0; sx < factor; ++sx)
+                    sum = VectorAdd(sum, VectorLoad(&src[sx].R));
+            }
+            VectorStore(VectorMultiply(sum, VectorSetFloat1(weight)), &dst[y * dst_size + x].R);
+        }
+    });
+    pixels = MoveTemp(dst);
+}
+
+void SkyBoxIBL::Resample(const SkyBoxCubemap& src, SkyBoxCubemap& dst)
+{
+    //采集的面比目标大很多，每个像素3x3超采样，避免走样
+    const int32 super_sample = 3;
+    const float weight = 1.0f / (super_sample * super_sample);
+    const int32 size = dst.m_size;
+    ParallelFor(6 * size, [&](int32 index)
+    {
+        int32 face = index / size;
+        int32 y = index % size;
+        FLinearColor* row = &dst.m_faces[face][y * size];
+        for (int32 x = 0; x < size; ++x)
+        {
+            VectorRegister sum = VectorZero();
+            for (int32 sy = 0; sy < super_sample; ++sy)
+            {
+                for (int32 sx = 0; sx < super_sample; ++sx)
+                {
+                    FVector dir = dst.TexelDirection(face, x + (sx + 0.5f) / super_sample, y + (sy + 0.5f) / super_sample);
+                    sum = VectorAdd(sum, src.Sample(dir));
+                }
+            }
+            VectorStore(VectorMultiply(sum, VectorSetFloat1(weight)), &row[x].R);
+        }
+    });
+}
+
+void SkyBoxIBL::BuildMipChain(TArray<SkyBoxCubemap>& chain)
+{
+    while (chain.Last().m_size > 1)
+    {
+        int32 size = chain.Last().m_size / 2;
+        SkyBoxCubemap& mip = chain[chain.AddDefaulted()];
+        const SkyBoxCubemap& parent = chain[chain.Num() - 2];
+        mip.m_size = size;
+        mip.m_tan_half_fov = parent.m_tan_half_fov;
+        for (int32 face = 0; face < 6; ++face)
+        {
+            mip.m_forward[face] = parent.m_forward[face];
+            mip.m_right[face] = parent.m_right[face];
+            mip.m_up[face] = parent.m_up[face];
+            mip.m_faces[face].SetNumZeroed(size * size);
+        }
+        ParallelFor(6, [&](int32 face)
+        {
+            const FLinearColor* src = parent.m_faces[face].GetData();
+            FLinearColor* dst = mip.m_faces[face].GetData();
+            int32 src_size = parent.m_size;
+            for (int32 y = 0; y < size; ++y)
+            {
+                for (int32 x = 0; x < size; ++x)
+                {
+                    const FLinearColor* p = &src[(y * 2) * src_size + x * 2];
+                    VectorRegister sum = VectorAdd(VectorLoad(&p[0].R), VectorLoad(&p[1].R));
+                    sum = VectorAdd(sum, VectorLoad(&p[src_size].R));
+                    sum = VectorAdd(sum, VectorLoad(&p[src_size + 1].R));
+                    VectorStore(VectorMultiply(sum, VectorSetFloat1(0.25f)), &dst[y * size + x].R);
+                }
+            }
+        });
+    }
+}
+
+static FVector2D Hammersley(uint32 index, uint32 count)
+{
+    uint32 bits = index;
+    bits = (bits << 16u) | (bits >> 16u);
+    bits = ((bits & 0x55555555u) << 1u) | ((bits & 0xAAAAAAAAu) >> 1u);
+    bits = ((bits & 0x33333333u) << 2u) | ((bits & 0xCCCCCCCCu) >> 2u);
+    bits = ((bits & 0x0F0F0F0Fu) << 4u) | ((bits & 0xF0F0F0F0u) >> 4u);
+    bits = ((bits & 0x00FF00FFu) << 8u) | ((bits & 0xFF00FF00u) >> 8u);
+    return FVector2D((float)index / (float)count, (float)bits * 2.3283064365386963e-10f);
+}
+
+static float SolidAngleLod(float pdf, int32 sample_count)
+{
+    //按采样点覆盖的立体角和源立方体一个像素的立体角之比选mip
+    float texel_solid_angle = 4.0f * PI / (6.0f * SkyBoxIBL::SourceSize * SkyBoxIBL::SourceSize);
+    float sample_solid_angle = 1.0f / (sample_count * pdf + 0.0001f);
+    return FMath::Max(0.5f * FMath::Log2(sample_solid_angle / texel_solid_angle) + 1.0f, 0.0f);
+}
+
+void SkyBoxIBL::BuildSpecularKernel(float roughness, TArray<KernelSample>& kernel)
+{
+    kernel.Reset();
+    if (roughness <= 0.0f)
+    {
+        KernelSample sample;
+        sample.m_direction = FVector(0.0f, 0.0f, 1.0f);
+        sample.m_weight = 1.0f;
+        sample.m_lod = 0.0f;
+        kernel.Add(sample);
+        return;
+    }
+    //N=V=R的近似下，每个像素的采样方向在切线空间里都一样，预先算好
+    float a = roughness * roughness;
+    float a2 = a * a;
+    float total_weight = 0.0f;
+    for (int32 i = 0; i < SpecularSampleCount; ++i)
+    {
+        FVector2D xi = Hammersley(i, SpecularSampleCount);
+        float phi = 2.0f * PI * xi.X;
+        float cos_theta = FMath::Sqrt((1.0f - xi.Y) / (1.0f + (a2 - 1.0f) * xi.Y));
+        float sin_theta = FMath::Sqrt(1.0f - cos_theta * cos_theta);
+        FVector h(sin_theta * FMath::Cos(phi), sin_theta * FMath::Sin(phi), cos_theta);
+        FVector l = 2.0f * cos_theta * h - FVector(0.0f, 0.0f, 1.0f);
+        if (l.Z <= 0.0f)
+            continue;
+        float d = (cos_theta * a2 - cos_theta) * cos_theta + 1.0f;
+        float pdf = a2 / (PI * d * d) * 0.25f;
+        KernelSample sample;
+        sample.m_direction = l;
+        sample.m_weight = l.Z;
+        sample.m_lod = SolidAngleLod(pdf, SpecularSampleCount);
+        kernel.Add(sample);
+        total_weight += l.Z;
+    }
+    for (KernelSample& sample : kernel)
+        sample.m_weight /= total_weight;
+}
+
+void SkyBoxIBL::BuildIrradianceKernel(TArray<KernelSample>& kernel)
+{
+    //余弦加权采样，结果是辐照度除以PI，即albedo为1的漫反射出射亮度
+    kernel.Reset();
+    for (int32 i = 0; i < IrradianceSampleCount; ++i)
+    {
+        FVector2D xi = Hammersley(i, IrradianceSampleCount);
+        float phi = 2.0f * PI * xi.X;
+        float cos_theta = FMath::Sqrt(1.0f - xi.Y);
+        float sin_theta = FMath::Sqrt(xi.Y);
+        KernelSample sample;
+        sample.m_direction = FVector(sin_theta * FMath::Cos(phi), sin_theta * FMath::Sin(phi), cos_theta);
+        sample.m_weight = 1.0f / IrradianceSampleCount;
+        sample.m_lod = SolidAngleLod(cos_theta / PI, IrradianceSampleCount);
+        kernel.Add(sample);
+    }
+}
+
+VectorRegister SkyBoxIBL::SampleLod(const TArray<SkyBoxCubemap>& source, const FVector& dir, float lod)
+{
+    lod = FMath::Clamp(lod, 0.0f, (float)(source.Num() - 1));
+    int32 lod0 = (int32)lod;
+    float f = lod - lod0;
+    VectorRegister result = source[lod0].Sample(dir);
+    if (f > 0.0f && lod0 + 1 < source.Num())
+        result = VectorMultiplyAdd(VectorSubtract(source[lod0 + 1].Sample(dir), result), VectorSetFloat1(f), result);
+    return result;
+}
+
+void SkyBoxIBL::Prefilter(const TArray<SkyBoxCubemap>& source, TArray<SkyBoxCubemap>& specular, SkyBoxCubemap& irradiance)
+{
+    //最后一级是辐照度图，其余是高光mip，粗糙度按mip线性分布
+    int32 level_count = specular.Num() + 1;
+    TArray<TArray<KernelSample>> kernels;
+    TArray<SkyBoxCubemap*> targets;
+    kernels.SetNum(level_count);
+    for (int32 level = 0; level < specular.Num(); ++level)
+    {
+        float roughness = specular.Num() > 1 ? (float)level / (specular.Num() - 1) : 0.0f;
+        BuildSpecularKernel(roughness, kernels[level]);
+        targets.Add(&specular[level]);
+    }
+    BuildIrradianceKernel(kernels[level_count - 1]);
+    targets.Add(&irradiance);
+
+    //每个采样至少落在和目标像素同样大小的源mip上
+    TArray<float> min_lods;
+    for (int32 level = 0; level < level_count; ++level)
+        min_lods.Add(FMath::Log2((float)SourceSize / targets[level]->m_size));
+
+    //按（级别，面，16行）切分任务，所有面和mip一起并行
+    struct WorkItem
+    {
+        int32 level;
+        int32 face;
+        int32 row_begin;
+        int32 row_end;
+    };
+    const int32 rows_per_item = 16;
+    TArray<WorkItem> items;
+    for (int32 level = 0; level < level_count; ++level)
+    {
+        int32 size = targets[level]->m_size;
+        for (int32 face = 0; face < 6; ++face)
+        {
+            for (int32 row = 0; row < size; row += rows_per_item)
+                items.Add({ level, face, row, FMath::Min(row + rows_per_item, size) });
+        }
+    }
+
+    ParallelFor(items.Num(), [&](int32 index)
+    {
+        const WorkItem& item = items[index];
+        SkyBoxCubemap& target = *targets[item.level];
+        const TArray<KernelSample>& kernel = kernels[item.level];
+        float min_lod = min_lods[item.level];
+        int32 size = target.m_size;
+        for (int32 y = item.row_begin; y < item.row_end; ++y)
+        {
+            FLinearColor* row = &target.m_faces[item.face][y * size];
+            for (int32 x = 0; x < size; ++x)
+            {
+                FVector n = target.TexelDirection(item.face, x + 0.5f, y + 0.5f);
+                FVector up = FMath::Abs(n.Z) < 0.999f ? FVector(0.0f, 0.0f, 1.0f) : FVector(1.0f, 0.0f, 0.0f);
+                FVector tangent_x = FVector::CrossProduct(up, n).GetUnsafeNormal();
+                FVector tangent_y = FVector::CrossProduct(n, tangent_x);
+                VectorRegister sum = VectorZero();
+                for (const KernelSample& sample : kernel)
+                {
+                    FVector l = tangent_x * sample.m_direction.X + tangent_y * sample.m_direction.Y + n * sample.m_direction.Z;
+                    sum = VectorMultiplyAdd(SampleLod(source, l, FMath::Max(sample.m_lod, min_lod)), VectorSetFloat1(sample.m_weight), sum);
+                }
+                VectorStore(sum, &row[x].R);
+            }
+        }
+    });
+}
+
+bool SkyBoxIBL::SaveCubemap(const SkyBoxCubemap& cube, const FString& prefix, SkyBoxImageFormat format)
+{
+    for (int32 face = 0; face < 6; ++face)
+    {
+        FString file_path = FString::Printf(TEXT("%s_%d.%s"), *prefix, face, SkyBoxImageWriter::GetExtension(format));
+        const FLinearColor* texels = cube.m_faces[face].GetData();
+        //逐行转成half写出，PNG由writer转成sRGB
+        TUniquePtr<SkyBoxImageWriter> writer(SkyBoxImageWriter::Create(format));
+        TArray<FFloat16Color> row;
+        row.SetNumUninitialized(cube.m_size);
+        bool ok = writer->Open(file_path, cube.m_size, cube.m_size);
+        for (int32 y = 0; ok && y < cube.m_size; ++y)
+        {
+            for (int32 x = 0; x < cube.m_size; ++x)
+                row[x] = FFloat16Color(texels[y * cube.m_size + x]);
+            ok = writer->WriteRows(row.GetData(), 1);
+        }
+        ok = writer->Close() && ok;
+        if (!ok)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！SkyBoxIBL::SaveCubemap() FAIL %s"), *file_path);
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Math/VectorRegister.h"
+#include "SkyBoxImageIO.h"
+
+
+//立方体贴图，六个面的朝向和采集时的六个方向一一对应
+struct SkyBoxCubemap
+{
+    void Init(int32 size, float fov, const TArray<FRotator>& directions);
+    FVector TexelDirection(int32 face, float x, float y) const;
+    VectorRegister Sample(const FVector& dir) const;
+public:
+    int32 m_size;
+    float m_tan_half_fov;  //采集的面不一定是90度，查找时按实际FOV投影
+    FVector m_forward[6];
+    FVector m_right[6];
+    FVector m_up[6];
+    TArray<FLinearColor> m_faces[6];
+};
+
+
+struct SkyBoxBakeResult
+{
+    SkyBoxBakeResult() : m_success(false) {}
+    bool m_success;
+    TArray<float> m_sh_coefficients;  //L2球谐，9个系数 x RGB，按 r0 g0 b0 r1 ... 排列
+};
+
+
+class SkyBoxIBL
+{
+public:
+    //读取六个面，生成GGX预过滤的高光mip链和漫反射辐照度图，结果按output_prefix和format保存；同时投影出L2球谐系数
+    //sh_only时只投影球谐，不过滤也不写文件
+    static SkyBoxBakeResult Bake(const TArray<FString>& face_files, const TArray<FRotator>& directions, float capture_fov, const FString& output_prefix, SkyBoxImageFormat format, bool sh_only);
+    static void ProjectSH(const SkyBoxCubemap& cube, TArray<float>& sh_coefficients);
+public:
+    static const int32 SHCoefficientCount = 9;
+    static const int32 SHSourceSize = 64;
+    static const int32 MaxFaceSize = 2048;  //读入的面超过这个尺寸先下采样
+    static const int32 SourceSize = 512;
+    static const int32 SpecularSize = 256;
+    static const int32 SpecularMipCount = 6;
+    static const int32 SpecularSampleCount = 128;
+    static const int32 IrradianceSize = 32;
+    static const int32 IrradianceSampleCount = 256;
+private:
+    friend class SkyBoxIBLTest;  //自动化测试检查过滤核
+    struct KernelSample
+    {
+        FVector m_direction;  //切线空间
+        float m_weight;
+        float m_lod;
+    };
+    static bool LoadFace(const FString& file_path, int32& width, int32& height, TArray<FLinearColor>& pixels);
+    static bool LoadFaces(const TArray<FString>& face_files, const TArray<FRotator>& directions, float capture_fov, SkyBoxCubemap& cube);
+    static void Downsample(TArray<FLinearColor>& pixels, int32 size, int32 factor);
+    static void Resample(const SkyBoxCubemap& src, SkyBoxCubemap& dst);
+    static void BuildMipChain(TArray<SkyBoxCubemap>& chain);
+    static void BuildSpecularKernel(float roughness, TArray<KernelSample>& kernel);
+    static void BuildIrradianceKernel(TArray<KernelSample>& kernel);
+    static void Prefilter(const TArray<SkyBoxCubemap>& source, TArray<SkyBoxCubemap>& specular, SkyBoxCubemap& irradiance);
+    static VectorRegister SampleLod(const TArray<SkyBoxCubemap>& source, const FVector& dir, float lod);
+    static bool SaveCubemap(const SkyBoxCubemap& cube, const FString& prefix, SkyBoxImageFormat format);
+};
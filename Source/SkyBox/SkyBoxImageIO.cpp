@@ -0,0 +1,511 @@
+#include "SkyBoxImageIO.h"
+#include "CoreMinimal.h"
+#include "HAL/FileManager.h"
+#include <FileHelper.h>
+#include <cmath>
+
+THIRD_PARTY_INCLUDES_START
+#include "zlib.h"
+THIRD_PARTY_INCLUDES_END
+
+
+//PNG，8位RGB，sRGB编码；每行压缩完就按IDAT块写出，不需要整张图
+class SkyBoxPNGWriter : public SkyBoxImageWriter
+{
+public:
+    SkyBoxPNGWriter();
+    virtual ~SkyBoxPNGWriter();
+protected:
+    virtual bool WriteHeader() override;
+    virtual bool WriteRow(const FFloat16Color* row) override;
+    virtual bool WriteFooter() override;
+private:
+    bool WriteChunk(const char* type, const uint8* data, int32 size);
+    bool Deflate(const uint8* data, int32 size, int flush);
+    z_stream m_stream;
+    bool m_deflating;
+    TArray<uint8> m_raw;
+    TArray<uint8> m_filtered;  //filter类型字节 + 一行RGB
+    TArray<uint8> m_compressed;
+};
+
+static void StoreBigEndian(uint8* dst, uint32 value)
+{
+    dst[0] = (uint8)(value >> 24);
+    dst[1] = (uint8)(value >> 16);
+    dst[2] = (uint8)(value >> 8);
+    dst[3] = (uint8)value;
+}
+
+SkyBoxPNGWriter::SkyBoxPNGWriter()
+{
+    FMemory::Memzero(&m_stream, sizeof(m_stream));
+    m_deflating = false;
+}
+
+SkyBoxPNGWriter::~SkyBoxPNGWriter()
+{
+    if (m_deflating)
+        deflateEnd(&m_stream);
+}
+
+bool SkyBoxPNGWriter::WriteHeader()
+{
+    static const uint8 signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+    uint8 ihdr[13];
+    StoreBigEndian(ihdr, m_width);
+    StoreBigEndian(ihdr + 4, m_height);
+    ihdr[8] = 8;  //bit depth
+    ihdr[9] = 2;  //RGB
+    ihdr[10] = 0;
+    ihdr[11] = 0;
+    ihdr[12] = 0;
+    if (!Write(signature, sizeof(signature)) || !WriteChunk("IHDR", ihdr, sizeof(ihdr)))
+        return false;
+    if (deflateInit(&m_stream, Z_DEFAULT_COMPRESSION) != Z_OK)
+        return false;
+    m_deflating = true;
+    m_raw.SetNumUninitialized(m_width * 3);
+    m_filtered.SetNumUninitialized(m_width * 3 + 1);
+    m_compressed.SetNumUninitialized(64 * 1024);
+    return true;
+}
+
+bool SkyBoxPNGWriter::WriteRow(const FFloat16Color* row)
+{
+    uint8* raw = m_raw.GetData();
+    for (int32 x = 0; x < m_width; ++x)
+    {
+        FColor color = FLinearColor(row[x]).ToFColor(true);
+        raw[x * 3] = color.R;
+        raw[x * 3 + 1] = color.G;
+        raw[x * 3 + 2] = color.B;
+    }
+    //Sub滤波，天空大面积渐变，比不滤波压得小很多
+    uint8* filtered = m_filtered.GetData();
+    filtered[0] = 1;
+    for (int32 i = 0; i < m_width * 3; ++i)
+        filtered[i + 1] = i < 3 ? raw[i] : (uint8)(raw[i] - raw[i - 3]);
+    return Deflate(filtered, m_filtered.Num(), Z_NO_FLUSH);
+}
+
+bool SkyBoxPNGWriter::WriteFooter()
+{
+    bool ok = Deflate(NULL, 0, Z_FINISH);
+    deflateEnd(&m_stream);
+    m_deflating = false;
+    return ok && WriteChunk("IEND", NULL, 0);
+}
+
+bool SkyBoxPNGWriter::Deflate(const uint8* data, int32 size, int flush)
+{
+    m_stream.next_in = const_cast<Bytef*>(data);
+    m_stream.avail_in = size;
+    do
+    {
+        m_stream.next_out = m_compressed.GetData();
+        m_stream.avail_out = m_compressed.Num();
+        if (deflate(&m_stream, flush) == Z_STREAM_ERROR)
+            return false;
+        int32 produced = m_compressed.Num() - m_stream.avail_out;
+        if (produced > 0 && !WriteChunk("IDAT", m_compressed.GetData(), produced))
+            return false;
+    } while (m_stream.avail_out == 0);
+    return true;
+}
+
+bool SkyBoxPNGWriter::WriteChunk(const char* type, const uint8* data, int32 size)
+{
+    uint8 length[4];
+    StoreBigEndian(length, size);
+    uLong crc = crc32(0L, reinterpret_cast<const Bytef*>(type), 4);
+    if (size > 0)
+        crc = crc32(crc, data, size);
+    uint8 crc_bytes[4];
+    StoreBigEndian(crc_bytes, (uint32)crc);
+    return Write(length, 4) && Write(type, 4) && (size == 0 || Write(data, size)) && Write(crc_bytes, 4);
+}
+
+
+//OpenEXR 2.0，单scanline一块，不压缩；块大小固定，offset表可以提前写好
+class SkyBoxEXRWriter : public SkyBoxImageWriter
+{
+protected:
+    virtual bool WriteHeader() override;
+    virtual bool WriteRow(const FFloat16Color* row) override;
+private:
+    void AppendString(const char* s);
+    void AppendInt32(int32 value);
+    void AppendFloat(float value);
+    void AppendAttribute(const char* name, const char* type, int32 size);
+    TArray<uint8> m_header;
+    TArray<uint16> m_row;
+};
+
+void SkyBoxEXRWriter::AppendString(const char* s)
+{
+    m_header.Append(reinterpret_cast<const uint8*>(s), FCStringAnsi::Strlen(s) + 1);
+}
+
+void SkyBoxEXRWriter::AppendInt32(int32 value)
+{
+    m_header.Append(reinterpret_cast<const uint8*>(&value), sizeof(value));
+}
+
+void SkyBoxEXRWriter::AppendFloat(float value)
+{
+    m_header.Append(reinterpret_cast<const uint8*>(&value), sizeof(value));
+}
+
+void SkyBoxEXRWriter::AppendAttribute(const char* name, const char* type, int32 size)
+{
+    AppendString(name);
+    AppendString(type);
+    AppendInt32(size);
+}
+
+bool SkyBoxEXRWriter::WriteHeader()
+{
+    m_header.Reset();
+    AppendInt32(20000630);  //magic
+    AppendInt32(2);  //version 2, single part scanline
+    //通道按名字排序：B G R，HALF=1
+    const char* channels[3] = { "B", "G", "R" };
+    AppendAttribute("channels", "chlist", 3 * 18 + 1);
+    for (int32 i = 0; i < 3; ++i)
+    {
+        AppendString(channels[i]);
+        AppendInt32(1);
+        AppendInt32(0);  //pLinear + reserved
+        AppendInt32(1);
+        AppendInt32(1);
+    }
+    m_header.Add(0);
+    AppendAttribute("compression", "compression", 1);
+    m_header.Add(0);
+    AppendAttribute("dataWindow", "box2i", 16);
+    AppendInt32(0);
+    AppendInt32(0);
+    AppendInt32(m_width - 1);
+    AppendInt32(m_height - 1);
+    AppendAttribute("displayWindow", "box2i", 16);
+    AppendInt32(0);
+    AppendInt32(0);
+    AppendInt32(m_width - 1);
+    AppendInt32(m_height - 1);
+    AppendAttribute("lineOrder", "lineOrder", 1);
+    m_header.Add(0);
+    AppendAttribute("pixelAspectRatio", "float", 4);
+    AppendFloat(1.0f);
+    AppendAttribute("screenWindowCenter", "v2f", 8);
+    AppendFloat(0.0f);
+    AppendFloat(0.0f);
+    AppendAttribute("screenWindowWidth", "float", 4);
+    AppendFloat(1.0f);
+    m_header.Add(0);
+
+    uint64 block_size = 8 + (uint64)m_width * 3 * sizeof(uint16);
+    uint64 offset = m_header.Num() + (uint64)m_height * sizeof(uint64);
+    for (int32 y = 0; y < m_height; ++y)
+    {
+        m_header.Append(reinterpret_cast<const uint8*>(&offset), sizeof(offset));
+        offset += block_size;
+    }
+    bool ok = Write(m_header.GetData(), m_header.Num());
+    m_header.Empty();
+    m_row.SetNumUninitialized(m_width * 3);
+    return ok;
+}
+
+bool SkyBoxEXRWriter::WriteRow(const FFloat16Color* row)
+{
+    uint16* b = m_row.GetData();
+    uint16* g = b + m_width;
+    uint16* r = g + m_width;
+    for (int32 x = 0; x < m_width; ++x)
+    {
+        b[x] = row[x].B.Encoded;
+        g[x] = row[x].G.Encoded;
+        r[x] = row[x].R.Encoded;
+    }
+    int32 block[2] = { m_rows_written, m_width * 3 * (int32)sizeof(uint16) };
+    return Write(block, sizeof(block)) && Write(m_row.GetData(), m_row.Num() * sizeof(uint16));
+}
+
+
+//Radiance RGBE，新式scanline RLE（每个分量单独游程编码）
+class SkyBoxRGBEWriter : public SkyBoxImageWriter
+{
+protected:
+    virtual bool WriteHeader() override;
+    virtual bool WriteRow(const FFloat16Color* row) override;
+private:
+    void EncodeChannel(const uint8* data);
+    TArray<uint8> m_rgbe;
+    TArray<uint8> m_encoded;
+};
+
+bool SkyBoxRGBEWriter::WriteHeader()
+{
+    FString header = FString::Printf(TEXT("#?RADIANCE\nFORMAT=32-bit_rle_rgbe\n\n-Y %d +X %d\n"), m_height, m_width);
+    FTCHARToUTF8 utf8(*header);
+    m_rgbe.SetNumUninitialized(m_width * 4);
+    m_encoded.Reserve(m_width * 5);
+    return Write(utf8.Get(), utf8.Length());
+}
+
+bool SkyBoxRGBEWriter::WriteRow(const FFloat16Color* row)
+{
+    for (int32 x = 0; x < m_width; ++x)
+    {
+        float r = row[x].R.GetFloat();
+        float g = row[x].G.GetFloat();
+        float b = row[x].B.GetFloat();
+        float v = FMath::Max3(r, g, b);
+        uint8* rgbe = &m_rgbe[x * 4];
+        if (!(v > 1e-32f))
+        {
+            rgbe[0] = rgbe[1] = rgbe[2] = rgbe[3] = 0;
+            continue;
+        }
+        int e;
+        float scale = std::frexp(v, &e) * 256.0f / v;
+        rgbe[0] = (uint8)FMath::Min(r * scale, 255.0f);
+        rgbe[1] = (uint8)FMath::Min(g * scale, 255.0f);
+        rgbe[2] = (uint8)FMath::Min(b * scale, 255.0f);
+        rgbe[3] = (uint8)(e + 128);
+    }
+    //宽度超出RLE允许范围时只能写平铺数据
+    if (m_width < 8 || m_width > 0x7fff)
+        return Write(m_rgbe.GetData(), m_rgbe.Num());
+    m_encoded.Reset();
+    m_encoded.Add(2);
+    m_encoded.Add(2);
+    m_encoded.Add((uint8)(m_width >> 8));
+    m_encoded.Add((uint8)(m_width & 0xff));
+    for (int32 channel = 0; channel < 4; ++channel)
+        EncodeChannel(m_rgbe.GetData() + channel);
+    return Write(m_encoded.GetData(), m_encoded.Num());
+}
+
+void SkyBoxRGBEWriter::EncodeChannel(const uint8* data)
+{
+    //data的步长是4，游程最少4个才值得编码
+    const int32 min_run = 4;
+    int32 cur = 0;
+    while (cur < m_width)
+    {
+        int32 begin_run = cur;
+        int32 run_count = 0;
+        int32 old_run_count = 0;
+        while (run_count < min_run && begin_run < m_width)
+        {
+            begin_run += run_count;
+            old_run_count = run_count;
+            run_count = 1;
+            while (begin_run + run_count < m_width && run_count < 127 && data[begin_run * 4] == data[(begin_run + run_count) * 4])
+                ++run_count;
+        }
+        if (old_run_count > 1 && old_run_count == begin_run - cur)
+        {
+            m_encoded.Add((uint8)(128 + old_run_count));
+            m_encoded.Add(data[cur * 4]);
+            cur = begin_run;
+        }
+        while (cur < begin_run)
+        {
+            int32 count = FMath::Min(begin_run - cur, 128);
+            m_encoded.Add((uint8)count);
+            for (int32 i = 0; i < count; ++i)
+                m_encoded.Add(data[(cur + i) * 4]);
+            cur += count;
+        }
+        if (run_count >= min_run)
+        {
+            m_encoded.Add((uint8)(128 + run_count));
+            m_encoded.Add(data[begin_run * 4]);
+            cur += run_count;
+        }
+    }
+}
+
+
+SkyBoxImageWriter* SkyBoxImageWriter::Create(SkyBoxImageFormat format)
+{
+    switch (format)
+    {
+    case SkyBoxImageFormat::EXR:
+        return new SkyBoxEXRWriter();
+    case SkyBoxImageFormat::RGBE:
+        return new SkyBoxRGBEWriter();
+    default:
+        return new SkyBoxPNGWriter();
+    }
+}
+
+const TCHAR* SkyBoxImageWriter::GetExtension(SkyBoxImageFormat format)
+{
+    switch (format)
+    {
+    case SkyBoxImageFormat::EXR:
+        return TEXT("exr");
+    case SkyBoxImageFormat::RGBE:
+        return TEXT("hdr");
+    default:
+        return TEXT("png");
+    }
+}
+
+SkyBoxImageWriter::SkyBoxImageWriter()
+{
+    m_archive = NULL;
+    m_width = 0;
+    m_height = 0;
+    m_rows_written = 0;
+}
+
+SkyBoxImageWriter::~SkyBoxImageWriter()
+{
+    if (m_archive != NULL)
+    {
+        delete m_archive;
+        m_archive = NULL;
+    }
+}
+
+bool SkyBoxImageWriter::Open(const FString& path, int32 width, int32 height)
+{
+    m_path = path;
+    m_width = width;
+    m_height = height;
+    m_rows_written = 0;
+    m_archive = IFileManager::Get().CreateFileWriter(*path);
+    if (m_archive == NULL)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！SkyBoxImageWriter::Open() FAIL %s"), *path);
+        return false;
+    }
+    return WriteHeader();
+}
+
+bool SkyBoxImageWriter::WriteRows(const FFloat16Color* rows, int32 row_count)
+{
+    if (m_archive == NULL || m_rows_written + row_count > m_height)
+        return false;
+    for (int32 i = 0; i < row_count; ++i)
+    {
+        if (!WriteRow(rows + (int64)i * m_width))
+            return false;
+        ++m_rows_written;
+    }
+    return true;
+}
+
+bool SkyBoxImageWriter::Close()
+{
+    if (m_archive == NULL)
+        return false;
+    bool ok = m_rows_written == m_height && WriteFooter();
+    ok = m_archive->Close() && ok;
+    delete m_archive;
+    m_archive = NULL;
+    if (!ok)
+        UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！SkyBoxImageWriter::Close() FAIL %s"), *m_path);
+    return ok;
+}
+
+bool SkyBoxImageWriter::Write(const void* data, int64 size)
+{
+    m_archive->Serialize(const_cast<void*>(data), size);
+    return !m_archive->IsError();
+}
+
+
+bool SkyBoxImageReader::ReadRGBE(const FString& path, int32& width, int32& height, TArray<FLinearColor>& pixels)
+{
+    TArray<uint8> file;
+    if (!FFileHelper::LoadFileToArray(file, *path))
+        return false;
+    const uint8* p = file.GetData();
+    const uint8* end = p + file.Num();
+    //跳过header，空行之后是分辨率
+    while (p < end)
+    {
+        const uint8* line = p;
+        while (p < end && *p != '\n')
+            ++p;
+        if (p >= end)
+            return false;
+        bool empty = (p == line);
+        ++p;
+        if (empty)
+            break;
+    }
+    char resolution[64] = { 0 };
+    int32 n = 0;
+    while (p < end && *p != '\n' && n < 63)
+        resolution[n++] = (char)*p++;
+    ++p;
+    if (sscanf(resolution, "-Y %d +X %d", &height, &width) != 2 || width <= 0 || height <= 0)
+        return false;
+
+    pixels.SetNumUninitialized(width * height);
+    TArray<uint8> scanline;
+    scanline.SetNumUninitialized(width * 4);
+    for (int32 y = 0; y < height; ++y)
+    {
+        if (end - p < 4)
+            return false;
+        bool rle = width >= 8 && width <= 0x7fff && p[0] == 2 && p[1] == 2 && !(p[2] & 0x80);
+        if (rle)
+        {
+            p += 4;
+            for (int32 channel = 0; channel < 4; ++channel)
+            {
+                int32 x = 0;
+                while (x < width)
+                {
+                    if (p >= end)
+                        return false;
+                    int32 count = *p++;
+                    if (count > 128)
+                    {
+                        count -= 128;
+                        if (p >= end || x + count > width)
+                            return false;
+                        for (int32 i = 0; i < count; ++i)
+                            scanline[(x++) * 4 + channel] = *p;
+                        ++p;
+                    }
+                    else
+                    {
+                        if (count == 0 || end - p < count || x + count > width)
+                            return false;
+                        for (int32 i = 0; i < count; ++i)
+                            scanline[(x++) * 4 + channel] = *p++;
+                    }
+                }
+            }
+        }
+        else
+        {
+            if (end - p < width * 4)
+                return false;
+            FMemory::Memcpy(scanline.GetData(), p, width * 4);
+            p += width * 4;
+        }
+        FLinearColor* row = &pixels[y * width];
+        for (int32 x = 0; x < width; ++x)
+        {
+            const uint8* rgbe = &scanline[x * 4];
+            if (rgbe[3] == 0)
+            {
+                row[x] = FLinearColor(0.0f, 0.0f, 0.0f, 1.0f);
+                continue;
+            }
+            float f = std::ldexp(1.0f, rgbe[3] - (128 + 8));
+            row[x] = FLinearColor(rgbe[0] * f, rgbe[1] * f, rgbe[2] * f, 1.0f);
+        }
+    }
+    return true;
+}
@@ -0,0 +1,43 @@
+#pragma once
+#include "CoreMinimal.h"
+
+
+enum class SkyBoxImageFormat : uint8
+{
+    PNG = 0,  //8位sRGB
+    EXR,  //half float，无压缩scanline
+    RGBE,  //Radiance .hdr，scanline RLE
+};
+
+
+//按行流式写出，调用方只需要准备好当前这几行，不需要整张图在内存里
+class SkyBoxImageWriter
+{
+public:
+    static SkyBoxImageWriter* Create(SkyBoxImageFormat format);
+    static const TCHAR* GetExtension(SkyBoxImageFormat format);
+    virtual ~SkyBoxImageWriter();
+    bool Open(const FString& path, int32 width, int32 height);
+    bool WriteRows(const FFloat16Color* rows, int32 row_count);
+    bool Close();
+protected:
+    SkyBoxImageWriter();
+    virtual bool WriteHeader() = 0;
+    virtual bool WriteRow(const FFloat16Color* row) = 0;
+    virtual bool WriteFooter() { return true; }
+    bool Write(const void* data, int64 size);
+protected:
+    FArchive* m_archive;
+    FString m_path;
+    int32 m_width;
+    int32 m_height;
+    int32 m_rows_written;
+};
+
+
+class SkyBoxImageReader
+{
+public:
+    //读RGBE(.hdr)，UE4.23的ImageWrapper不支持这个格式
+    static bool ReadRGBE(const FString& path, int32& width, int32& height, TArray<FLinearColor>& pixels);
+};
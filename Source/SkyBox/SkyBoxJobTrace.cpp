@@ -0,0 +1,221 @@
+#include "SkyBoxJobTrace.h"
+#include "CoreMinimal.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Templates/Atomic.h"
+
+
+void SkyBoxJobTraceBuffer::Varint(uint64 value)
+{
+    while (value >= 0x80)
+    {
+        Byte((uint8)(value | 0x80));
+        value >>= 7;
+    }
+    Byte((uint8)value);
+}
+
+void SkyBoxJobTraceBuffer::SVarint(int64 value)
+{
+    Varint(((uint64)value << 1) ^ (uint64)(value >> 63));
+}
+
+void SkyBoxJobTraceBuffer::Float(float value)
+{
+    uint32 bits;
+    FMemory::Memcpy(&bits, &value, sizeof(bits));
+    for (int32 i = 0; i < 4; ++i)
+        Byte((uint8)(bits >> (8 * i)));
+}
+
+void SkyBoxJobTraceBuffer::String(const std::string& value)
+{
+    Varint(value.size());
+    for (char c : value)
+        Byte((uint8)c);
+}
+
+
+namespace
+{
+    struct TraceState
+    {
+        FCriticalSection lock;
+        FArchive* archive = NULL;
+        double start = 0.0;  //FPlatformTime::Seconds()
+        int64 last_micros = 0;
+        std::map<std::string, uint32> clients;
+        TAtomic<bool> recording;
+        TraceState() : recording(false) {}
+    };
+
+    TraceState& State()
+    {
+        static TraceState state;
+        return state;
+    }
+
+    //调用时已经持有lock；返回客户端编号，第一次见到时先写一条NewClient
+    uint32 ClientIndex(TraceState& state, const std::string& client, int64 micros)
+    {
+        std::map<std::string, uint32>::iterator itr = state.clients.find(client);
+        if (itr != state.clients.end())
+            return itr->second;
+        uint32 index = state.clients.size();
+        state.clients[client] = index;
+        SkyBoxJobTraceBuffer buffer;
+        buffer.Byte(SkyBoxJobTrace::NewClient);
+        buffer.SVarint(micros - state.last_micros);
+        buffer.Varint(index);
+        buffer.String(client.substr(0, 256));
+        state.archive->Serialize(buffer.m_data.GetData(), buffer.m_data.Num());
+        state.last_micros = micros;
+        return index;
+    }
+
+    //body是记录里client之后的部分
+    void WriteRecord(SkyBoxJobTrace::RecordType type, double arrival, const std::string& client, const SkyBoxJobTraceBuffer& body)
+    {
+        TraceState& state = State();
+        FScopeLock lock(&state.lock);
+        if (state.archive == NULL)
+            return;
+        int64 micros = (int64)((arrival - state.start) * 1000000.0);
+        uint32 index = ClientIndex(state, client, micros);
+        SkyBoxJobTraceBuffer head;
+        head.Byte(type);
+        head.SVarint(micros - state.last_micros);
+        head.Varint(index);
+        state.archive->Serialize(head.m_data.GetData(), head.m_data.Num());
+        state.archive->Serialize((void*)body.m_data.GetData(), body.m_data.Num());
+        state.last_micros = micros;
+    }
+
+    FAutoConsoleCommand GRecordJobsCommand(
+        TEXT("SkyBox.RecordJobs"),
+        TEXT("开始记录请求到文件，参数是路径，默认写到Saved/Profiling；参数是stop时停止"),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& args)
+        {
+            if (args.Num() > 0 && args[0] == TEXT("stop"))
+            {
+                SkyBoxJobTrace::Stop();
+                return;
+            }
+            FString path = args.Num() > 0 ? args[0] : FPaths::ProfilingDir() / FString::Printf(TEXT("SkyBoxJobs_%s.sbjt"), *FDateTime::Now().ToString());
+            SkyBoxJobTrace::Start(path);
+        }));
+}
+
+
+bool SkyBoxJobTrace::Start(const FString& path)
+{
+    Stop();
+    TraceState& state = State();
+    FScopeLock lock(&state.lock);
+    state.archive = IFileManager::Get().CreateFileWriter(*path);
+    if (state.archive == NULL)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！SkyBoxJobTrace::Start() FAIL %s"), *path);
+        return false;
+    }
+    state.start = FPlatformTime::Seconds();
+    state.last_micros = 0;
+    state.clients.clear();
+    uint8 magic[4] = { 'S', 'B', 'J', 'T' };
+    uint32 version = Version;
+    uint64 start_unix = (uint64)((FDateTime::UtcNow() - FDateTime(1970, 1, 1)).GetTicks() / ETimespan::TicksPerMicrosecond);
+    state.archive->Serialize(magic, sizeof(magic));
+    *state.archive << version;  //FArchive按平台字节序写，目标平台都是小端
+    *state.archive << start_unix;
+    state.recording = true;
+    UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！SkyBoxJobTrace::Start(), %s"), *path);
+    return true;
+}
+
+void SkyBoxJobTrace::Stop()
+{
+    TraceState& state = State();
+    FScopeLock lock(&state.lock);
+    state.recording = false;
+    if (state.archive == NULL)
+        return;
+    state.archive->Close();
+    delete state.archive;
+    state.archive = NULL;
+    UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！SkyBoxJobTrace::Stop(), clients = %d"), (int32)state.clients.size());
+}
+
+bool SkyBoxJobTrace::IsRecording()
+{
+    return State().recording.Load(EMemoryOrder::Relaxed);
+}
+
+void SkyBoxJobTrace::RecordGenerate(double arrival, const std::string& client, int scene_id, float x, float y, float z, int resolution, int format, int quality, int ibl, bool supersede, int job_id)
+{
+    SkyBoxJobTraceBuffer body;
+    body.Varint((uint32)scene_id);
+    body.Float(x);
+    body.Float(y);
+    body.Float(z);
+    body.Varint((uint32)resolution);
+    body.Byte((uint8)format);
+    body.Byte((uint8)quality);
+    body.Byte((uint8)ibl);
+    body.Byte(supersede ? 1 : 0);
+    body.Varint((uint32)job_id);
+    WriteRecord(Generate, arrival, client, body);
+}
+
+void SkyBoxJobTrace::RecordQuery(double arrival, const std::string& client, int job_id, int job_status)
+{
+    SkyBoxJobTraceBuffer body;
+    body.Varint((uint32)job_id);
+    body.Byte((uint8)job_status);
+    WriteRecord(Query, arrival, client, body);
+}
+
+void SkyBoxJobTrace::RecordRegion(double arrival, const std::string& client, int scene_id, const FVector& min, const FVector& max, float spacing, const TArray<FVector>& positions, int resolution, int format, int quality, int ibl, int region_id)
+{
+    SkyBoxJobTraceBuffer body;
+    body.m_data.Reserve(48 + positions.Num() * 12);
+    body.Varint((uint32)scene_id);
+    body.Float(min.X);
+    body.Float(min.Y);
+    body.Float(min.Z);
+    body.Float(max.X);
+    body.Float(max.Y);
+    body.Float(max.Z);
+    body.Float(spacing);
+    body.Varint((uint32)positions.Num());
+    for (const FVector& position : positions)
+    {
+        body.Float(position.X);
+        body.Float(position.Y);
+        body.Float(position.Z);
+    }
+    body.Varint((uint32)resolution);
+    body.Byte((uint8)format);
+    body.Byte((uint8)quality);
+    body.Byte((uint8)ibl);
+    body.Varint((uint32)region_id);
+    WriteRecord(Region, arrival, client, body);
+}
+
+void SkyBoxJobTrace::RecordCancel(double arrival, const std::string& client, int job_id, int job_status)
+{
+    SkyBoxJobTraceBuffer body;
+    body.Varint((uint32)job_id);
+    body.Byte((uint8)job_status);
+    WriteRecord(Cancel, arrival, client, body);
+}
+
+void SkyBoxJobTrace::RecordClientWeight(double arrival, const std::string& client, const std::string& target, float weight)
+{
+    SkyBoxJobTraceBuffer body;
+    body.String(target.substr(0, 256));
+    body.Float(weight);
+    WriteRecord(ClientWeight, arrival, client, body);
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include <map>
+#include <string>
+#include "CoreMinimal.h"
+
+
+/*
+记录每个GenerateSkyBox、GenerateRegion、QueryJob、CancelJob、SetClientWeight请求到达的时间和内容，Tools/SkyBoxLoadGen/SkyBoxReplay按原来的节奏重放，用来评估缓存大小、调度策略的改动
+
+文件格式，小端，varint是LEB128，svarint是zigzag之后的varint：
+    文件头    "SBJT"  uint32 version  uint64 开始记录的时间（unix微秒）
+    每条记录  uint8 type  svarint 和上一条的到达时间差（微秒，多个RPC线程并发，可能为负）  varint client
+    type 1 新客户端         varint 长度  客户端名字；client是它的编号，之后的记录用这个编号
+    type 2 GenerateSkyBox   varint scene_id  float x y z  varint resolution  uint8 format  uint8 quality  uint8 ibl  uint8 supersede  varint 返回的job_id（0表示被拒绝）
+    type 3 QueryJob         varint job_id  uint8 返回的job_status
+    type 4 GenerateRegion   varint scene_id  float min x y z  float max x y z  float spacing  varint 点数  每个点float x y z
+                            varint resolution  uint8 format  uint8 quality  uint8 ibl  varint 返回的region_id（0表示被拒绝）
+    type 5 CancelJob        varint job_id（是region_id时也记在这里）  uint8 返回的job_status
+    type 6 SetClientWeight  varint 长度  被设置的客户端名字  float weight
+version 1没有ibl字段，也没有type 4~6
+*/
+//一条记录的编码，先拼在内存里，再在锁里一次写出
+class SkyBoxJobTraceBuffer
+{
+public:
+    void Byte(uint8 value) { m_data.Add(value); }
+    void Varint(uint64 value);
+    void SVarint(int64 value);
+    void Float(float value);
+    void String(const std::string& value);
+public:
+    TArray<uint8> m_data;
+};
+
+class SkyBoxJobTrace
+{
+public:
+    enum RecordType
+    {
+        NewClient = 1,
+        Generate = 2,
+        Query = 3,
+        Region = 4,
+        Cancel = 5,
+        ClientWeight = 6,
+    };
+    static const uint32 Version = 2;
+public:
+    static bool Start(const FString& path);
+    static void Stop();
+    static bool IsRecording();
+    //arrival是FPlatformTime::Seconds()
+    static void RecordGenerate(double arrival, const std::string& client, int scene_id, float x, float y, float z, int resolution, int format, int quality, int ibl, bool supersede, int job_id);
+    static void RecordQuery(double arrival, const std::string& client, int job_id, int job_status);
+    //positions为空时按min、max、spacing的网格生成
+    static void RecordRegion(double arrival, const std::string& client, int scene_id, const FVector& min, const FVector& max, float spacing, const TArray<FVector>& positions, int resolution, int format, int quality, int ibl, int region_id);
+    static void RecordCancel(double arrival, const std::string& client, int job_id, int job_status);
+    static void RecordClientWeight(double arrival, const std::string& client, const std::string& target, float weight);
+};
@@ -0,0 +1,91 @@
+#include "SkyBoxLevelPool.h"
+#include "CoreMinimal.h"
+#include "Engine/LevelStreaming.h"
+#include "Engine/World.h"
+#include "Kismet/GameplayStatics.h"
+
+
+SkyBoxLevelPool::SkyBoxLevelPool(UWorld* world, const TArray<FName>& levels, int32 max_resident)
+{
+    m_world = world;
+    m_levels = levels;
+    m_max_resident = FMath::Max(max_resident, 1);
+    m_active = -1;
+    //编辑器里勾了初始可见的子关卡全部先藏起来，只留scene 0
+    for (int32 i = 1; i < m_levels.Num(); ++i)
+    {
+        ULevelStreaming* streaming = GetStreaming(i);
+        if (streaming != NULL)
+            streaming->SetShouldBeVisible(false);
+    }
+    Activate(0);
+}
+
+void SkyBoxLevelPool::Activate(int32 scene_id)
+{
+    if (scene_id == m_active || scene_id < 0 || scene_id >= SceneCount())
+        return;
+    UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！SkyBoxLevelPool::Activate(), scene_id = %d, previous = %d"), scene_id, m_active);
+    ULevelStreaming* previous = GetStreaming(m_active);
+    if (previous != NULL)
+        previous->SetShouldBeVisible(false);  //场景都摆在同一片空间里，同时只能显示一个
+    m_active = scene_id;
+    MakeResident(scene_id, 0);
+    ULevelStreaming* streaming = GetStreaming(scene_id);
+    if (streaming != NULL)
+    {
+        streaming->SetShouldBeLoaded(true);
+        streaming->SetShouldBeVisible(true);
+    }
+}
+
+void SkyBoxLevelPool::Preload(int32 scene_id)
+{
+    if (scene_id == m_active || scene_id < 0 || scene_id >= SceneCount() || m_resident.Contains(scene_id))
+        return;
+    if (m_max_resident < 2)
+        return;  //池里只放得下当前场景
+    UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！SkyBoxLevelPool::Preload(), scene_id = %d"), scene_id);
+    MakeResident(scene_id, 1);
+    ULevelStreaming* streaming = GetStreaming(scene_id);
+    if (streaming != NULL)
+    {
+        streaming->SetShouldBeLoaded(true);
+        streaming->SetShouldBeVisible(false);
+    }
+}
+
+bool SkyBoxLevelPool::IsReady(int32 scene_id) const
+{
+    if (scene_id != m_active)
+        return false;
+    ULevelStreaming* streaming = GetStreaming(scene_id);
+    if (streaming == NULL)
+        return true;
+    return streaming->IsLevelLoaded() && streaming->IsLevelVisible();
+}
+
+ULevelStreaming* SkyBoxLevelPool::GetStreaming(int32 scene_id) const
+{
+    if (scene_id < 0 || scene_id >= m_levels.Num() || m_levels[scene_id].IsNone())
+        return NULL;
+    return UGameplayStatics::GetStreamingLevel(m_world, m_levels[scene_id]);
+}
+
+void SkyBoxLevelPool::MakeResident(int32 scene_id, int32 position)
+{
+    m_resident.Remove(scene_id);
+    m_resident.Insert(scene_id, FMath::Min(position, m_resident.Num()));
+    //超出的从最久没用的开始卸，正在用的不卸
+    while (m_resident.Num() > m_max_resident)
+    {
+        int32 evict = m_resident.Pop();
+        UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！SkyBoxLevelPool evict, scene_id = %d"), evict);
+        ULevelStreaming* streaming = GetStreaming(evict);
+        if (streaming != NULL)
+        {
+            streaming->SetShouldBeVisible(false);
+            streaming->SetShouldBeLoaded(false);
+        }
+    }
+}
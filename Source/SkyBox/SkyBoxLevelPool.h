@@ -0,0 +1,29 @@
+#pragma once
+#include "CoreMinimal.h"
+
+class UWorld;
+class ULevelStreaming;
+
+
+//多个场景放在同一个持久关卡下的流送子关卡里，scene_id就是下标
+//最近用过的几个场景一直加载着，只切可见性，换场景不用重新读盘
+class SkyBoxLevelPool
+{
+public:
+    SkyBoxLevelPool(UWorld* world, const TArray<FName>& levels, int32 max_resident);
+    int32 SceneCount() const { return FMath::Max(m_levels.Num(), 1); }
+    int32 GetActiveScene() const { return m_active; }
+    const TArray<int32>& GetResidentScenes() const { return m_resident; }  //最近用过的在前
+    void Activate(int32 scene_id);  //切到这个场景：上一个隐藏但保留，池满了卸掉最久没用的
+    void Preload(int32 scene_id);  //只加载不显示，给接下来要切过去的场景用
+    bool IsReady(int32 scene_id) const;  //加载完并且可见
+private:
+    ULevelStreaming* GetStreaming(int32 scene_id) const;
+    void MakeResident(int32 scene_id, int32 position);
+private:
+    UWorld* m_world;
+    TArray<FName> m_levels;  //名字为空的表示就用持久关卡本身
+    int32 m_max_resident;
+    int32 m_active;
+    TArray<int32> m_resident;
+};
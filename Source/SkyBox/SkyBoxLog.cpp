@@ -0,0 +1,163 @@
+#include "SkyBoxLog.h"
+#include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+
+
+namespace
+{
+    TAutoConsoleVariable<int32> CVarSkyBoxLogLevel(
+        TEXT("SkyBox.LogLevel"),
+        (int32)ESkyBoxLog::Info,
+        TEXT("0 Error, 1 Warning, 2 Info, 3 Verbose（每个请求一条）"),
+        ECVF_Default);
+
+    TAutoConsoleVariable<int32> CVarSkyBoxLogRateLimit(
+        TEXT("SkyBox.LogRateLimit"),
+        20,
+        TEXT("每个打日志的地方每秒最多几条，0表示不限"),
+        ECVF_Default);
+}
+
+
+bool SkyBoxLogSite::Allow(int32* suppressed)
+{
+    int32 limit = CVarSkyBoxLogRateLimit.GetValueOnAnyThread();
+    if (limit <= 0)
+        return true;
+    //按整秒的窗口计数；窗口和计数放在同一个字里CAS，换窗口清零和计数不会被别的线程插进来
+    uint64 now = (uint32)FPlatformTime::Seconds();
+    uint64 value = m_window_count.Load(EMemoryOrder::Relaxed);
+    while (true)
+    {
+        uint64 count = (value >> 32) == now ? (value & 0xffffffff) : 0;
+        if (count >= (uint64)limit)
+        {
+            ++m_suppressed;
+            return false;
+        }
+        if (m_window_count.CompareExchange(value, (now << 32) | (count + 1)))
+            break;
+    }
+    *suppressed = m_suppressed.Exchange(0);
+    return true;
+}
+
+
+TAtomic<SkyBoxLog*> SkyBoxLog::ms_instance(NULL);
+TAtomic<int32> SkyBoxLog::ms_writers(0);
+
+void SkyBoxLog::StartUp()
+{
+    if (ms_instance.Load() == NULL && FPlatformProcess::SupportsMultithreading())
+        ms_instance = new SkyBoxLog();
+}
+
+void SkyBoxLog::Shutdown()
+{
+    SkyBoxLog* instance = ms_instance.Exchange(NULL);  //之后的日志直接同步写
+    if (instance)
+    {
+        //渲染线程、游戏线程这时还可能在Write里拿着旧指针入队，等它们出来
+        while (ms_writers.Load() > 0)
+            FPlatformProcess::Yield();
+        instance->Stop();
+        instance->m_thread->WaitForCompletion();
+        instance->Flush();
+        delete instance;
+    }
+}
+
+bool SkyBoxLog::IsEnabled(ESkyBoxLog level)
+{
+    return (int32)level <= CVarSkyBoxLogLevel.GetValueOnAnyThread();
+}
+
+void SkyBoxLog::Write(ESkyBoxLog level, const TCHAR* event, int32 suppressed, FString&& fields)
+{
+    //一行一个事件，后面是key=value，方便按字段检索
+    FString text = FString::Printf(TEXT("%s %s"), event, *fields);
+    if (suppressed > 0)
+        text += FString::Printf(TEXT(" suppressed=%d"), suppressed);
+    //先登记再读指针；Shutdown先清指针再等登记的数归零，两边都是顺序一致的原子操作，不会漏掉
+    ++ms_writers;
+    SkyBoxLog* instance = ms_instance.Load();
+    if (instance == NULL)
+    {
+        --ms_writers;
+        Output(level, text);
+        return;
+    }
+    if (++instance->m_pending > MaxPendingLines)
+    {
+        --instance->m_pending;
+        ++instance->m_dropped;
+    }
+    else
+    {
+        Line line;
+        line.level = level;
+        line.text = MoveTemp(text);
+        instance->m_lines.Enqueue(MoveTemp(line));
+    }
+    --ms_writers;
+}
+
+void SkyBoxLog::Output(ESkyBoxLog level, const FString& line)
+{
+    switch (level)
+    {
+    case ESkyBoxLog::Error:
+        UE_LOG(LogTemp, Error, TEXT("！！！！！！！！！！%s"), *line);
+        break;
+    case ESkyBoxLog::Warning:
+        UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！%s"), *line);
+        break;
+    default:
+        UE_LOG(LogTemp, Log, TEXT("！！！！！！！！！！%s"), *line);
+        break;
+    }
+}
+
+SkyBoxLog::SkyBoxLog() : StopTaskCounter(0)
+{
+    m_pending = 0;
+    m_dropped = 0;
+    m_thread = FRunnableThread::Create(this, TEXT("SkyBoxLog"), 0, TPri_BelowNormal);
+}
+
+SkyBoxLog::~SkyBoxLog()
+{
+    delete m_thread;
+    m_thread = NULL;
+}
+
+void SkyBoxLog::Flush()
+{
+    Line line;
+    while (m_lines.Dequeue(line))
+    {
+        --m_pending;
+        Output(line.level, line.text);
+    }
+    int32 dropped = m_dropped.Exchange(0);
+    if (dropped > 0)
+        Output(ESkyBoxLog::Warning, FString::Printf(TEXT("LogDropped count=%d"), dropped));
+}
+
+uint32 SkyBoxLog::Run()
+{
+    //攒一小段时间批量写，入队的一方不用唤醒这个线程
+    while (StopTaskCounter.GetValue() == 0)
+    {
+        Flush();
+        FPlatformProcess::Sleep(0.05f);
+    }
+    return 0;
+}
+
+void SkyBoxLog::Stop()
+{
+    StopTaskCounter.Increment();
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Templates/Atomic.h"
+
+
+//级别，数字越大越啰嗦；控制台变量SkyBox.LogLevel之上的直接丢掉，默认不输出每个请求的日志
+enum class ESkyBoxLog : int32
+{
+    Error = 0,
+    Warning,
+    Info,  //任务、服务状态的变化
+    Verbose,  //每个请求、每个面一条
+};
+
+
+//每个打日志的地方一个，一秒内超过SkyBox.LogRateLimit条的丢掉，下一条带上丢了多少
+struct SkyBoxLogSite
+{
+    SkyBoxLogSite() : m_window_count(0), m_suppressed(0) {}
+    bool Allow(int32* suppressed);
+    TAtomic<uint64> m_window_count;  //高32位是当前计数的那一秒，低32位是这一秒已经输出的条数，一起用CAS更新
+    TAtomic<int32> m_suppressed;
+};
+
+
+//异步日志：调用线程只格式化和入队，由单独的线程写UE_LOG，RPC线程不会等日志的锁和磁盘
+class SkyBoxLog : public FRunnable
+{
+public:
+    static void StartUp();
+    static void Shutdown();  //停线程前把队列里剩下的写完
+    static bool IsEnabled(ESkyBoxLog level);
+    static void Write(ESkyBoxLog level, const TCHAR* event, int32 suppressed, FString&& fields);
+public:
+    static const int32 MaxPendingLines = 65536;  //写日志的线程跟不上时，超过的丢掉
+private:
+    SkyBoxLog();
+    static void Output(ESkyBoxLog level, const FString& line);
+    void Flush();
+public:
+    virtual ~SkyBoxLog();
+    //FRunnable interface
+    virtual uint32 Run();
+    virtual void Stop();
+private:
+    struct Line
+    {
+        ESkyBoxLog level;
+        FString text;
+    };
+    static TAtomic<SkyBoxLog*> ms_instance;
+    static TAtomic<int32> ms_writers;  //正在Write里用ms_instance的线程数，Shutdown等它归零才delete
+    FRunnableThread* m_thread;
+    FThreadSafeCounter StopTaskCounter;
+    TQueue<Line, EQueueMode::Mpsc> m_lines;
+    TAtomic<int32> m_pending;
+    TAtomic<int32> m_dropped;
+};
+
+
+//SKYBOX_LOG(Verbose, TEXT("QueryJob"), TEXT("job_id=%d"), job_id)，级别不够时参数都不求值
+#define SKYBOX_LOG(level, event, format, ...) \
+    do \
+    { \
+        if (SkyBoxLog::IsEnabled(ESkyBoxLog::level)) \
+        { \
+            static SkyBoxLogSite skybox_log_site; \
+            int32 skybox_log_suppressed = 0; \
+            if (skybox_log_site.Allow(&skybox_log_suppressed)) \
+                SkyBoxLog::Write(ESkyBoxLog::level, event, skybox_log_suppressed, FString::Printf(format, ##__VA_ARGS__)); \
+        } \
+    } while (0)
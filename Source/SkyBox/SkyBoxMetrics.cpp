@@ -0,0 +1,359 @@
+#include "SkyBoxMetrics.h"
+#include "CoreMinimal.h"
+#include "Misc/ScopeLock.h"
+
+
+struct SkyBoxHistogram::Shard
+{
+    //只有所属线程写，用原子变量只是为了导出线程读到完整的值
+    TAtomic<uint64> buckets[BucketCount];
+    TAtomic<uint64> count;
+    TAtomic<uint64> sum_micros;
+    TAtomic<uint64> max_micros;
+    Shard()
+    {
+        for (int32 i = 0; i < BucketCount; ++i)
+            buckets[i] = 0;
+        count = 0;
+        sum_micros = 0;
+        max_micros = 0;
+    }
+};
+
+namespace
+{
+    TAtomic<int32> GNextHistogramID(0);
+    thread_local TArray<void*>* t_shards = NULL;  //下标是SkyBoxHistogram::m_id
+
+    struct MetricEntry
+    {
+        FString name;
+        FString help;
+        SkyBoxCounter* counter;
+        SkyBoxHistogram* histogram;
+        TFunction<double()> gauge;
+    };
+
+    FCriticalSection& RegistryLock()
+    {
+        static FCriticalSection lock;
+        return lock;
+    }
+
+    TArray<MetricEntry*>& Registry()
+    {
+        static TArray<MetricEntry*> entries;
+        return entries;
+    }
+
+    MetricEntry* FindOrAdd(const TCHAR* name, const TCHAR* help)
+    {
+        FScopeLock lock(&RegistryLock());
+        for (MetricEntry* entry : Registry())
+        {
+            if (entry->name == name)
+                return entry;
+        }
+        MetricEntry* entry = new MetricEntry();
+        entry->name = name;
+        entry->help = help;
+        entry->counter = NULL;
+        entry->histogram = NULL;
+        Registry().Add(entry);
+        return entry;
+    }
+
+    void AppendHelp(FString& text, const MetricEntry* entry, const TCHAR* type)
+    {
+        text += FString::Printf(TEXT("# HELP %s %s\n# TYPE %s %s\n"), *entry->name, *entry->help, *entry->name, type);
+    }
+}
+
+
+SkyBoxHistogram::SkyBoxHistogram()
+{
+    m_id = GNextHistogramID++;
+}
+
+SkyBoxHistogram::~SkyBoxHistogram()
+{
+    //指标和进程同生命周期，线程局部表里留下的指针不会再被用到
+    FScopeLock lock(&m_shards_lock);
+    for (Shard* shard : m_shards)
+        delete shard;
+    m_shards.Empty();
+}
+
+int32 SkyBoxHistogram::BucketIndex(uint64 micros)
+{
+    //小于SubBuckets的值每个一个桶；之后每个2倍区间取最高位后面的SubBucketBits位分桶
+    if (micros < (uint64)SubBuckets)
+        return (int32)micros;
+    int32 msb = 63 - (int32)FPlatformMath::CountLeadingZeros64(micros);
+    int32 octave = msb - SubBucketBits + 1;
+    int32 sub = (int32)((micros >> (msb - SubBucketBits)) & (SubBuckets - 1));
+    return FMath::Min(octave * SubBuckets + sub, BucketCount - 1);
+}
+
+double SkyBoxHistogram::BucketUpperSeconds(int32 bucket)
+{
+    int32 octave = bucket / SubBuckets;
+    int32 sub = bucket % SubBuckets;
+    if (octave == 0)
+        return (sub + 1) * 1e-6;
+    double base = FMath::Pow(2.0, (double)(octave + SubBucketBits - 1));
+    return base * (1.0 + (sub + 1) / (double)SubBuckets) * 1e-6;
+}
+
+SkyBoxHistogram::Shard* SkyBoxHistogram::GetThreadShard()
+{
+    if (t_shards == NULL)
+        t_shards = new TArray<void*>();
+    if (t_shards->Num() <= m_id)
+        t_shards->SetNumZeroed(m_id + 1);
+    Shard* shard = (Shard*)(*t_shards)[m_id];
+    if (shard == NULL)
+    {
+        shard = new Shard();
+        {
+            FScopeLock lock(&m_shards_lock);
+            m_shards.Add(shard);
+        }
+        (*t_shards)[m_id] = shard;
+    }
+    return shard;
+}
+
+void SkyBoxHistogram::Observe(double seconds)
+{
+    uint64 micros = seconds > 0.0 ? (uint64)(seconds * 1000000.0) : 0;
+    Shard* shard = GetThreadShard();
+    TAtomic<uint64>& bucket = shard->buckets[BucketIndex(micros)];
+    bucket.Store(bucket.Load(EMemoryOrder::Relaxed) + 1, EMemoryOrder::Relaxed);
+    shard->count.Store(shard->count.Load(EMemoryOrder::Relaxed) + 1, EMemoryOrder::Relaxed);
+    shard->sum_micros.Store(shard->sum_micros.Load(EMemoryOrder::Relaxed) + micros, EMemoryOrder::Relaxed);
+    if (micros > shard->max_micros.Load(EMemoryOrder::Relaxed))
+        shard->max_micros.Store(micros, EMemoryOrder::Relaxed);
+}
+
+SkyBoxHistogram::Snapshot SkyBoxHistogram::TakeSnapshot() const
+{
+    Snapshot snapshot;
+    snapshot.buckets.SetNumZeroed(BucketCount);
+    snapshot.count = 0;
+    uint64 sum_micros = 0;
+    uint64 max_micros = 0;
+    FScopeLock lock(&m_shards_lock);
+    for (const Shard* shard : m_shards)
+    {
+        for (int32 i = 0; i < BucketCount; ++i)
+            snapshot.buckets[i] += shard->buckets[i].Load(EMemoryOrder::Relaxed);
+        snapshot.count += shard->count.Load(EMemoryOrder::Relaxed);
+        sum_micros += shard->sum_micros.Load(EMemoryOrder::Relaxed);
+        max_micros = FMath::Max(max_micros, shard->max_micros.Load(EMemoryOrder::Relaxed));
+    }
+    snapshot.sum_seconds = sum_micros * 1e-6;
+    snapshot.max_seconds = max_micros * 1e-6;
+    return snapshot;
+}
+
+double SkyBoxHistogram::Snapshot::Percentile(double p) const
+{
+    //按桶数算，桶的计数和count不是同一时刻读的，以桶为准
+    uint64 total = 0;
+    for (uint64 n : buckets)
+        total += n;
+    if (total == 0)
+        return 0.0;
+    uint64 rank = (uint64)FMath::CeilToDouble(p * total);
+    uint64 seen = 0;
+    for (int32 i = 0; i < buckets.Num(); ++i)
+    {
+        seen += buckets[i];
+        if (seen >= rank && buckets[i] > 0)
+            return FMath::Min(BucketUpperSeconds(i), max_seconds);
+    }
+    return max_seconds;
+}
+
+
+SkyBoxCounter& SkyBoxMetrics::Counter(const TCHAR* name, const TCHAR* help)
+{
+    MetricEntry* entry = FindOrAdd(name, help);
+    FScopeLock lock(&RegistryLock());
+    if (entry->counter == NULL)
+        entry->counter = new SkyBoxCounter();
+    return *entry->counter;
+}
+
+SkyBoxHistogram& SkyBoxMetrics::Histogram(const TCHAR* name, const TCHAR* help)
+{
+    MetricEntry* entry = FindOrAdd(name, help);
+    FScopeLock lock(&RegistryLock());
+    if (entry->histogram == NULL)
+        entry->histogram = new SkyBoxHistogram();
+    return *entry->histogram;
+}
+
+void SkyBoxMetrics::Gauge(const TCHAR* name, const TCHAR* help, TFunction<double()> sample)
+{
+    MetricEntry* entry = FindOrAdd(name, help);
+    FScopeLock lock(&RegistryLock());
+    entry->gauge = MoveTemp(sample);
+}
+
+void SkyBoxMetrics::Collect(TArray<CounterValue>& counters, TArray<CounterValue>& gauges, TArray<HistogramValue>& histograms)
+{
+    //gauge的取值函数里可能要拿别的锁，先把表复制出来再取
+    TArray<MetricEntry*> entries;
+    {
+        FScopeLock lock(&RegistryLock());
+        entries = Registry();
+    }
+    for (MetricEntry* entry : entries)
+    {
+        if (entry->counter != NULL)
+            counters.Add({ entry->name, (double)entry->counter->Get() });
+        else if (entry->histogram != NULL)
+            histograms.Add({ entry->name, entry->histogram->TakeSnapshot() });
+        else if (entry->gauge)
+            gauges.Add({ entry->name, entry->gauge() });
+    }
+}
+
+FString SkyBoxMetrics::ExportPrometheus()
+{
+    TArray<MetricEntry*> entries;
+    {
+        FScopeLock lock(&RegistryLock());
+        entries = Registry();
+    }
+    FString text;
+    for (MetricEntry* entry : entries)
+    {
+        if (entry->counter != NULL)
+        {
+            AppendHelp(text, entry, TEXT("counter"));
+            text += FString::Printf(TEXT("%s %llu\n"), *entry->name, entry->counter->Get());
+        }
+        else if (entry->histogram != NULL)
+        {
+            //细分桶太多，只在每个2倍区间的边界输出一个le
+            AppendHelp(text, entry, TEXT("histogram"));
+            SkyBoxHistogram::Snapshot snapshot = entry->histogram->TakeSnapshot();
+            uint64 cumulative = 0;
+            for (int32 i = 0; i < SkyBoxHistogram::BucketCount; ++i)
+            {
+                cumulative += snapshot.buckets[i];
+                if (i % SkyBoxHistogram::SubBuckets == SkyBoxHistogram::SubBuckets - 1)
+                    text += FString::Printf(TEXT("%s_bucket{le=\"%g\"} %llu\n"), *entry->name, SkyBoxHistogram::BucketUpperSeconds(i), cumulative);
+            }
+            text += FString::Printf(TEXT("%s_bucket{le=\"+Inf\"} %llu\n"), *entry->name, cumulative);
+            text += FString::Printf(TEXT("%s_sum %g\n"), *entry->name, snapshot.sum_seconds);
+            text += FString::Printf(TEXT("%s_count %llu\n"), *entry->name, cumulative);
+        }
+        else if (entry->gauge)
+        {
+            AppendHelp(text, entry, TEXT("gauge"));
+            text += FString::Printf(TEXT("%s %g\n"), *entry->name, entry->gauge());
+        }
+    }
+    return text;
+}
+
+
+namespace SkyBoxStats
+{
+    SkyBoxCounter& GenerateRequests()
+    {
+        static SkyBoxCounter& counter = SkyBoxMetrics::Counter(TEXT("skybox_generate_requests_total"), TEXT("GenerateSkyBox and GenerateRegion calls"));
+        return counter;
+    }
+
+    SkyBoxCounter& QueryRequests()
+    {
+        static SkyBoxCounter& counter = SkyBoxMetrics::Counter(TEXT("skybox_query_requests_total"), TEXT("QueryJob calls"));
+        return counter;
+    }
+
+    SkyBoxCounter& JobsCreated()
+    {
+        static SkyBoxCounter& counter = SkyBoxMetrics::Counter(TEXT("skybox_jobs_created_total"), TEXT("Jobs added to the queue"));
+        return counter;
+    }
+
+    SkyBoxCounter& CompletedCacheHits()
+    {
+        static SkyBoxCounter& counter = SkyBoxMetrics::Counter(TEXT("skybox_completed_cache_hits_total"), TEXT("Requests answered by an already completed job"));
+        return counter;
+    }
+
+    SkyBoxCounter& QueuedHits()
+    {
+        static SkyBoxCounter& counter = SkyBoxMetrics::Counter(TEXT("skybox_queued_hits_total"), TEXT("Requests merged into a job that is still queued"));
+        return counter;
+    }
+
+    SkyBoxCounter& AdmissionRejected()
+    {
+        static SkyBoxCounter& counter = SkyBoxMetrics::Counter(TEXT("skybox_admission_rejected_total"), TEXT("Requests rejected with RESOURCE_EXHAUSTED"));
+        return counter;
+    }
+
+    SkyBoxCounter& JobsSucceeded()
+    {
+        static SkyBoxCounter& counter = SkyBoxMetrics::Counter(TEXT("skybox_jobs_succeeded_total"), TEXT("Jobs that finished successfully"));
+        return counter;
+    }
+
+    SkyBoxCounter& JobsFailed()
+    {
+        static SkyBoxCounter& counter = SkyBoxMetrics::Counter(TEXT("skybox_jobs_failed_total"), TEXT("Jobs that failed"));
+        return counter;
+    }
+
+    SkyBoxCounter& JobsCancelled()
+    {
+        static SkyBoxCounter& counter = SkyBoxMetrics::Counter(TEXT("skybox_jobs_cancelled_total"), TEXT("Jobs cancelled or superseded"));
+        return counter;
+    }
+
+    SkyBoxCounter& FaceRetries()
+    {
+        static SkyBoxCounter& counter = SkyBoxMetrics::Counter(TEXT("skybox_face_retries_total"), TEXT("Faces captured again after a timeout or write failure"));
+        return counter;
+    }
+
+    SkyBoxHistogram& QueueWait()
+    {
+        static SkyBoxHistogram& histogram = SkyBoxMetrics::Histogram(TEXT("skybox_queue_wait_seconds"), TEXT("Time from enqueue until a rig takes the job"));
+        return histogram;
+    }
+
+    SkyBoxHistogram& JobDuration()
+    {
+        static SkyBoxHistogram& histogram = SkyBoxMetrics::Histogram(TEXT("skybox_job_duration_seconds"), TEXT("Time from a rig taking the job until it ends"));
+        return histogram;
+    }
+
+    SkyBoxHistogram& Stage(const TCHAR* stage)
+    {
+        static SkyBoxHistogram& settle = SkyBoxMetrics::Histogram(TEXT("skybox_stage_settle_seconds"), TEXT("Time waiting for streaming, TAA and exposure to settle per face"));
+        static SkyBoxHistogram& render = SkyBoxMetrics::Histogram(TEXT("skybox_stage_render_seconds"), TEXT("Time waiting for a face to render"));
+        static SkyBoxHistogram& readback = SkyBoxMetrics::Histogram(TEXT("skybox_stage_readback_seconds"), TEXT("Time waiting for GPU readback per face or tile"));
+        static SkyBoxHistogram& encode = SkyBoxMetrics::Histogram(TEXT("skybox_stage_encode_write_seconds"), TEXT("Time encoding and writing a face"));
+        static SkyBoxHistogram& ibl = SkyBoxMetrics::Histogram(TEXT("skybox_stage_ibl_seconds"), TEXT("Time baking IBL for a job"));
+        static SkyBoxHistogram& other = SkyBoxMetrics::Histogram(TEXT("skybox_stage_other_seconds"), TEXT("Time spent warming up and in other capture stages"));
+        if (FCString::Strcmp(stage, TEXT("Settle")) == 0)
+            return settle;
+        if (FCString::Strcmp(stage, TEXT("Render")) == 0)
+            return render;
+        if (FCString::Strcmp(stage, TEXT("Readback")) == 0)
+            return readback;
+        if (FCString::Strcmp(stage, TEXT("EncodeWrite")) == 0)
+            return encode;
+        if (FCString::Strcmp(stage, TEXT("IBL")) == 0)
+            return ibl;
+        return other;
+    }
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Templates/Atomic.h"
+#include "Templates/Function.h"
+
+class SkyBoxHistogram;
+
+
+//计数器，多线程直接原子加
+class SkyBoxCounter
+{
+public:
+    SkyBoxCounter() : m_value(0) {}
+    void Add(uint64 delta = 1) { m_value += delta; }
+    uint64 Get() const { return m_value.Load(); }
+private:
+    TAtomic<uint64> m_value;
+};
+
+
+//延迟分布，HDR风格的对数-线性分桶：每个2倍区间再等分成SubBuckets份，相对误差在1/SubBuckets以内
+//每个线程写自己的一份桶，不加锁也没有原子的读-改-写；导出时把各线程的加起来
+class SkyBoxHistogram
+{
+public:
+    static const int32 SubBucketBits = 3;
+    static const int32 SubBuckets = 1 << SubBucketBits;
+    static const int32 Octaves = 40;  //以微秒计，最大约2^40us，十几天
+    static const int32 BucketCount = Octaves * SubBuckets;
+    struct Snapshot
+    {
+        TArray<uint64> buckets;
+        uint64 count;
+        double sum_seconds;
+        double max_seconds;
+        double Percentile(double p) const;
+    };
+public:
+    SkyBoxHistogram();
+    ~SkyBoxHistogram();
+    void Observe(double seconds);
+    Snapshot TakeSnapshot() const;
+    static double BucketUpperSeconds(int32 bucket);
+private:
+    struct Shard;
+    Shard* GetThreadShard();
+    static int32 BucketIndex(uint64 micros);
+private:
+    int32 m_id;  //线程局部的分片表里的下标
+    mutable FCriticalSection m_shards_lock;  //只在线程第一次写、导出时用
+    TArray<Shard*> m_shards;
+};
+
+
+//所有指标都在进程启动时注册，名字按Prometheus的规范
+class SkyBoxMetrics
+{
+public:
+    static SkyBoxCounter& Counter(const TCHAR* name, const TCHAR* help);
+    static SkyBoxHistogram& Histogram(const TCHAR* name, const TCHAR* help);
+    static void Gauge(const TCHAR* name, const TCHAR* help, TFunction<double()> sample);  //导出时才取值
+    static FString ExportPrometheus();
+    struct CounterValue { FString name; double value; };
+    struct HistogramValue { FString name; SkyBoxHistogram::Snapshot snapshot; };
+    static void Collect(TArray<CounterValue>& counters, TArray<CounterValue>& gauges, TArray<HistogramValue>& histograms);
+};
+
+
+//常用的指标，各处直接用
+namespace SkyBoxStats
+{
+    SkyBoxCounter& GenerateRequests();
+    SkyBoxCounter& QueryRequests();
+    SkyBoxCounter& JobsCreated();
+    SkyBoxCounter& CompletedCacheHits();  //相同任务已经做完，直接复用
+    SkyBoxCounter& QueuedHits();  //相同任务还在排队，合并
+    SkyBoxCounter& AdmissionRejected();
+    SkyBoxCounter& JobsSucceeded();
+    SkyBoxCounter& JobsFailed();
+    SkyBoxCounter& JobsCancelled();
+    SkyBoxCounter& FaceRetries();
+    SkyBoxHistogram& QueueWait();
+    SkyBoxHistogram& JobDuration();  //从rig取走到结束
+    SkyBoxHistogram& Stage(const TCHAR* stage);  //Settle、Render、Readback、IBL、Warmup、EncodeWrite，其他的返回一个公共的
+}
@@ -1,10 +1,53 @@
 #include "SkyBoxRPC.h"
 #include "CoreMinimal.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeExit.h"
 #include "Misc/ScopeLock.h"
+#include "SkyBoxTrace.h"
+#include "SkyBoxMetrics.h"
+#include "SkyBoxLog.h"
+#include "SkyBoxJobTrace.h"
 
 
 SkyBoxServiceImpl* SkyBoxServiceImpl::ms_instance = NULL;
 
+
+namespace
+{
+    //一个客户端在一个场景里各画质的等待队列，按入队顺序合起来往后走，不复制队列
+    class WaitingCursor
+    {
+    public:
+        void Init(const std::map<int, std::list<SkyBoxJob*>>& queues)
+        {
+            for (auto& pair : queues)
+                m_ranges.push_back(std::make_pair(pair.second.begin(), pair.second.end()));
+            Select();
+        }
+        SkyBoxJob* Front() const { return *m_ranges[m_current].first; }
+        bool Next()  //走完了返回false
+        {
+            if (++m_ranges[m_current].first == m_ranges[m_current].second)
+                m_ranges.erase(m_ranges.begin() + m_current);
+            return Select();
+        }
+    private:
+        bool Select()
+        {
+            m_current = 0;
+            for (int i = 1; i < (int)m_ranges.size(); ++i)
+            {
+                if ((*m_ranges[i].first)->m_id < (*m_ranges[m_current].first)->m_id)
+                    m_current = i;
+            }
+            return !m_ranges.empty();
+        }
+        std::vector<std::pair<std::list<SkyBoxJob*>::const_iterator, std::list<SkyBoxJob*>::const_iterator>> m_ranges;
+        int m_current;
+    };
+}
+
 void SkyBoxServiceImpl::RunServer()
 {
     UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！SkyBoxServiceImpl::RunServer()"));
@@ -14,18 +57,38 @@ void SkyBoxServiceImpl::RunServer()
     grpc::ServerBuilder builder;
     builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
     SkyBoxServiceImpl::Instance()->AddTestJob();  //测试
+    FString record_path;
+    if (FParse::Value(FCommandLine::Get(), TEXT("SkyBoxRecordJobs="), record_path))
+        SkyBoxJobTrace::Start(record_path);  //-SkyBoxRecordJobs=路径，从开服就记录请求，给SkyBoxReplay用
     builder.RegisterService(SkyBoxServiceImpl::Instance());
-    SkyBoxServiceImpl::Instance()->m_grpc_server = builder.BuildAndStart();
-    UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！RPC Server listening on %s"), server_address.c_str());
-    SkyBoxServiceImpl::Instance()->m_grpc_server->Wait();
+    std::unique_ptr<grpc::Server> server = builder.BuildAndStart();
+    if (!server)
+    {
+        //端口被占用等情况BuildAndStart返回空，RPC线程直接退出，不要崩
+        UE_LOG(LogTemp, Error, TEXT("！！！！！！！！！！SkyBoxServiceImpl::RunServer(), BuildAndStart failed on %S"), server_address.c_str());
+        FScopeLock lock(&SkyBoxServiceImpl::Instance()->m_lock);
+        SkyBoxServiceImpl::Instance()->m_server_failed = true;
+        SkyBoxServiceImpl::Instance()->m_serving = false;
+        return;
+    }
+    grpc::Server* raw_server = server.get();
+    {
+        FScopeLock lock(&SkyBoxServiceImpl::Instance()->m_lock);
+        SkyBoxServiceImpl::Instance()->m_grpc_server = std::move(server);
+        SkyBoxServiceImpl::Instance()->ApplyServingStatus();  //端口先开，健康检查先报NOT_SERVING
+    }
+    UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！RPC Server listening on %S"), server_address.c_str());
+    raw_server->Wait();
 }
 
 void SkyBoxServiceImpl::ShutDownServer()
 {
     UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！SkyBoxServiceImpl::ShutDownServer()"));
+    SkyBoxJobTrace::Stop();
     if (ms_instance != NULL)
     {
-        ms_instance->m_grpc_server->Shutdown();
+        if (ms_instance->m_grpc_server)
+            ms_instance->m_grpc_server->Shutdown();
         ms_instance->m_jobs_completed.clear();  //测试
         ms_instance->m_key2jobs_completed.clear();  //测试
         ms_instance->m_id2jobs_completed.clear();  //测试
@@ -37,17 +100,85 @@ void SkyBoxServiceImpl::ShutDownServer()
 SkyBoxServiceImpl* SkyBoxServiceImpl::Instance()
 {
     if (ms_instance == NULL)
+    {
         ms_instance = new SkyBoxServiceImpl();
+        ms_instance->RegisterGauges();
+    }
     return ms_instance;
 }
 
 SkyBoxServiceImpl::SkyBoxServiceImpl()
 {
     m_next_job_id = 1;
+    m_serving = false;
+    m_server_failed = false;
+    m_scene_count = 1;
+    m_max_queue_depth = 0;
+    m_max_client_inflight = 0;
+    m_queue_depth = 0;
+    m_working_count = 0;
 }
 
 SkyBoxServiceImpl::~SkyBoxServiceImpl()
 {
+    for (std::pair<const int, SkyBoxJob*>& pair : m_id2jobs)
+        delete pair.second;
+    for (SkyBoxJob* job : m_jobs_completed)
+        delete job;
+}
+
+void SkyBoxServiceImpl::SetServing(bool serving)
+{
+    FScopeLock lock(&m_lock);
+    serving = serving && !m_server_failed;
+    if (m_serving == serving)
+        return;
+    UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！SkyBoxServiceImpl::SetServing(), serving = %d"), serving ? 1 : 0);
+    m_serving = serving;
+    ApplyServingStatus();
+}
+
+void SkyBoxServiceImpl::ApplyServingStatus()
+{
+    //调用时已经持有m_lock；服务器还没建好时先记下来，建好后再设置
+    if (!m_grpc_server)
+        return;
+    grpc::HealthCheckServiceInterface* health = m_grpc_server->GetHealthCheckService();
+    if (health == NULL)
+        return;
+    health->SetServingStatus(m_serving);
+    health->SetServingStatus(skybox::SkyBoxService::service_full_name(), m_serving);
+}
+
+void SkyBoxServiceImpl::SetSceneCount(int count)
+{
+    FScopeLock lock(&m_lock);
+    m_scene_count = FMath::Max(count, 1);
+}
+
+void SkyBoxServiceImpl::SetAdmissionLimits(int max_queue_depth, int max_client_inflight)
+{
+    FScopeLock lock(&m_lock);
+    m_max_queue_depth = FMath::Max(max_queue_depth, 0);
+    m_max_client_inflight = FMath::Max(max_client_inflight, 0);
+}
+
+float SkyBoxServiceImpl::SetClientWeight(const std::string& client, float weight)
+{
+    FScopeLock lock(&m_lock);
+    //限制在[m_min_client_weight, m_max_client_weight]，权重太小时GetJob要算很多圈
+    if (weight > 0.0f)
+        m_client_weights[client] = FMath::Clamp(weight, m_min_client_weight, m_max_client_weight);
+    else
+        m_client_weights.erase(client);
+    UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！SkyBoxServiceImpl::SetClientWeight(), client = %S, weight = %.2f"), client.c_str(), GetClientWeight(client));
+    return GetClientWeight(client);
+}
+
+float SkyBoxServiceImpl::GetClientWeight(const std::string& client)
+{
+    std::map<std::string, float>::iterator itr = m_client_weights.find(client);
+    return itr != m_client_weights.end() ? itr->second : 1.0f;
 }
 
 void SkyBoxServiceImpl::AddTestJob()
@@ -61,24 +192,24 @@ void SkyBoxServiceImpl::AddTestJob()
     //key1.z = 235.0f;
     //CreateNewJob(&key1);
 
-    SkyBoxPosition key2;
-    key2.scene_id = 0;
-    key2.x = 329.0f;
-    key2.y = -359.0f;
-    key2.z = 1000.0f;
-    CreateNewJob(&key2);
+    SkyBoxJobKey key2;
+    key2.position.scene_id = 0;
+    key2.position.x = 329.0f;
+    key2.position.y = -359.0f;
+    key2.position.z = 1000.0f;
+    CreateNewJob(&key2, std::string());
 
-    SkyBoxPosition key3;
-    key3.scene_id = 0;
-    key3.x = 100.0f;
-    key3.y = 0.0f;
-    key3.z = 110.0f;
-    CreateNewJob(&key3);
+    SkyBoxJobKey key3;
+    key3.position.scene_id = 0;
+    key3.position.x = 100.0f;
+    key3.position.y = 0.0f;
+    key3.position.z = 110.0f;
+    CreateNewJob(&key3, std::string());
 }
 
 grpc::Status SkyBoxServiceImpl::SayHello(grpc::ServerContext* context, const skybox::HelloRequest* request, skybox::HelloReply* reply)
 {
-    UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！SkyBoxServiceImpl::SayHello(), name = %S"), request->name().c_str());
+    SKYBOX_LOG(Verbose, TEXT("SayHello"), TEXT("name=%S"), request->name().c_str());
     std::string prefix("Hello ");
     reply->set_message(prefix + request->name());
     return grpc::Status::OK;
@@ -86,53 +217,536 @@ grpc::Status SkyBoxServiceImpl::SayHello(grpc::ServerContext* context, const sky
 
 grpc::Status SkyBoxServiceImpl::GenerateSkyBox(grpc::ServerContext* context, const skybox::GenerateSkyBoxRequest* request, skybox::GenerateSkyBoxReply* reply)
 {
-    UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！SkyBoxServiceImpl::GenerateSkyBox(), posotion = (%.1f, %.1f, %.1f)"), request->position().x(), request->position().y(), request->position().z());
-    SkyBoxPosition key;
-    key.scene_id = 0;
-    key.x = request->position().x();
-    key.y = request->position().y();
-    key.z = request->position().z();
+    SKYBOX_LOG(Verbose, TEXT("GenerateSkyBox"), TEXT("scene_id=%d position=(%.1f,%.1f,%.1f) resolution=%d format=%d quality=%d"),
+        request->scene_id(), request->position().x(), request->position().y(), request->position().z(), request->resolution(), (int)request->format(), (int)request->quality());
+    SkyBoxStats::GenerateRequests().Add();
+    SkyBoxJobKey key;
+    key.position.scene_id = request->scene_id();
+    key.position.x = request->position().x();
+    key.position.y = request->position().y();
+    key.position.z = request->position().z();
+    std::string client = ClientID(context);
+    double arrival = FPlatformTime::Seconds();
+    ON_SCOPE_EXIT
+    {
+        //在m_lock释放之后记录，job_id为0表示被拒绝
+        if (SkyBoxJobTrace::IsRecording())
+            SkyBoxJobTrace::RecordGenerate(arrival, client, request->scene_id(), request->position().x(), request->position().y(), request->position().z(),
+                request->resolution(), (int)request->format(), (int)request->quality(), (int)request->ibl(), request->supersede(), reply->job_id());
+    };
     FScopeLock lock(&m_lock);
-    //先从已经完成的里面找
-    std::map<SkyBoxPosition, SkyBoxJob*>::iterator itr = m_key2jobs_completed.find(key);
-    if (itr != m_key2jobs_completed.end())
+    grpc::Status status = MakeSettings(request->scene_id(), request->resolution(), request->format(), request->quality(), request->ibl(), &key.settings);
+    if (!status.ok())
+        return status;
+    //同一个客户端之前的任务都不要了，新位置如果和旧任务一样就留着；别的客户端也在等的任务只是去掉这个客户端的那份
+    //先准入再取消：被拒绝的请求不能把客户端原来的任务也弄没了；准入时算上取消后会腾出来的名额
+    std::vector<SkyBoxJob*> superseded;
+    int released = 0;
+    if (request->supersede())
+    {
+        for (auto& pair : m_id2jobs)
+        {
+            SkyBoxJob* job = pair.second;
+            if (job->m_holders.count(client) == 0 || !(job->Key() < key || key < job->Key()))
+                continue;
+            superseded.push_back(job);
+            if (!job->m_working && job->m_client == client && job->m_holders.size() == 1 && job->m_region_holders.empty())
+                ++released;  //只有这个客户端在等、还在排队，取消后马上出队
+        }
+    }
+    status = Admit(context, client, HasJob(key) ? 0 : 1, released);
+    if (!status.ok())
+        return status;
+    for (SkyBoxJob* job : superseded)
+        CancelJobLocked(job, client, 0);
+    reply->set_job_id(FindOrCreateJob(&key, client, 0));
+    return grpc::Status::OK;
+}
+
+grpc::Status SkyBoxServiceImpl::GenerateRegion(grpc::ServerContext* context, const skybox::GenerateRegionRequest* request, skybox::GenerateRegionReply* reply)
+{
+    SKYBOX_LOG(Verbose, TEXT("GenerateRegion"), TEXT("scene_id=%d min=(%.1f,%.1f,%.1f) max=(%.1f,%.1f,%.1f) spacing=%.1f positions=%d"),
+        request->scene_id(), request->min().x(), request->min().y(), request->min().z(), request->max().x(), request->max().y(), request->max().z(), request->spacing(), request->positions_size());
+    SkyBoxStats::GenerateRequests().Add();
+    std::string client = ClientID(context);
+    double arrival = FPlatformTime::Seconds();
+    ON_SCOPE_EXIT
+    {
+        //记录请求里原样的位置列表，重放时发一样的请求；job_id为0表示被拒绝
+        if (SkyBoxJobTrace::IsRecording())
+        {
+            TArray<FVector> recorded;
+            recorded.Reserve(request->positions_size());
+            for (const skybox::Point& point : request->positions())
+                recorded.Add(FVector(point.x(), point.y(), point.z()));
+            SkyBoxJobTrace::RecordRegion(arrival, client, request->scene_id(), FVector(request->min().x(), request->min().y(), request->min().z()),
+                FVector(request->max().x(), request->max().y(), request->max().z()), request->spacing(), recorded,
+                request->resolution(), (int)request->format(), (int)request->quality(), (int)request->ibl(), reply->job_id());
+        }
+    };
+    //展开成位置列表，相邻两个位置在空间上也挨着，瞬移距离短、流送的东西大多能复用
+    TArray<FVector> positions;
+    if (request->positions_size() > 0)
+    {
+        if (request->positions_size() > m_max_region_size)
+            return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "too many positions");
+        for (const skybox::Point& point : request->positions())
+        {
+            if (!FMath::IsFinite(point.x()) || !FMath::IsFinite(point.y()) || !FMath::IsFinite(point.z()))
+                return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "position is not finite");
+            positions.Add(FVector(point.x(), point.y(), point.z()));
+        }
+        //任意列表按Morton码（Z序）排，空间上接近的排在一起
+        FVector lower = positions[0];
+        FVector upper = positions[0];
+        for (const FVector& position : positions)
+        {
+            lower = lower.ComponentMin(position);
+            upper = upper.ComponentMax(position);
+        }
+        FVector extent = (upper - lower).ComponentMax(FVector(1.0f, 1.0f, 1.0f));
+        auto morton = [lower, extent](const FVector& position) -> uint32
+        {
+            uint32 code = 0;
+            //范围大到float溢出时t可能不是有限值，先夹住再转整数
+            FVector t = (position - lower) / extent;
+            uint32 x = FMath::IsFinite(t.X) ? (uint32)FMath::Clamp(t.X * 1023.0f, 0.0f, 1023.0f) : 0;
+            uint32 y = FMath::IsFinite(t.Y) ? (uint32)FMath::Clamp(t.Y * 1023.0f, 0.0f, 1023.0f) : 0;
+            uint32 z = FMath::IsFinite(t.Z) ? (uint32)FMath::Clamp(t.Z * 1023.0f, 0.0f, 1023.0f) : 0;
+            for (int32 bit = 0; bit < 10; ++bit)
+                code |= (((x >> bit) & 1) << (3 * bit)) | (((y >> bit) & 1) << (3 * bit + 1)) | (((z >> bit) & 1) << (3 * bit + 2));
+            return code;
+        };
+        positions.StableSort([&morton](const FVector& a, const FVector& b) { return morton(a) < morton(b); });
+    }
+    else
+    {
+        float spacing = request->spacing();
+        if (!FMath::IsFinite(spacing) || !(spacing > 0.0f))
+            return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "spacing must be positive");
+        FVector lower(request->min().x(), request->min().y(), request->min().z());
+        FVector upper(request->max().x(), request->max().y(), request->max().z());
+        if (!FMath::IsFinite(lower.X) || !FMath::IsFinite(lower.Y) || !FMath::IsFinite(lower.Z) || !FMath::IsFinite(upper.X) || !FMath::IsFinite(upper.Y) || !FMath::IsFinite(upper.Z))
+            return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "min or max is not finite");
+        if (upper.X < lower.X || upper.Y < lower.Y || upper.Z < lower.Z)
+            return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "min is greater than max");
+        //每个轴先单独和上限比，用double算，乘起来也不会溢出
+        double counts[3];
+        for (int32 axis = 0; axis < 3; ++axis)
+        {
+            counts[axis] = FMath::FloorToDouble(((double)upper[axis] - (double)lower[axis]) / spacing) + 1.0;
+            if (counts[axis] > m_max_region_size)
+                return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "too many grid points");
+        }
+        if (counts[0] * counts[1] * counts[2] > m_max_region_size)
+            return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "too many grid points");
+        int32 count_x = (int32)counts[0];
+        int32 count_y = (int32)counts[1];
+        int32 count_z = (int32)counts[2];
+        //蛇形遍历：每一行、每一层走完掉头，不用跳回起点
+        for (int32 k = 0; k < count_z; ++k)
+        {
+            for (int32 j0 = 0; j0 < count_y; ++j0)
+            {
+                int32 j = (k % 2 == 0) ? j0 : count_y - 1 - j0;
+                for (int32 i0 = 0; i0 < count_x; ++i0)
+                {
+                    int32 i = ((k * count_y + j0) % 2 == 0) ? i0 : count_x - 1 - i0;
+                    positions.Add(lower + FVector(i, j, k) * spacing);
+                }
+            }
+        }
+    }
+    SkyBoxJobKey key;
+    key.position.scene_id = request->scene_id();
+    FScopeLock lock(&m_lock);
+    grpc::Status status = MakeSettings(request->scene_id(), request->resolution(), request->format(), request->quality(), request->ibl(), &key.settings);
+    if (!status.ok())
+        return status;
+    //整个区域要么全部接受，要么全部拒绝，只算真正新增的子任务；列表里重复的位置只算一次
+    int new_jobs = 0;
+    std::set<SkyBoxJobKey> counted;
+    for (const FVector& position : positions)
+    {
+        key.position.x = position.X;
+        key.position.y = position.Y;
+        key.position.z = position.Z;
+        if (!HasJob(key) && counted.insert(key).second)
+            ++new_jobs;
+    }
+    status = Admit(context, client, new_jobs);
+    if (!status.ok())
+        return status;
+    int region_id = GenerateJobID();
+    std::vector<int> children;
+    children.reserve(positions.Num());
+    for (const FVector& position : positions)
     {
-        reply->set_job_id(0);
+        key.position.x = position.X;
+        key.position.y = position.Y;
+        key.position.z = position.Z;
+        children.push_back(FindOrCreateJob(&key, client, region_id));
+    }
+    m_id2regions[region_id] = std::move(children);
+    m_region_owners[region_id] = client;
+    m_regions.push_back(region_id);
+    while (m_regions.size() > m_max_cache_count)
+    {
+        m_id2regions.erase(m_regions.front());
+        m_region_owners.erase(m_regions.front());
+        m_regions.pop_front();
+    }
+    SKYBOX_LOG(Info, TEXT("RegionCreated"), TEXT("job_id=%d child_count=%d"), region_id, positions.Num());
+    reply->set_job_id(region_id);
+    reply->set_child_count(positions.Num());
+    return grpc::Status::OK;
+}
+
+grpc::Status SkyBoxServiceImpl::SetClientWeight(grpc::ServerContext* context, const skybox::SetClientWeightRequest* request, skybox::SetClientWeightReply* reply)
+{
+    double arrival = FPlatformTime::Seconds();
+    reply->set_weight(SetClientWeight(request->client(), request->weight()));
+    if (SkyBoxJobTrace::IsRecording())
+        SkyBoxJobTrace::RecordClientWeight(arrival, ClientID(context), request->client(), request->weight());
+    return grpc::Status::OK;
+}
+
+grpc::Status SkyBoxServiceImpl::CancelJob(grpc::ServerContext* context, const skybox::CancelJobRequest* request, skybox::CancelJobReply* reply)
+{
+    SKYBOX_LOG(Verbose, TEXT("CancelJob"), TEXT("job_id=%d"), request->job_id());
+    int job_id = request->job_id();
+    reply->set_job_id(job_id);
+    std::string client = ClientID(context);
+    double arrival = FPlatformTime::Seconds();
+    ON_SCOPE_EXIT
+    {
+        if (SkyBoxJobTrace::IsRecording())
+            SkyBoxJobTrace::RecordCancel(arrival, client, job_id, (int)reply->job_status());
+    };
+    FScopeLock lock(&m_lock);
+    std::map<int, std::vector<int>>::iterator region = m_id2regions.find(job_id);
+    if (region != m_id2regions.end())
+    {
+        //区域任务：每个还在排队的子任务都去掉这个区域持有的那份，只有提交区域的客户端能取消
+        if (m_region_owners[job_id] != client)
+            return grpc::Status(grpc::StatusCode::PERMISSION_DENIED, "region was submitted by another client");
+        for (int child_id : region->second)
+        {
+            std::map<int, SkyBoxJob*>::iterator itr = m_id2jobs.find(child_id);
+            if (itr != m_id2jobs.end())
+                CancelJobLocked(itr->second, std::string(), job_id);
+        }
+        skybox::QueryJobReply query;
+        QueryRegion(job_id, &query);
+        reply->set_job_status(query.job_status());
         return grpc::Status::OK;
     }
-    //再从排队的中找
-    itr = m_key2jobs.find(key);
-    if (itr != m_key2jobs.end())
+    std::map<int, SkyBoxJob*>::iterator itr = m_id2jobs.find(job_id);
+    if (itr != m_id2jobs.end())
     {
-        SkyBoxJob* job = itr->second;
-        reply->set_job_id(job->m_id);
+        reply->set_job_status(CancelJobLocked(itr->second, client, 0));
         return grpc::Status::OK;
     }
-    //创建新的
-    SkyBoxJob* job = CreateNewJob(&key);
-    reply->set_job_id(job->m_id);
+    itr = m_id2jobs_completed.find(job_id);
+    if (itr != m_id2jobs_completed.end())
+    {
+        reply->set_job_status(itr->second->m_status);  //已经结束的取消不了
+        return grpc::Status::OK;
+    }
+    return grpc::Status(grpc::StatusCode::NOT_FOUND, "job not found");
+}
+
+skybox::JobStatus SkyBoxServiceImpl::CancelJobLocked(SkyBoxJob* job, const std::string& client, int region_id)
+{
+    if (job->m_cancelled)
+        return skybox::JobStatus::Cancelled;
+    //不是调用方持有的（从没请求过，或者已经取消过了）什么都不动
+    size_t released = region_id != 0 ? job->m_region_holders.erase(region_id) : job->m_holders.erase(client);
+    if (released == 0 || job->IsHeld())
+        return job->m_working ? skybox::JobStatus::Working : skybox::JobStatus::Waiting;  //还有别的请求在等
+    SKYBOX_LOG(Info, TEXT("JobCancelled"), TEXT("job_id=%d working=%d"), job->m_id, job->m_working ? 1 : 0);
+    if (job->m_working)
+    {
+        //rig拿着这个任务，等它在面与面之间停下来再通过OnJobCompleted归档
+        job->m_cancelled = true;
+        return skybox::JobStatus::Cancelled;
+    }
+    RemoveFromQueue(job);
+    job->SetStatus(skybox::JobStatus::Cancelled);
+    AddToCompleted(job);
+    return skybox::JobStatus::Cancelled;
+}
+
+grpc::Status SkyBoxServiceImpl::ExportTrace(grpc::ServerContext* context, const skybox::ExportTraceRequest* request, skybox::ExportTraceReply* reply)
+{
+    SKYBOX_LOG(Info, TEXT("ExportTrace"), TEXT("file_name=%S max_events=%d"), request->file_name().c_str(), request->max_events());
+    if (!request->file_name().empty())
+    {
+        //端口对外开放、没有鉴权，只允许写到Saved/Profiling下面
+        FString file_name = FPaths::GetCleanFilename(UTF8_TO_TCHAR(request->file_name().c_str()));
+        if (file_name.IsEmpty() || file_name.Contains(TEXT("..")) || !FPaths::ValidatePath(file_name))
+            return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "bad file name");
+        if (!SkyBoxTrace::ExportChromeTraceToFile(FPaths::ProfilingDir() / file_name))
+            return grpc::Status(grpc::StatusCode::INTERNAL, "failed to write trace file");
+    }
+    int32 count = 0;
+    bool truncated = false;
+    int32 max_events = request->max_events() > 0 ? FMath::Min(request->max_events(), m_max_trace_events) : m_max_trace_events;
+    FString json = SkyBoxTrace::ExportChromeTrace(&count, max_events, &truncated);
+    reply->set_trace_json(TCHAR_TO_UTF8(*json));
+    reply->set_event_count(count);
+    reply->set_truncated(truncated);
     return grpc::Status::OK;
 }
 
+grpc::Status SkyBoxServiceImpl::GetStats(grpc::ServerContext* context, const skybox::GetStatsRequest* request, skybox::GetStatsReply* reply)
+{
+    //gauge取值时要拿m_lock，这里不能先拿
+    TArray<SkyBoxMetrics::CounterValue> counters;
+    TArray<SkyBoxMetrics::CounterValue> gauges;
+    TArray<SkyBoxMetrics::HistogramValue> histograms;
+    SkyBoxMetrics::Collect(counters, gauges, histograms);
+    for (const SkyBoxMetrics::CounterValue& counter : counters)
+    {
+        skybox::MetricValue* value = reply->add_counters();
+        value->set_name(TCHAR_TO_UTF8(*counter.name));
+        value->set_value(counter.value);
+    }
+    for (const SkyBoxMetrics::CounterValue& gauge : gauges)
+    {
+        skybox::MetricValue* value = reply->add_gauges();
+        value->set_name(TCHAR_TO_UTF8(*gauge.name));
+        value->set_value(gauge.value);
+    }
+    for (const SkyBoxMetrics::HistogramValue& histogram : histograms)
+    {
+        skybox::HistogramSummary* summary = reply->add_histograms();
+        summary->set_name(TCHAR_TO_UTF8(*histogram.name));
+        summary->set_count((double)histogram.snapshot.count);
+        summary->set_sum(histogram.snapshot.sum_seconds);
+        summary->set_p50(histogram.snapshot.Percentile(0.50));
+        summary->set_p90(histogram.snapshot.Percentile(0.90));
+        summary->set_p99(histogram.snapshot.Percentile(0.99));
+        summary->set_max(histogram.snapshot.max_seconds);
+    }
+    if (request->prometheus_text())
+        reply->set_prometheus_text(TCHAR_TO_UTF8(*SkyBoxMetrics::ExportPrometheus()));
+    return grpc::Status::OK;
+}
+
+void SkyBoxServiceImpl::RegisterGauges()
+{
+    //单例，和进程同生命周期，gauge里直接用this
+    SkyBoxMetrics::Gauge(TEXT("skybox_queue_depth"), TEXT("Jobs waiting for a rig"), [this]()
+    {
+        FScopeLock lock(&m_lock);
+        return (double)(m_queue_depth - m_working_count);
+    });
+    SkyBoxMetrics::Gauge(TEXT("skybox_jobs_working"), TEXT("Jobs being captured by a rig"), [this]()
+    {
+        FScopeLock lock(&m_lock);
+        return (double)m_working_count;
+    });
+    SkyBoxMetrics::Gauge(TEXT("skybox_clients_inflight"), TEXT("Clients with unfinished jobs"), [this]()
+    {
+        FScopeLock lock(&m_lock);
+        return (double)m_client_inflight.size();
+    });
+    SkyBoxMetrics::Gauge(TEXT("skybox_throughput_jobs_per_second"), TEXT("Completion rate over the last jobs, used for retry-after"), [this]()
+    {
+        FScopeLock lock(&m_lock);
+        return MeasuredThroughput();
+    });
+    SkyBoxMetrics::Gauge(TEXT("skybox_serving"), TEXT("1 when the health service reports SERVING"), [this]()
+    {
+        FScopeLock lock(&m_lock);
+        return m_serving ? 1.0 : 0.0;
+    });
+}
+
+grpc::Status SkyBoxServiceImpl::MakeSettings(int scene_id, int resolution, skybox::ImageFormat format, skybox::QualityPreset quality, skybox::IblMode ibl, SkyBoxCaptureSettings* settings)
+{
+    if (scene_id < 0 || scene_id >= m_scene_count)
+        return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "scene_id out of range");
+    if (resolution < 0 || resolution > m_max_resolution)
+        return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "resolution out of range");
+    if (!skybox::ImageFormat_IsValid(format) || !skybox::QualityPreset_IsValid(quality) || !skybox::IblMode_IsValid(ibl))
+        return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "unknown format, quality or ibl mode");
+    //Draft是预览，完整烘焙要多写几十个文件，默认只投影球谐
+    if (ibl == skybox::IblMode::IblByQuality)
+        ibl = quality == skybox::QualityPreset::Draft ? skybox::IblMode::IblShOnly : skybox::IblMode::IblFull;
+    settings->resolution = resolution;
+    settings->format = format;
+    settings->quality = quality;
+    settings->ibl = ibl;
+    return grpc::Status::OK;
+}
+
+int SkyBoxServiceImpl::FindOrCreateJob(SkyBoxJobKey* key, const std::string& client, int region_id)
+{
+    //先从已经完成的里面找，返回已完成任务的id，客户端可以直接用QueryJob取结果
+    std::map<SkyBoxJobKey, SkyBoxJob*>::iterator itr = m_key2jobs_completed.find(*key);
+    if (itr != m_key2jobs_completed.end())
+    {
+        SkyBoxStats::CompletedCacheHits().Add();
+        return itr->second->m_id;
+    }
+    //再从排队的中找
+    itr = m_key2jobs.find(*key);
+    if (itr != m_key2jobs.end() && !itr->second->m_cancelled)
+    {
+        SkyBoxStats::QueuedHits().Add();
+        if (region_id != 0)
+            itr->second->m_region_holders.insert(region_id);
+        else
+            itr->second->m_holders.insert(client);
+        return itr->second->m_id;
+    }
+    //创建新的；同样的任务正在采集但已经被取消时，新建一个排到后面
+    SkyBoxJob* job = CreateNewJob(key, client);
+    if (region_id != 0)
+        job->m_region_holders.insert(region_id);
+    else
+        job->m_holders.insert(client);
+    ++m_client_inflight[client];
+    SkyBoxStats::JobsCreated().Add();
+    return job->m_id;
+}
+
+bool SkyBoxServiceImpl::HasJob(const SkyBoxJobKey& key)
+{
+    std::map<SkyBoxJobKey, SkyBoxJob*>::iterator itr = m_key2jobs.find(key);
+    if (itr != m_key2jobs.end() && !itr->second->m_cancelled)
+        return true;
+    return m_key2jobs_completed.find(key) != m_key2jobs_completed.end();
+}
+
+grpc::Status SkyBoxServiceImpl::Admit(grpc::ServerContext* context, const std::string& client, int new_jobs, int released)
+{
+    if (new_jobs == 0)
+        return grpc::Status::OK;
+    //超出的部分按最近测到的吞吐估计多久能腾出来
+    int excess = 0;
+    const char* reason = NULL;
+    int queue_depth = m_queue_depth - released;
+    if (m_max_queue_depth > 0 && queue_depth + new_jobs > m_max_queue_depth)
+    {
+        excess = queue_depth + new_jobs - m_max_queue_depth;
+        reason = "queue is full";
+    }
+    int inflight = (m_client_inflight.count(client) ? m_client_inflight[client] : 0) - released;
+    if (m_max_client_inflight > 0 && inflight + new_jobs > m_max_client_inflight)
+    {
+        excess = FMath::Max(excess, inflight + new_jobs - m_max_client_inflight);
+        reason = "too many jobs in flight for this client";
+    }
+    if (reason == NULL)
+        return grpc::Status::OK;
+    SkyBoxStats::AdmissionRejected().Add();
+    if ((m_max_queue_depth > 0 && new_jobs > m_max_queue_depth) || (m_max_client_inflight > 0 && new_jobs > m_max_client_inflight))
+        return grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED, "request is larger than the limit, split it");  //等多久都不会成功，不给retry-after
+    double throughput = MeasuredThroughput();
+    int retry_after = throughput > 0.0 ? FMath::CeilToInt(excess / throughput) : m_default_retry_after;
+    SKYBOX_LOG(Warning, TEXT("AdmitRejected"), TEXT("client=%S new_jobs=%d queue_depth=%d inflight=%d retry_after=%d"),
+        client.c_str(), new_jobs, queue_depth, inflight, retry_after);
+    context->AddTrailingMetadata("retry-after", std::to_string(retry_after));
+    return grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED, std::string(reason) + ", retry after " + std::to_string(retry_after) + "s");
+}
+
+double SkyBoxServiceImpl::MeasuredThroughput()
+{
+    if (m_completion_times.size() < 2)
+        return 0.0;
+    double elapsed = m_completion_times.back() - m_completion_times.front();
+    if (elapsed <= 0.0)
+        return 0.0;
+    return (m_completion_times.size() - 1) / elapsed;
+}
+
+std::string SkyBoxServiceImpl::ClientID(grpc::ServerContext* context)
+{
+    //客户端在metadata里带x-skybox-client，没带的按对端地址（去掉端口）算
+    const std::multimap<grpc::string_ref, grpc::string_ref>& metadata = context->client_metadata();
+    std::multimap<grpc::string_ref, grpc::string_ref>::const_iterator itr = metadata.find("x-skybox-client");
+    if (itr != metadata.end())
+        return std::string(itr->second.data(), itr->second.length());
+    std::string peer = context->peer();
+    size_t colon = peer.rfind(':');
+    if (colon != std::string::npos && colon > peer.find(':'))
+        peer = peer.substr(0, colon);
+    return peer;
+}
+
+bool SkyBoxServiceImpl::QueryRegion(int job_id, skybox::QueryJobReply* reply)
+{
+    std::map<int, std::vector<int>>::iterator region = m_id2regions.find(job_id);
+    if (region == m_id2regions.end())
+        return false;
+    int completed = 0;
+    int failed = 0;
+    int cancelled = 0;
+    bool working = false;
+    for (int child_id : region->second)
+    {
+        reply->add_child_job_ids(child_id);
+        std::map<int, SkyBoxJob*>::iterator itr = m_id2jobs.find(child_id);
+        if (itr != m_id2jobs.end())
+        {
+            working = working || itr->second->m_working;
+            continue;
+        }
+        //不在排队就是结束了；完成缓存里也找不到的和单个任务一样当作成功
+        ++completed;
+        itr = m_id2jobs_completed.find(child_id);
+        if (itr != m_id2jobs_completed.end() && itr->second->m_status == skybox::JobStatus::Failed)
+            ++failed;
+        if (itr != m_id2jobs_completed.end() && itr->second->m_status == skybox::JobStatus::Cancelled)
+            ++cancelled;
+    }
+    int total = (int)region->second.size();
+    reply->set_total_count(total);
+    reply->set_completed_count(completed);
+    reply->set_failed_count(failed + cancelled);
+    if (completed < total)
+        reply->set_job_status(working || completed > 0 ? skybox::JobStatus::Working : skybox::JobStatus::Waiting);
+    else if (cancelled > 0)
+        reply->set_job_status(skybox::JobStatus::Cancelled);
+    else
+        reply->set_job_status(failed > 0 ? skybox::JobStatus::Failed : skybox::JobStatus::Succeeded);
+    return true;
+}
+
 grpc::Status SkyBoxServiceImpl::QueryJob(grpc::ServerContext* context, const skybox::QueryJobRequest* request, skybox::QueryJobReply* reply)
 {
-    UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！SkyBoxServiceImpl::QueryJob(), job_id = %d"), request->job_id());
+    SKYBOX_LOG(Verbose, TEXT("QueryJob"), TEXT("job_id=%d"), request->job_id());
+    SkyBoxStats::QueryRequests().Add();
     int job_id = request->job_id();
     reply->set_job_id(job_id);
+    double arrival = FPlatformTime::Seconds();
+    ON_SCOPE_EXIT
+    {
+        if (SkyBoxJobTrace::IsRecording())
+            SkyBoxJobTrace::RecordQuery(arrival, ClientID(context), job_id, (int)reply->job_status());
+    };
     FScopeLock lock(&m_lock);
+    if (QueryRegion(job_id, reply))
+        return grpc::Status::OK;
     //先从已经完成的里面找
     std::map<int, SkyBoxJob*>::iterator itr = m_id2jobs_completed.find(job_id);
     if (itr != m_id2jobs_completed.end())
     {
         SkyBoxJob* job = itr->second;
         reply->set_job_status(job->m_status);
+        reply->set_ibl_status(job->m_ibl_status);
+        for (float coefficient : job->m_sh_coefficients)
+            reply->add_sh_coefficients(coefficient);
         return grpc::Status::OK;
     }
     //再从排队的中找
     itr = m_id2jobs.find(job_id);
     if (itr != m_id2jobs.end())
     {
-        if (job_id == m_jobs.front()->m_id)
+        if (itr->second->m_working)
             reply->set_job_status(skybox::JobStatus::Working);
         else
             reply->set_job_status(skybox::JobStatus::Waiting);
@@ -143,57 +757,314 @@ grpc::Status SkyBoxServiceImpl::QueryJob(grpc::ServerContext* context, const sky
     return grpc::Status::OK;
 }
 
-SkyBoxJob* SkyBoxServiceImpl::GetJob()
+SkyBoxJob* SkyBoxServiceImpl::GetJob(int scene_id, int quality)
 {
     FScopeLock lock(&m_lock);
-    if (m_jobs.empty())
+    //只看每个客户端等待队列的队首，被取走的任务已经出队了，不用扫整个场景的队列
+    std::map<int, std::map<std::string, QualityQueues>>::iterator scene = m_waiting.find(scene_id);
+    if (scene == m_waiting.end())
         return NULL;
-    SkyBoxJob* job = m_jobs.front();
-    UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！SkyBoxServiceImpl::GetJob(), job_id = %d"), job->m_id);
+    std::map<std::string, SkyBoxJob*> heads;
+    for (auto& pair : scene->second)
+    {
+        SkyBoxJob* head = WaitingHead(pair.second, quality);
+        if (head != NULL)
+            heads[pair.first] = head;
+    }
+    if (heads.empty())
+        return NULL;
+    std::set<std::string> active;
+    for (auto& pair : heads)
+        active.insert(pair.first);
+    SyncRound(active, m_client_round, m_client_deficit);
+    std::string client = NextRoundClient(m_client_round, m_client_deficit);
+    SkyBoxJob* job = heads[client];
+    PopWaiting(job);
+    job->m_working = true;
+    job->m_start_time = FPlatformTime::Seconds();
+    ++m_working_count;
+    SkyBoxTrace::Record(TEXT("QueueWait"), job->m_enqueue_time, job->m_start_time, job->m_id);
+    SkyBoxStats::QueueWait().Observe(job->m_start_time - job->m_enqueue_time);
+    SKYBOX_LOG(Verbose, TEXT("GetJob"), TEXT("job_id=%d client=%S"), job->m_id, job->m_client.c_str());
     return job;
 }
 
+void SkyBoxServiceImpl::SyncRound(const std::set<std::string>& active, std::list<std::string>& round, std::map<std::string, double>& deficits)
+{
+    //现在没活的客户端移出轮转、不攒额度，不然闲一阵之后回来会一下子占满；新来的排到最后
+    std::set<std::string> newcomers = active;
+    for (std::list<std::string>::iterator itr = round.begin(); itr != round.end();)
+    {
+        if (active.count(*itr) > 0)
+        {
+            newcomers.erase(*itr);
+            ++itr;
+        }
+        else
+        {
+            deficits.erase(*itr);
+            itr = round.erase(itr);
+        }
+    }
+    for (const std::string& client : newcomers)
+        round.push_back(client);
+}
+
+std::string SkyBoxServiceImpl::NextRoundClient(std::list<std::string>& round, std::map<std::string, double>& deficits)
+{
+    //赤字轮转（DRR）：轮到的客户端额度够1就取它的任务，不够就加上权重排到后面；长期看各客户端的吞吐和权重成正比
+    //不一圈一圈地转，直接算出每个客户端还要几圈才够1（ceil((1-deficit)/weight)），第一个够的就是下一个被服务的
+    int n = (int)round.size();
+    int64 best_visit = -1;
+    int best_position = 0;
+    int64 best_rounds = 0;
+    int position = 0;
+    for (const std::string& client : round)
+    {
+        double deficit = deficits[client];
+        int64 rounds = deficit >= 1.0 ? 0 : (int64)FMath::CeilToDouble((1.0 - deficit) / GetClientWeight(client));
+        int64 visit = rounds * n + position;
+        if (best_visit < 0 || visit < best_visit)
+        {
+            best_visit = visit;
+            best_position = position;
+            best_rounds = rounds;
+        }
+        ++position;
+    }
+    //排在它前面的客户端比它多轮到一次；转完之后它在队首，前面的都挪到后面
+    position = 0;
+    for (const std::string& client : round)
+    {
+        int64 visits = position < best_position ? best_rounds + 1 : best_rounds;
+        deficits[client] += visits * GetClientWeight(client);
+        ++position;
+    }
+    for (int i = 0; i < best_position; ++i)
+    {
+        round.push_back(round.front());
+        round.pop_front();
+    }
+    std::string client = round.front();
+    deficits[client] = FMath::Max(deficits[client] - 1.0, 0.0);
+    return client;
+}
+
 void SkyBoxServiceImpl::OnJobCompleted(SkyBoxJob* job)
 {
-    UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！SkyBoxServiceImpl::OnJobCompleted(), job_id = %d"), job->m_id);
     FScopeLock lock(&m_lock);
-    if (job == NULL || m_jobs.empty())
+    if (job == NULL || m_id2jobs.find(job->m_id) == m_id2jobs.end())
         return;
-    if (job != m_jobs.front())
+    SKYBOX_LOG(Verbose, TEXT("OnJobCompleted"), TEXT("job_id=%d"), job->m_id);
+    RemoveFromQueue(job);
+    --m_working_count;
+    SkyBoxStats::JobDuration().Observe(FPlatformTime::Seconds() - job->m_start_time);
+    m_completion_times.push_back(FPlatformTime::Seconds());
+    if (m_completion_times.size() > m_throughput_window)
+        m_completion_times.pop_front();
+    AddToCompleted(job);
+}
+
+void SkyBoxServiceImpl::RequeueJob(SkyBoxJob* job)
+{
+    FScopeLock lock(&m_lock);
+    if (job == NULL || m_id2jobs.find(job->m_id) == m_id2jobs.end())
         return;
-    m_jobs.pop_front();
-    m_key2jobs.erase(job->m_position);
+    SKYBOX_LOG(Info, TEXT("JobRequeued"), TEXT("job_id=%d cancelled=%d"), job->m_id, job->m_cancelled ? 1 : 0);
+    --m_working_count;
+    if (job->m_cancelled)
+    {
+        //已经没人要了，直接归档
+        RemoveFromQueue(job);
+        job->SetStatus(skybox::JobStatus::Cancelled);
+        AddToCompleted(job);
+        return;
+    }
+    //按入队顺序放回原来的位置；已经写出的面下次重采覆盖
+    job->m_working = false;
+    job->m_start_time = 0.0;
+    PushWaiting(job);
+    job->SetStatus(skybox::JobStatus::Waiting);
+}
+
+bool SkyBoxServiceImpl::IsJobCancelled(SkyBoxJob* job)
+{
+    FScopeLock lock(&m_lock);
+    return job->m_cancelled;
+}
+
+void SkyBoxServiceImpl::RemoveFromQueue(SkyBoxJob* job)
+{
+    if (!job->m_working)
+        PopWaiting(job);
+    //被取消的任务可能已经有一个同样的新任务占了这个key
+    std::map<SkyBoxJobKey, SkyBoxJob*>::iterator itr = m_key2jobs.find(job->Key());
+    if (itr != m_key2jobs.end() && itr->second == job)
+        m_key2jobs.erase(itr);
     m_id2jobs.erase(job->m_id);
+    --m_queue_depth;
+    if (!job->m_client.empty() && --m_client_inflight[job->m_client] <= 0)
+        m_client_inflight.erase(job->m_client);
+}
+
+void SkyBoxServiceImpl::AddToCompleted(SkyBoxJob* job)
+{
+    if (job->m_status == skybox::JobStatus::Succeeded)
+        SkyBoxStats::JobsSucceeded().Add();
+    else if (job->m_status == skybox::JobStatus::Cancelled)
+        SkyBoxStats::JobsCancelled().Add();
+    else
+        SkyBoxStats::JobsFailed().Add();
     m_jobs_completed.push_back(job);
-    m_key2jobs_completed[job->m_position] = job;
+    //取消的任务只能按id查，同样的新请求要重新采
+    if (job->m_status != skybox::JobStatus::Cancelled)
+        m_key2jobs_completed[job->Key()] = job;
     m_id2jobs_completed[job->m_id] = job;
     //CACHE
     while (m_jobs_completed.size() > m_max_cache_count)
     {
         SkyBoxJob* job2delete = m_jobs_completed.front();
         m_jobs_completed.pop_front();
-        m_key2jobs_completed.erase(job2delete->m_position);
+        std::map<SkyBoxJobKey, SkyBoxJob*>::iterator itr = m_key2jobs_completed.find(job2delete->Key());
+        if (itr != m_key2jobs_completed.end() && itr->second == job2delete)
+            m_key2jobs_completed.erase(itr);
         m_id2jobs_completed.erase(job2delete->m_id);
         delete job2delete;
     }
 }
 
+void SkyBoxServiceImpl::PeekWaitingPositions(int scene_id, int count, TArray<SkyBoxPosition>& positions)
+{
+    FScopeLock lock(&m_lock);
+    positions.Reset();
+    std::map<int, std::map<std::string, QualityQueues>>::iterator scene = m_waiting.find(scene_id);
+    if (scene == m_waiting.end())
+        return;
+    //按GetJob的赤字轮转在轮转和额度的副本上模拟出接下来的顺序，不然多个客户端排队时预流送的位置不对
+    //每帧都会调用：队列本身不复制，每个客户端只记一个游标，最多往后走count个
+    std::map<std::string, WaitingCursor> cursors;
+    for (auto& pair : scene->second)
+        cursors[pair.first].Init(pair.second);
+    std::list<std::string> round = m_client_round;
+    std::map<std::string, double> deficits = m_client_deficit;
+    while ((int)positions.Num() < count && !cursors.empty())
+    {
+        std::set<std::string> active;
+        for (auto& pair : cursors)
+            active.insert(pair.first);
+        SyncRound(active, round, deficits);
+        std::string client = NextRoundClient(round, deficits);
+        WaitingCursor& cursor = cursors[client];
+        positions.Add(cursor.Front()->m_position);
+        if (!cursor.Next())
+            cursors.erase(client);
+    }
+}
+
+int SkyBoxServiceImpl::PickScene(const TArray<int32>& preferred, int exclude)
+{
+    FScopeLock lock(&m_lock);
+    //每帧都会调用，只看每个场景的计数，不扫队列
+    //已经加载着的场景切过去最便宜，按最近用过的顺序挑
+    for (int32 scene_id : preferred)
+    {
+        if (scene_id != exclude && m_scene_waiting.count(scene_id) > 0)
+            return scene_id;
+    }
+    //否则挑排队最多的，一次切换多干点活
+    int best = -1;
+    int best_count = 0;
+    for (auto& pair : m_scene_waiting)
+    {
+        if (pair.first != exclude && pair.second > best_count)
+        {
+            best = pair.first;
+            best_count = pair.second;
+        }
+    }
+    return best;
+}
+
+void SkyBoxServiceImpl::AddSceneWaiting(int scene_id, int delta)
+{
+    int& count = m_scene_waiting[scene_id];
+    count += delta;
+    if (count <= 0)
+        m_scene_waiting.erase(scene_id);
+}
+
+void SkyBoxServiceImpl::PushWaiting(SkyBoxJob* job)
+{
+    //job_id按创建顺序递增，从队尾往前找插入位置；新任务直接放在队尾，只有放回的任务要往前找
+    std::list<SkyBoxJob*>& queue = m_waiting[job->m_position.scene_id][job->m_client][(int)job->m_settings.quality];
+    std::list<SkyBoxJob*>::iterator itr = queue.end();
+    while (itr != queue.begin())
+    {
+        --itr;
+        if ((*itr)->m_id < job->m_id)
+        {
+            ++itr;
+            break;
+        }
+    }
+    job->m_waiting_itr = queue.insert(itr, job);
+    AddSceneWaiting(job->m_position.scene_id, 1);
+}
+
+void SkyBoxServiceImpl::PopWaiting(SkyBoxJob* job)
+{
+    int scene_id = job->m_position.scene_id;
+    std::map<std::string, QualityQueues>& clients = m_waiting[scene_id];
+    QualityQueues& queues = clients[job->m_client];
+    std::list<SkyBoxJob*>& queue = queues[(int)job->m_settings.quality];
+    queue.erase(job->m_waiting_itr);
+    if (queue.empty())
+        queues.erase((int)job->m_settings.quality);
+    if (queues.empty())
+        clients.erase(job->m_client);
+    if (clients.empty())
+        m_waiting.erase(scene_id);
+    AddSceneWaiting(scene_id, -1);
+}
+
+SkyBoxJob* SkyBoxServiceImpl::WaitingHead(const QualityQueues& queues, int quality)
+{
+    if (quality >= 0)
+    {
+        QualityQueues::const_iterator itr = queues.find(quality);
+        return itr != queues.end() ? itr->second.front() : NULL;
+    }
+    //画质最多三档，比较各自的队首
+    SkyBoxJob* head = NULL;
+    for (auto& pair : queues)
+    {
+        if (head == NULL || pair.second.front()->m_id < head->m_id)
+            head = pair.second.front();
+    }
+    return head;
+}
+
 int SkyBoxServiceImpl::GenerateJobID()
 {
-    while (m_id2jobs.find(m_next_job_id) != m_id2jobs.end() || m_id2jobs_completed.find(m_next_job_id) != m_id2jobs_completed.end())
+    while (m_id2jobs.find(m_next_job_id) != m_id2jobs.end() || m_id2jobs_completed.find(m_next_job_id) != m_id2jobs_completed.end() || m_id2regions.find(m_next_job_id) != m_id2regions.end())
         ++m_next_job_id;
     int id = m_next_job_id;
     ++m_next_job_id;
     return id;
 }
 
-SkyBoxJob* SkyBoxServiceImpl::CreateNewJob(SkyBoxPosition* key)
+SkyBoxJob* SkyBoxServiceImpl::CreateNewJob(SkyBoxJobKey* key, const std::string& client)
 {
     SkyBoxJob* job = new SkyBoxJob();
     job->m_id = SkyBoxServiceImpl::GenerateJobID();
-    job->m_position = *key;
-    m_jobs.push_back(job);
-    m_key2jobs[job->m_position] = job;
+    job->m_position = key->position;
+    job->m_settings = key->settings;
+    job->m_client = client;
+    job->m_enqueue_time = FPlatformTime::Seconds();
+    PushWaiting(job);
+    ++m_queue_depth;
+    //和正在采集、已被取消的同样任务重名时，key指向新的这个
+    m_key2jobs[*key] = job;
     m_id2jobs[job->m_id] = job;
     return job;
 }
@@ -201,8 +1072,21 @@ SkyBoxJob* SkyBoxServiceImpl::CreateNewJob(SkyBoxPosition* key)
 
 SkyBoxJob::SkyBoxJob()
 {
+    m_working = false;
+    m_cancelled = false;
+    m_ibl_status = skybox::IblStatus::IblNotBaked;
+    m_enqueue_time = 0.0;
+    m_start_time = 0.0;
 }
 
 SkyBoxJob::~SkyBoxJob()
 {
+}
+
+SkyBoxJobKey SkyBoxJob::Key() const
+{
+    SkyBoxJobKey key;
+    key.position = m_position;
+    key.settings = m_settings;
+    return key;
 }
\ No newline at end of file
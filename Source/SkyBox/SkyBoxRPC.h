@@ -1,10 +1,13 @@
 #pragma once
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include <string>
 #include <map>
 #include <list>
+#include <set>
+#include <vector>
 #include "CoreMinimal.h"
 #pragma warning (push)
 #pragma warning (disable : 4800)
@@ -22,7 +25,8 @@
 #pragma warning( pop )
 
 
-struct SkyBoxPosition;
+struct SkyBoxJobKey;
+struct SkyBoxCaptureSettings;
 class SkyBoxJob;
 class SkyBoxServiceImpl final : public skybox::SkyBoxService::Service
 {
@@ -30,32 +34,92 @@ public:
     static void RunServer();
     static void ShutDownServer();
     static SkyBoxServiceImpl* Instance();
+    void SetServing(bool serving);  //健康检查的状态，渲染器预热好、rig建好之前是NOT_SERVING
 private:
+    friend class SkyBoxServiceTest;  //自动化测试建自己的实例，不注册gauge也不开端口
     SkyBoxServiceImpl();
+    void ApplyServingStatus();
     static SkyBoxServiceImpl* ms_instance;
     std::unique_ptr<grpc::Server> m_grpc_server;
+    bool m_serving;
+    bool m_server_failed;  //端口没开起来，之后一直是NOT_SERVING
 public:
     ~SkyBoxServiceImpl();
     void AddTestJob();
     grpc::Status SayHello(grpc::ServerContext* context, const skybox::HelloRequest* request, skybox::HelloReply* reply) override;
     grpc::Status GenerateSkyBox(grpc::ServerContext* context, const skybox::GenerateSkyBoxRequest* request, skybox::GenerateSkyBoxReply* reply) override;
     grpc::Status QueryJob(grpc::ServerContext* context, const skybox::QueryJobRequest* request, skybox::QueryJobReply* reply) override;
-    SkyBoxJob* GetJob();
+    grpc::Status GenerateRegion(grpc::ServerContext* context, const skybox::GenerateRegionRequest* request, skybox::GenerateRegionReply* reply) override;
+    grpc::Status SetClientWeight(grpc::ServerContext* context, const skybox::SetClientWeightRequest* request, skybox::SetClientWeightReply* reply) override;
+    grpc::Status CancelJob(grpc::ServerContext* context, const skybox::CancelJobRequest* request, skybox::CancelJobReply* reply) override;
+    grpc::Status ExportTrace(grpc::ServerContext* context, const skybox::ExportTraceRequest* request, skybox::ExportTraceReply* reply) override;
+    grpc::Status GetStats(grpc::ServerContext* context, const skybox::GetStatsRequest* request, skybox::GetStatsReply* reply) override;
+    void SetSceneCount(int count);  //scene_id的合法范围是[0, count)
+    void SetAdmissionLimits(int max_queue_depth, int max_client_inflight);  //0表示不限
+    float SetClientWeight(const std::string& client, float weight);  //返回生效的权重
+    SkyBoxJob* GetJob(int scene_id, int quality);  //quality小于0表示不限画质；多个客户端之间按权重轮转
     void OnJobCompleted(SkyBoxJob* job);
+    void RequeueJob(SkyBoxJob* job);  //rig还没采完就要被删掉（换地图），任务放回队列等别的rig再取
+    bool IsJobCancelled(SkyBoxJob* job);  //rig在每个面开始前问一下
+    void PeekWaitingPositions(int scene_id, int count, TArray<SkyBoxPosition>& positions);  //这个场景接下来会被GetJob按顺序取走的count个任务的位置（不考虑画质限制）
+    int PickScene(const TArray<int32>& preferred, int exclude);  //下一个该切过去的场景，没有活就返回-1
 private:
     int GenerateJobID();
-    SkyBoxJob* CreateNewJob(SkyBoxPosition* key);
+    SkyBoxJob* CreateNewJob(SkyBoxJobKey* key, const std::string& client);
+    grpc::Status MakeSettings(int scene_id, int resolution, skybox::ImageFormat format, skybox::QualityPreset quality, skybox::IblMode ibl, SkyBoxCaptureSettings* settings);  //调用时已经持有m_lock
+    int FindOrCreateJob(SkyBoxJobKey* key, const std::string& client, int region_id);  //已完成、排队中的相同任务直接复用，region_id不为0时由区域任务持有；调用时已经持有m_lock
+    bool HasJob(const SkyBoxJobKey& key);
+    grpc::Status Admit(grpc::ServerContext* context, const std::string& client, int new_jobs, int released = 0);  //队列满了返回RESOURCE_EXHAUSTED，带上估计的retry-after；released是这个请求通过后会腾出的这个客户端的排队任务数；调用时已经持有m_lock
+    double MeasuredThroughput();  //最近完成的任务数/秒，还没测出来时返回0
+    static std::string ClientID(grpc::ServerContext* context);
+    float GetClientWeight(const std::string& client);
+    bool QueryRegion(int job_id, skybox::QueryJobReply* reply);
+    skybox::JobStatus CancelJobLocked(SkyBoxJob* job, const std::string& client, int region_id);  //只去掉调用方自己持有的那份，重复调用不再减；调用时已经持有m_lock
+    void RemoveFromQueue(SkyBoxJob* job);  //调用时已经持有m_lock
+    void AddToCompleted(SkyBoxJob* job);  //调用时已经持有m_lock
+    void AddSceneWaiting(int scene_id, int delta);  //调用时已经持有m_lock
+    void PushWaiting(SkyBoxJob* job);  //按入队顺序放回这个客户端的等待队列；调用时已经持有m_lock
+    void PopWaiting(SkyBoxJob* job);  //调用时已经持有m_lock
+    void SyncRound(const std::set<std::string>& active, std::list<std::string>& round, std::map<std::string, double>& deficits);  //轮转里只留active的客户端，新来的排到最后
+    std::string NextRoundClient(std::list<std::string>& round, std::map<std::string, double>& deficits);  //DRR下一个该服务的客户端，round不能为空；调用时已经持有m_lock
+    void RegisterGauges();
 private:
     int m_next_job_id;
     FCriticalSection m_lock;
-    std::list<SkyBoxJob*> m_jobs;
-    std::map<SkyBoxPosition, SkyBoxJob*> m_key2jobs;
+    int m_scene_count;
+    typedef std::map<int, std::list<SkyBoxJob*>> QualityQueues;  //画质 -> 还没被取走的任务，按入队顺序
+    static SkyBoxJob* WaitingHead(const QualityQueues& queues, int quality);  //quality小于0时取各画质里最早入队的
+    std::map<int, std::map<std::string, QualityQueues>> m_waiting;  //每个场景、每个客户端的等待队列，GetJob只看队首；空的不留
+    std::map<int, int> m_scene_waiting;  //每个场景还没被取走的任务数，入队、被取走、移出队列时更新，没有的不留
+    std::map<SkyBoxJobKey, SkyBoxJob*> m_key2jobs;
     std::map<int, SkyBoxJob*> m_id2jobs;
 private:
     static const int m_max_cache_count = 1000;
+    static const int m_max_resolution = 16384;
+    static const int m_max_trace_events = 20000;  //每条一百多字节，ExportTrace的回复不超过gRPC默认的4MB
     std::list<SkyBoxJob*> m_jobs_completed;
-    std::map<SkyBoxPosition, SkyBoxJob*> m_key2jobs_completed;
+    std::map<SkyBoxJobKey, SkyBoxJob*> m_key2jobs_completed;
     std::map<int, SkyBoxJob*> m_id2jobs_completed;
+private:
+    static const int m_max_region_size = 100000;
+    std::list<int> m_regions;  //按创建顺序，超过m_max_cache_count个时丢掉最早的
+    std::map<int, std::vector<int>> m_id2regions;  //区域任务id -> 子任务id，按采集顺序
+    std::map<int, std::string> m_region_owners;  //区域任务id -> 提交的客户端，只有它能取消
+private:
+    static const int m_throughput_window = 64;
+    static const int m_default_retry_after = 60;  //秒，还没测出吞吐时用
+    int m_max_queue_depth;
+    int m_max_client_inflight;
+    int m_queue_depth;
+    std::map<std::string, int> m_client_inflight;  //每个客户端还没完成的任务数
+    std::list<double> m_completion_times;  //最近m_throughput_window个任务的完成时间
+    int m_working_count;  //正在被rig采集的任务数
+private:
+    static constexpr float m_min_client_weight = 0.01f;
+    static constexpr float m_max_client_weight = 100.0f;
+    std::map<std::string, float> m_client_weights;  //没配的客户端权重是1
+    std::map<std::string, double> m_client_deficit;  //DRR每个客户端攒下的额度，取一个任务花1
+    std::list<std::string> m_client_round;  //DRR的轮转顺序
 };
 
 
@@ -84,6 +148,42 @@ struct SkyBoxPosition
 };
 
 
+//每个请求自己的采集参数，和位置一起作为去重的key
+struct SkyBoxCaptureSettings
+{
+    SkyBoxCaptureSettings() : resolution(0), format(skybox::ImageFormat::ServerDefault), quality(skybox::QualityPreset::Standard), ibl(skybox::IblMode::IblFull) {}
+    int resolution;  //每个面的边长，0表示服务器默认
+    skybox::ImageFormat format;
+    skybox::QualityPreset quality;
+    skybox::IblMode ibl;  //已经按画质解析过，不会是IblByQuality
+    bool operator < (const SkyBoxCaptureSettings& rhs) const
+    {
+        if (this->resolution != rhs.resolution)
+            return this->resolution < rhs.resolution;
+        if (this->format != rhs.format)
+            return this->format < rhs.format;
+        if (this->quality != rhs.quality)
+            return this->quality < rhs.quality;
+        return this->ibl < rhs.ibl;
+    }
+};
+
+
+struct SkyBoxJobKey
+{
+    SkyBoxPosition position;
+    SkyBoxCaptureSettings settings;
+    bool operator < (const SkyBoxJobKey& rhs) const
+    {
+        if (this->position < rhs.position)
+            return true;
+        if (rhs.position < this->position)
+            return false;
+        return this->settings < rhs.settings;
+    }
+};
+
+
 class SkyBoxJob
 {
 public:
@@ -91,10 +191,24 @@ public:
     ~SkyBoxJob();
     int JobID() { return m_id; }
     void SetStatus(skybox::JobStatus status) { m_status = status; }
+    SkyBoxJobKey Key() const;
 public:
     int m_id;
+    bool m_working;  //已经被某个rig取走
+    bool m_cancelled;  //正在采集时被取消，rig在下一个面开始前停下
+    //谁在等它：直接请求的客户端和区域任务，同一个客户端重复请求只算一份；都取消了才真的取消
+    std::set<std::string> m_holders;
+    std::set<int> m_region_holders;
+    bool IsHeld() const { return !m_holders.empty() || !m_region_holders.empty(); }
+    std::string m_client;  //提交这个任务的客户端，用来算每个客户端的在途任务数
+    double m_enqueue_time;  //FPlatformTime::Seconds()，算排队时间用
+    double m_start_time;  //被rig取走的时间，算采集耗时用
+    std::list<SkyBoxJob*>::iterator m_waiting_itr;  //在等待队列里的位置，m_working时无效
     SkyBoxPosition m_position;
+    SkyBoxCaptureSettings m_settings;
     skybox::JobStatus m_status;
+    TArray<float> m_sh_coefficients;  //L2球谐，9个系数 x RGB
+    skybox::IblStatus m_ibl_status;
 };
 
 
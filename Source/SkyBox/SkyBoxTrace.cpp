@@ -0,0 +1,124 @@
+#include "SkyBoxTrace.h"
+#include "CoreMinimal.h"
+#include "HAL/PlatformTLS.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Templates/Atomic.h"
+
+
+namespace
+{
+    struct SkyBoxTraceEvent
+    {
+        const TCHAR* name;
+        double start;
+        double end;
+        int32 job_id;
+    };
+
+    struct SkyBoxTraceRing
+    {
+        uint32 thread_id;
+        TAtomic<uint32> written;  //一共写过多少条，只有所属线程写
+        SkyBoxTraceEvent events[SkyBoxTrace::RingCapacity];
+    };
+
+    //只在线程第一次记录时加锁注册，之后各写各的
+    FCriticalSection& RingsLock()
+    {
+        static FCriticalSection lock;
+        return lock;
+    }
+
+    TArray<SkyBoxTraceRing*>& Rings()
+    {
+        static TArray<SkyBoxTraceRing*> rings;
+        return rings;
+    }
+
+    thread_local SkyBoxTraceRing* t_ring = NULL;
+
+    SkyBoxTraceRing* GetThreadRing()
+    {
+        if (t_ring == NULL)
+        {
+            SkyBoxTraceRing* ring = new SkyBoxTraceRing();
+            ring->thread_id = FPlatformTLS::GetCurrentThreadId();
+            ring->written = 0;
+            FScopeLock lock(&RingsLock());
+            Rings().Add(ring);
+            t_ring = ring;
+        }
+        return t_ring;
+    }
+
+    FAutoConsoleCommand GExportTraceCommand(
+        TEXT("SkyBox.ExportTrace"),
+        TEXT("把采集各阶段的耗时导出成Chrome trace，参数是文件路径，默认写到Saved/Profiling"),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& args)
+        {
+            FString path = args.Num() > 0 ? args[0] : FPaths::ProfilingDir() / FString::Printf(TEXT("SkyBoxTrace_%s.json"), *FDateTime::Now().ToString());
+            SkyBoxTrace::ExportChromeTraceToFile(path);
+        }));
+}
+
+
+void SkyBoxTrace::Record(const TCHAR* name, double start_seconds, double end_seconds, int32 job_id)
+{
+    SkyBoxTraceRing* ring = GetThreadRing();
+    uint32 index = ring->written.Load(EMemoryOrder::Relaxed);
+    SkyBoxTraceEvent& event = ring->events[index % RingCapacity];
+    event.name = name;
+    event.start = start_seconds;
+    event.end = end_seconds;
+    event.job_id = job_id;
+    ring->written.Store(index + 1);
+}
+
+FString SkyBoxTrace::ExportChromeTrace(int32* event_count, int32 max_events, bool* truncated)
+{
+    //导出时写线程还在继续写，最旧的几条可能正被覆盖；只是诊断用，不值得为此加锁
+    TArray<TPair<uint32, SkyBoxTraceEvent>> events;
+    {
+        FScopeLock lock(&RingsLock());
+        for (SkyBoxTraceRing* ring : Rings())
+        {
+            uint32 written = ring->written.Load();
+            uint32 first = written > (uint32)RingCapacity ? written - RingCapacity : 0;
+            for (uint32 i = first; i < written; ++i)
+                events.Add(TPair<uint32, SkyBoxTraceEvent>(ring->thread_id, ring->events[i % RingCapacity]));
+        }
+    }
+    bool cut = max_events > 0 && events.Num() > max_events;
+    if (cut)
+    {
+        events.Sort([](const TPair<uint32, SkyBoxTraceEvent>& a, const TPair<uint32, SkyBoxTraceEvent>& b) { return a.Value.end > b.Value.end; });
+        events.SetNum(max_events);
+    }
+    FString json = TEXT("{\"traceEvents\":[");
+    for (int32 i = 0; i < events.Num(); ++i)
+    {
+        const SkyBoxTraceEvent& event = events[i].Value;
+        if (i > 0)
+            json += TEXT(",");
+        json += FString::Printf(TEXT("{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.1f,\"dur\":%.1f,\"pid\":1,\"tid\":%u,\"args\":{\"job_id\":%d}}"),
+            event.name, event.start * 1000000.0, (event.end - event.start) * 1000000.0, events[i].Key, event.job_id);
+    }
+    json += TEXT("]}");
+    if (event_count != NULL)
+        *event_count = events.Num();
+    if (truncated != NULL)
+        *truncated = cut;
+    return json;
+}
+
+bool SkyBoxTrace::ExportChromeTraceToFile(const FString& path)
+{
+    int32 count = 0;
+    FString json = ExportChromeTrace(&count);
+    bool ok = FFileHelper::SaveStringToFile(json, *path, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+    UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！SkyBoxTrace::ExportChromeTraceToFile(), %s, events = %d, %s"), *path, count, ok ? TEXT("OK") : TEXT("FAIL"));
+    return ok;
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+
+
+//采集流水线各阶段的耗时记录：每个线程一个环形缓冲，写的时候不加锁，导出成Chrome trace（chrome://tracing）
+class SkyBoxTrace
+{
+public:
+    //name必须是静态字符串，只存指针；job_id为0表示不属于任何任务
+    static void Record(const TCHAR* name, double start_seconds, double end_seconds, int32 job_id);
+    //max_events大于0时只导出最近（按结束时间）这么多条，截掉时truncated置true
+    static FString ExportChromeTrace(int32* event_count = NULL, int32 max_events = 0, bool* truncated = NULL);
+    static bool ExportChromeTraceToFile(const FString& path);
+public:
+    static const int32 RingCapacity = 8192;  //每个线程只留最近这么多条
+};
+
+
+class SkyBoxScopedTimer
+{
+public:
+    SkyBoxScopedTimer(const TCHAR* name, int32 job_id) : m_name(name), m_job_id(job_id), m_start(FPlatformTime::Seconds()) {}
+    ~SkyBoxScopedTimer() { SkyBoxTrace::Record(m_name, m_start, FPlatformTime::Seconds(), m_job_id); }
+private:
+    const TCHAR* m_name;
+    int32 m_job_id;
+    double m_start;
+};
+
+#define SKYBOX_TRACE_SCOPE(name, job_id) SkyBoxScopedTimer PREPROCESSOR_JOIN(skybox_trace_, __LINE__)(name, job_id)
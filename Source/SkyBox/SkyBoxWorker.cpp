@@ -56,7 +56,7 @@ bool SkyBoxWorker::Init()
 uint32 SkyBoxWorker::Run()
 {
     UE_LOG(LogTemp, Warning, TEXT("！！！！！！！！！！SkyBoxWorker::Run()"));
-    FPlatformProcess::Sleep(5.0f);
+    //不再等固定时间，直接开端口；什么时候能接活由ASkyBoxCharacter通过健康检查告诉外面
     SkyBoxServiceImpl::RunServer();
     return 0;
 }
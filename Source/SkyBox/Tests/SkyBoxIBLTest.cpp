@@ -0,0 +1,108 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "SkyBoxIBL.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+//SkyBoxIBL的友元，过滤核是私有的
+class SkyBoxIBLTest
+{
+public:
+    //返回按权重平均的cos(theta)，核越宽越小
+    static bool CheckSpecularKernel(FAutomationTestBase& test, float roughness, float& mean_cos)
+    {
+        TArray<SkyBoxIBL::KernelSample> kernel;
+        SkyBoxIBL::BuildSpecularKernel(roughness, kernel);
+        if (!test.TestTrue(*FString::Printf(TEXT("roughness %.2f has samples"), roughness), kernel.Num() > 0))
+            return false;
+        float total_weight = 0.0f;
+        mean_cos = 0.0f;
+        bool ok = true;
+        for (const SkyBoxIBL::KernelSample& sample : kernel)
+        {
+            ok = ok && sample.m_direction.IsNormalized() && sample.m_direction.Z > 0.0f && sample.m_weight > 0.0f && FMath::IsFinite(sample.m_lod);
+            total_weight += sample.m_weight;
+            mean_cos += sample.m_weight * sample.m_direction.Z;
+        }
+        test.TestTrue(*FString::Printf(TEXT("roughness %.2f samples are unit, upper hemisphere, finite"), roughness), ok);
+        test.TestEqual(*FString::Printf(TEXT("roughness %.2f weights sum to 1"), roughness), total_weight, 1.0f, 1e-4f);
+        return true;
+    }
+};
+
+
+namespace
+{
+    //和SkyBoxCaptureRig采集时的六个方向一致
+    void MakeSixDirections(TArray<FRotator>& directions)
+    {
+        directions.Push(FRotator(0.0f, 0.0f, 0.0f));
+        directions.Push(FRotator(0.0f, 90.0f, 0.0f));
+        directions.Push(FRotator(0.0f, 180.0f, 0.0f));
+        directions.Push(FRotator(0.0f, -90.0f, 0.0f));
+        directions.Push(FRotator(90.0f, 0.0f, 0.0f));
+        directions.Push(FRotator(-90.0f, 0.0f, 0.0f));
+    }
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSkyBoxIBLProjectSHTest, "SkyBox.IBL.ProjectSH", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSkyBoxIBLProjectSHTest::RunTest(const FString& Parameters)
+{
+    TArray<FRotator> directions;
+    MakeSixDirections(directions);
+    //radiance = (1 + z, 1, 0)：解析解是 R的L0 = 0.282095 * 4PI，R的L1(z) = 0.488603 * 4PI / 3，G只有L0，其余系数都是0
+    SkyBoxCubemap cube;
+    cube.Init(SkyBoxIBL::SHSourceSize, 90.0f, directions);
+    for (int32 face = 0; face < 6; ++face)
+    {
+        for (int32 y = 0; y < cube.m_size; ++y)
+        {
+            for (int32 x = 0; x < cube.m_size; ++x)
+            {
+                FVector d = cube.TexelDirection(face, x + 0.5f, y + 0.5f);
+                cube.m_faces[face][y * cube.m_size + x] = FLinearColor(1.0f + d.Z, 1.0f, 0.0f, 0.0f);
+            }
+        }
+    }
+    TArray<float> sh;
+    SkyBoxIBL::ProjectSH(cube, sh);
+    if (!TestTrue(TEXT("coefficient count"), sh.Num() == SkyBoxIBL::SHCoefficientCount * 3))
+        return false;
+    const float tolerance = 0.01f;
+    for (int32 i = 0; i < SkyBoxIBL::SHCoefficientCount; ++i)
+    {
+        float expected_r = i == 0 ? 0.282095f * 4.0f * PI : (i == 2 ? 0.488603f * 4.0f * PI / 3.0f : 0.0f);
+        float expected_g = i == 0 ? 0.282095f * 4.0f * PI : 0.0f;
+        TestEqual(*FString::Printf(TEXT("R L%d"), i), sh[i * 3], expected_r, tolerance);
+        TestEqual(*FString::Printf(TEXT("G L%d"), i), sh[i * 3 + 1], expected_g, tolerance);
+        TestEqual(*FString::Printf(TEXT("B L%d"), i), sh[i * 3 + 2], 0.0f, tolerance);
+    }
+    return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSkyBoxIBLSpecularKernelTest, "SkyBox.IBL.SpecularKernel", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSkyBoxIBLSpecularKernelTest::RunTest(const FString& Parameters)
+{
+    //粗糙度0是镜面反射，只有法线方向一个样本
+    float mean_cos = 0.0f;
+    if (!SkyBoxIBLTest::CheckSpecularKernel(*this, 0.0f, mean_cos))
+        return false;
+    TestEqual(TEXT("mirror kernel points along the normal"), mean_cos, 1.0f, 1e-6f);
+    //GGX的波瓣随粗糙度变宽
+    float previous = mean_cos;
+    const float roughnesses[] = { 0.2f, 0.4f, 0.6f, 0.8f, 1.0f };
+    for (float roughness : roughnesses)
+    {
+        if (!SkyBoxIBLTest::CheckSpecularKernel(*this, roughness, mean_cos))
+            return false;
+        TestTrue(*FString::Printf(TEXT("roughness %.2f is wider than the previous level"), roughness), mean_cos < previous);
+        previous = mean_cos;
+    }
+    return true;
+}
+
+#endif
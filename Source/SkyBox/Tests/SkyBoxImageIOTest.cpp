@@ -0,0 +1,146 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "Modules/ModuleManager.h"
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
+#include <FileHelper.h>
+#include "SkyBoxImageIO.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    //宽度超过8才会走RGBE的游程编码；前几行是常数，后面是渐变，两种游程都能覆盖到
+    const int32 TestWidth = 37;
+    const int32 TestHeight = 11;
+
+    void MakeTestImage(TArray<FFloat16Color>& pixels)
+    {
+        pixels.SetNumUninitialized(TestWidth * TestHeight);
+        for (int32 y = 0; y < TestHeight; ++y)
+        {
+            for (int32 x = 0; x < TestWidth; ++x)
+            {
+                FLinearColor color = y < 3 ? FLinearColor(0.25f, 0.5f, 1.0f) : FLinearColor(x / (float)TestWidth, y / (float)TestHeight, 4.0f * x / TestWidth + 0.01f);
+                pixels[y * TestWidth + x] = FFloat16Color(color);
+            }
+        }
+    }
+
+    //分两次写，流式写出时行数不是一次给全
+    bool WriteTestImage(SkyBoxImageFormat format, const TArray<FFloat16Color>& pixels, FString& path)
+    {
+        path = FPaths::AutomationTransientDir() / FString::Printf(TEXT("SkyBoxImageIOTest.%s"), SkyBoxImageWriter::GetExtension(format));
+        TUniquePtr<SkyBoxImageWriter> writer(SkyBoxImageWriter::Create(format));
+        if (!writer.IsValid() || !writer->Open(path, TestWidth, TestHeight))
+            return false;
+        int32 first = TestHeight / 2;
+        bool ok = writer->WriteRows(pixels.GetData(), first) && writer->WriteRows(pixels.GetData() + first * TestWidth, TestHeight - first);
+        return writer->Close() && ok;
+    }
+
+    bool DecodeWithImageWrapper(const FString& path, EImageFormat image_format, ERGBFormat rgb_format, int32 bit_depth, TArray<uint8>& raw)
+    {
+        TArray<uint8> compressed;
+        if (!FFileHelper::LoadFileToArray(compressed, *path))
+            return false;
+        IImageWrapperModule& image_wrapper_module = FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
+        TSharedPtr<IImageWrapper> image_wrapper = image_wrapper_module.CreateImageWrapper(image_format);
+        const TArray<uint8>* decoded = NULL;
+        if (!image_wrapper.IsValid() || !image_wrapper->SetCompressed(compressed.GetData(), compressed.Num()))
+            return false;
+        if (image_wrapper->GetWidth() != TestWidth || image_wrapper->GetHeight() != TestHeight)
+            return false;
+        if (!image_wrapper->GetRaw(rgb_format, bit_depth, decoded) || decoded == NULL)
+            return false;
+        raw = *decoded;
+        return true;
+    }
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSkyBoxImageIOPNGTest, "SkyBox.ImageIO.PNG", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSkyBoxImageIOPNGTest::RunTest(const FString& Parameters)
+{
+    TArray<FFloat16Color> pixels;
+    MakeTestImage(pixels);
+    FString path;
+    TestTrue(TEXT("write png"), WriteTestImage(SkyBoxImageFormat::PNG, pixels, path));
+    TArray<uint8> raw;
+    if (!TestTrue(TEXT("decode png"), DecodeWithImageWrapper(path, EImageFormat::PNG, ERGBFormat::BGRA, 8, raw)))
+        return false;
+    //BGRA8和FColor的内存布局一致；写的时候按sRGB量化，读回来应该一模一样
+    const FColor* colors = reinterpret_cast<const FColor*>(raw.GetData());
+    int32 mismatches = 0;
+    for (int32 i = 0; i < pixels.Num(); ++i)
+    {
+        FColor expected = FLinearColor(pixels[i]).ToFColor(true);
+        if (colors[i].R != expected.R || colors[i].G != expected.G || colors[i].B != expected.B)
+            ++mismatches;
+    }
+    TestEqual(TEXT("png pixel mismatches"), mismatches, 0);
+    IFileManager::Get().Delete(*path);
+    return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSkyBoxImageIOEXRTest, "SkyBox.ImageIO.EXR", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSkyBoxImageIOEXRTest::RunTest(const FString& Parameters)
+{
+    TArray<FFloat16Color> pixels;
+    MakeTestImage(pixels);
+    FString path;
+    TestTrue(TEXT("write exr"), WriteTestImage(SkyBoxImageFormat::EXR, pixels, path));
+    TArray<uint8> raw;
+    if (!TestTrue(TEXT("decode exr"), DecodeWithImageWrapper(path, EImageFormat::EXR, ERGBFormat::RGBA, 16, raw)))
+        return false;
+    //half float原样写出，读回来的编码应该完全相同
+    const FFloat16Color* colors = reinterpret_cast<const FFloat16Color*>(raw.GetData());
+    int32 mismatches = 0;
+    for (int32 i = 0; i < pixels.Num(); ++i)
+    {
+        if (colors[i].R.Encoded != pixels[i].R.Encoded || colors[i].G.Encoded != pixels[i].G.Encoded || colors[i].B.Encoded != pixels[i].B.Encoded)
+            ++mismatches;
+    }
+    TestEqual(TEXT("exr pixel mismatches"), mismatches, 0);
+    IFileManager::Get().Delete(*path);
+    return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSkyBoxImageIORGBETest, "SkyBox.ImageIO.RGBE", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSkyBoxImageIORGBETest::RunTest(const FString& Parameters)
+{
+    TArray<FFloat16Color> pixels;
+    MakeTestImage(pixels);
+    FString path;
+    TestTrue(TEXT("write rgbe"), WriteTestImage(SkyBoxImageFormat::RGBE, pixels, path));
+    int32 width = 0;
+    int32 height = 0;
+    TArray<FLinearColor> decoded;
+    if (!TestTrue(TEXT("read rgbe"), SkyBoxImageReader::ReadRGBE(path, width, height, decoded)))
+        return false;
+    TestEqual(TEXT("rgbe width"), width, TestWidth);
+    TestEqual(TEXT("rgbe height"), height, TestHeight);
+    if (!TestTrue(TEXT("rgbe pixel count"), decoded.Num() == pixels.Num()))
+        return false;
+    //三个分量共用指数，尾数8位，误差按最大分量的1/128算
+    int32 mismatches = 0;
+    for (int32 i = 0; i < pixels.Num(); ++i)
+    {
+        FLinearColor expected(pixels[i]);
+        float tolerance = FMath::Max3(expected.R, expected.G, expected.B) / 128.0f;
+        if (FMath::Abs(decoded[i].R - expected.R) > tolerance || FMath::Abs(decoded[i].G - expected.G) > tolerance || FMath::Abs(decoded[i].B - expected.B) > tolerance)
+            ++mismatches;
+    }
+    TestEqual(TEXT("rgbe pixel mismatches"), mismatches, 0);
+    IFileManager::Get().Delete(*path);
+    return true;
+}
+
+#endif
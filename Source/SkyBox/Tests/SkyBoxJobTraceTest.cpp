@@ -0,0 +1,228 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include <FileHelper.h>
+#include "SkyBoxJobTrace.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    //和Tools/SkyBoxLoadGen/SkyBoxReplay.cpp里的TraceReader一样的解码
+    class TestTraceReader
+    {
+    public:
+        TestTraceReader(const TArray<uint8>& data) : m_data(data), m_pos(0), m_ok(true) {}
+        bool Ok() const { return m_ok; }
+        bool AtEnd() const { return m_pos >= m_data.Num(); }
+        uint8 Byte()
+        {
+            if (m_pos >= m_data.Num())
+            {
+                m_ok = false;
+                return 0;
+            }
+            return m_data[m_pos++];
+        }
+        uint32 Fixed32()
+        {
+            uint32 value = 0;
+            for (int32 i = 0; i < 4; ++i)
+                value |= (uint32)Byte() << (8 * i);
+            return value;
+        }
+        float Float()
+        {
+            uint32 bits = Fixed32();
+            float value;
+            FMemory::Memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+        uint64 Varint()
+        {
+            uint64 value = 0;
+            for (int32 shift = 0; shift < 64 && m_ok; shift += 7)
+            {
+                uint8 byte = Byte();
+                value |= (uint64)(byte & 0x7f) << shift;
+                if ((byte & 0x80) == 0)
+                    return value;
+            }
+            m_ok = false;
+            return 0;
+        }
+        int64 SVarint()
+        {
+            uint64 value = Varint();
+            return (int64)(value >> 1) ^ -(int64)(value & 1);
+        }
+        std::string String()
+        {
+            uint64 size = Varint();
+            if (!m_ok || size > (uint64)(m_data.Num() - m_pos))
+            {
+                m_ok = false;
+                return std::string();
+            }
+            std::string value((const char*)&m_data[m_pos], (size_t)size);
+            m_pos += (int32)size;
+            return value;
+        }
+    private:
+        const TArray<uint8>& m_data;
+        int32 m_pos;
+        bool m_ok;
+    };
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSkyBoxJobTraceVarintTest, "SkyBox.JobTrace.Varint", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSkyBoxJobTraceVarintTest::RunTest(const FString& Parameters)
+{
+    //LEB128的已知编码
+    {
+        SkyBoxJobTraceBuffer buffer;
+        buffer.Varint(300);
+        TestTrue(TEXT("300 encodes as AC 02"), buffer.m_data.Num() == 2 && buffer.m_data[0] == 0xac && buffer.m_data[1] == 0x02);
+    }
+    {
+        SkyBoxJobTraceBuffer buffer;
+        buffer.Varint(MAX_uint64);
+        TestTrue(TEXT("max uint64 takes 10 bytes"), buffer.m_data.Num() == 10 && buffer.m_data[9] == 0x01);
+    }
+    //zigzag：0 -1 1 -2 依次编成 0 1 2 3
+    {
+        SkyBoxJobTraceBuffer buffer;
+        buffer.SVarint(0);
+        buffer.SVarint(-1);
+        buffer.SVarint(1);
+        buffer.SVarint(-2);
+        TestTrue(TEXT("zigzag"), buffer.m_data.Num() == 4 && buffer.m_data[0] == 0 && buffer.m_data[1] == 1 && buffer.m_data[2] == 2 && buffer.m_data[3] == 3);
+    }
+    //编码再解码，边界值都要原样回来
+    const uint64 unsigned_values[] = { 0, 1, 127, 128, 16383, 16384, MAX_uint32, (uint64)MAX_uint32 + 1, MAX_uint64 };
+    const int64 signed_values[] = { 0, 1, -1, 63, -64, 64, -65, MAX_int32, MIN_int32, MAX_int64, MIN_int64 };
+    SkyBoxJobTraceBuffer buffer;
+    for (uint64 value : unsigned_values)
+        buffer.Varint(value);
+    for (int64 value : signed_values)
+        buffer.SVarint(value);
+    buffer.Float(-1.5f);
+    buffer.String(std::string("client-a"));
+    TestTraceReader reader(buffer.m_data);
+    for (uint64 value : unsigned_values)
+        TestTrue(*FString::Printf(TEXT("varint %llu"), value), reader.Varint() == value);
+    for (int64 value : signed_values)
+        TestTrue(*FString::Printf(TEXT("svarint %lld"), value), reader.SVarint() == value);
+    TestTrue(TEXT("float"), reader.Float() == -1.5f);
+    TestTrue(TEXT("string"), reader.String() == "client-a");
+    TestTrue(TEXT("consumed everything"), reader.Ok() && reader.AtEnd());
+    //截断的varint要报错，不能读出半个值
+    TArray<uint8> truncated;
+    truncated.Add(0x80);
+    TestTraceReader truncated_reader(truncated);
+    truncated_reader.Varint();
+    TestFalse(TEXT("truncated varint"), truncated_reader.Ok());
+    return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSkyBoxJobTraceFileTest, "SkyBox.JobTrace.File", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSkyBoxJobTraceFileTest::RunTest(const FString& Parameters)
+{
+    //Start会停掉正在进行的记录，别把别人的文件截断了
+    if (SkyBoxJobTrace::IsRecording())
+    {
+        AddWarning(TEXT("a job trace is already being recorded, skipped"));
+        return true;
+    }
+    FString path = FPaths::AutomationTransientDir() / TEXT("SkyBoxJobTraceTest.sbjt");
+    if (!TestTrue(TEXT("start"), SkyBoxJobTrace::Start(path)))
+        return false;
+    double now = FPlatformTime::Seconds();
+    TArray<FVector> positions;
+    positions.Add(FVector(1.0f, 2.0f, 3.0f));
+    positions.Add(FVector(-4.0f, 5.0f, 6.0f));
+    SkyBoxJobTrace::RecordGenerate(now, "a", 1, 10.0f, 20.0f, 30.0f, 512, 2, 1, 3, true, 7);
+    SkyBoxJobTrace::RecordRegion(now + 0.001, "b", 0, FVector::ZeroVector, FVector(100.0f, 100.0f, 0.0f), 50.0f, positions, 0, 0, 2, 0, 8);
+    SkyBoxJobTrace::RecordQuery(now + 0.002, "a", 7, 1);
+    SkyBoxJobTrace::RecordCancel(now + 0.003, "b", 8, 4);
+    SkyBoxJobTrace::RecordClientWeight(now + 0.004, "admin", "a", 2.5f);
+    SkyBoxJobTrace::Stop();
+
+    TArray<uint8> data;
+    if (!TestTrue(TEXT("load"), FFileHelper::LoadFileToArray(data, *path)))
+        return false;
+    IFileManager::Get().Delete(*path);
+    TestTraceReader reader(data);
+    uint8 magic[4] = { reader.Byte(), reader.Byte(), reader.Byte(), reader.Byte() };
+    TestTrue(TEXT("magic"), FMemory::Memcmp(magic, "SBJT", 4) == 0);
+    TestTrue(TEXT("version"), reader.Fixed32() == SkyBoxJobTrace::Version);
+    reader.Fixed32();  //开始录制的unix时间
+    reader.Fixed32();
+    //按写的顺序：新客户端在第一次出现时先写一条
+    TArray<std::string> clients;
+    TArray<uint8> types;
+    int64 micros = 0;
+    while (!reader.AtEnd() && reader.Ok())
+    {
+        uint8 type = reader.Byte();
+        micros += reader.SVarint();
+        uint32 client = (uint32)reader.Varint();
+        types.Add(type);
+        if (type == SkyBoxJobTrace::NewClient)
+        {
+            TestTrue(TEXT("client index is sequential"), client == (uint32)clients.Num());
+            clients.Add(reader.String());
+        }
+        else if (type == SkyBoxJobTrace::Generate)
+        {
+            TestTrue(TEXT("generate client"), clients.IsValidIndex(client) && clients[client] == "a");
+            TestTrue(TEXT("generate scene"), reader.Varint() == 1);
+            TestTrue(TEXT("generate position"), reader.Float() == 10.0f && reader.Float() == 20.0f && reader.Float() == 30.0f);
+            TestTrue(TEXT("generate resolution"), reader.Varint() == 512);
+            TestTrue(TEXT("generate format quality ibl supersede"), reader.Byte() == 2 && reader.Byte() == 1 && reader.Byte() == 3 && reader.Byte() == 1);
+            TestTrue(TEXT("generate job_id"), reader.Varint() == 7);
+        }
+        else if (type == SkyBoxJobTrace::Region)
+        {
+            TestTrue(TEXT("region client"), clients.IsValidIndex(client) && clients[client] == "b");
+            TestTrue(TEXT("region scene"), reader.Varint() == 0);
+            for (int32 i = 0; i < 7; ++i)
+                reader.Float();  //min max spacing
+            TestTrue(TEXT("region point count"), reader.Varint() == 2);
+            TestTrue(TEXT("region first point"), reader.Float() == 1.0f && reader.Float() == 2.0f && reader.Float() == 3.0f);
+            TestTrue(TEXT("region second point"), reader.Float() == -4.0f && reader.Float() == 5.0f && reader.Float() == 6.0f);
+            TestTrue(TEXT("region resolution"), reader.Varint() == 0);
+            TestTrue(TEXT("region format quality ibl"), reader.Byte() == 0 && reader.Byte() == 2 && reader.Byte() == 0);
+            TestTrue(TEXT("region job_id"), reader.Varint() == 8);
+        }
+        else if (type == SkyBoxJobTrace::Query || type == SkyBoxJobTrace::Cancel)
+        {
+            reader.Varint();
+            reader.Byte();
+        }
+        else if (type == SkyBoxJobTrace::ClientWeight)
+        {
+            TestTrue(TEXT("weight target"), reader.String() == "a");
+            TestTrue(TEXT("weight"), reader.Float() == 2.5f);
+        }
+        else
+        {
+            AddError(FString::Printf(TEXT("unknown record type %d"), type));
+            break;
+        }
+    }
+    TestTrue(TEXT("file parsed"), reader.Ok() && reader.AtEnd());
+    TestTrue(TEXT("clients"), clients.Num() == 3);
+    const uint8 expected[] = { SkyBoxJobTrace::NewClient, SkyBoxJobTrace::Generate, SkyBoxJobTrace::NewClient, SkyBoxJobTrace::Region,
+        SkyBoxJobTrace::Query, SkyBoxJobTrace::Cancel, SkyBoxJobTrace::NewClient, SkyBoxJobTrace::ClientWeight };
+    TestTrue(TEXT("record order"), types == TArray<uint8>(expected, ARRAY_COUNT(expected)));
+    TestTrue(TEXT("arrival offsets add up"), micros >= 4000);  //开始时间在now之前一点
+    return true;
+}
+
+#endif
@@ -0,0 +1,74 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "SkyBoxMetrics.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    uint64 BucketUpperMicros(int32 bucket)
+    {
+        return (uint64)FMath::RoundToDouble(SkyBoxHistogram::BucketUpperSeconds(bucket) * 1000000.0);
+    }
+
+    //加0.5微秒，Observe里截断成整数时不会因为浮点误差少1
+    double MicrosToSeconds(uint64 micros)
+    {
+        return (micros + 0.5) * 1e-6;
+    }
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSkyBoxHistogramBucketTest, "SkyBox.Metrics.HistogramBuckets", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSkyBoxHistogramBucketTest::RunTest(const FString& Parameters)
+{
+    //桶的上界严格递增
+    for (int32 bucket = 1; bucket < SkyBoxHistogram::BucketCount; ++bucket)
+    {
+        if (!TestTrue(*FString::Printf(TEXT("bucket %d upper bound increases"), bucket), BucketUpperMicros(bucket) > BucketUpperMicros(bucket - 1)))
+            return false;
+    }
+    //每个值落在[上一个桶的上界, 这个桶的上界)里，桶宽不超过下界的1/SubBuckets
+    const uint64 values[] = { 0, 1, 7, 8, 9, 15, 16, 17, 31, 32, 100, 1000, 12345, 1000000, 3600000000ull };
+    for (uint64 micros : values)
+    {
+        SkyBoxHistogram histogram;
+        histogram.Observe(MicrosToSeconds(micros));
+        SkyBoxHistogram::Snapshot snapshot = histogram.TakeSnapshot();
+        TestTrue(TEXT("count"), snapshot.count == 1);
+        int32 bucket = snapshot.buckets.IndexOfByPredicate([](uint64 n) { return n > 0; });
+        if (!TestTrue(*FString::Printf(TEXT("%llu observed"), micros), bucket != INDEX_NONE))
+            continue;
+        uint64 lower = bucket > 0 ? BucketUpperMicros(bucket - 1) : 0;
+        uint64 upper = BucketUpperMicros(bucket);
+        TestTrue(*FString::Printf(TEXT("%llu in bucket %d [%llu, %llu)"), micros, bucket, lower, upper), lower <= micros && micros < upper);
+        if (micros >= (uint64)SkyBoxHistogram::SubBuckets)
+            TestTrue(*FString::Printf(TEXT("bucket %d width"), bucket), (upper - lower) * SkyBoxHistogram::SubBuckets <= lower);
+    }
+    return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSkyBoxHistogramPercentileTest, "SkyBox.Metrics.HistogramPercentile", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSkyBoxHistogramPercentileTest::RunTest(const FString& Parameters)
+{
+    //1ms到1000ms均匀分布，分位数是所在桶的上界，误差在1/SubBuckets以内
+    SkyBoxHistogram histogram;
+    for (int32 ms = 1; ms <= 1000; ++ms)
+        histogram.Observe(MicrosToSeconds(ms * 1000));
+    SkyBoxHistogram::Snapshot snapshot = histogram.TakeSnapshot();
+    TestTrue(TEXT("count"), snapshot.count == 1000);
+    TestTrue(TEXT("max"), FMath::IsNearlyEqual(snapshot.max_seconds, 1.0, 1e-6));
+    const double percentiles[] = { 0.5, 0.9, 0.99 };
+    for (double p : percentiles)
+    {
+        double value = snapshot.Percentile(p);
+        TestTrue(*FString::Printf(TEXT("p%.0f = %.4f"), p * 100.0, value), value >= p && value <= p * (1.0 + 1.0 / SkyBoxHistogram::SubBuckets) + 1e-6);
+    }
+    TestTrue(TEXT("p100 is clamped to max"), FMath::IsNearlyEqual(snapshot.Percentile(1.0), 1.0, 1e-6));
+    return true;
+}
+
+#endif
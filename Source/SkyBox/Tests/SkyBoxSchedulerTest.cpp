@@ -0,0 +1,323 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeLock.h"
+#include "SkyBoxRPC.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+//SkyBoxServiceImpl的友元：每个测试用自己的实例，不碰正在服务的单例
+class SkyBoxServiceTest
+{
+public:
+    static SkyBoxServiceImpl* Create() { return new SkyBoxServiceImpl(); }
+
+    //和GenerateSkyBox一样走FindOrCreateJob，不经过准入；region_id不为0时由区域任务持有
+    static int Submit(SkyBoxServiceImpl& service, const std::string& client, float x, int region_id = 0)
+    {
+        FScopeLock lock(&service.m_lock);
+        SkyBoxJobKey key;
+        key.position.scene_id = 0;
+        key.position.x = x;
+        key.position.y = 0.0f;
+        key.position.z = 0.0f;
+        service.MakeSettings(0, 0, skybox::ImageFormat::ServerDefault, skybox::QualityPreset::Standard, skybox::IblMode::IblByQuality, &key.settings);
+        return service.FindOrCreateJob(&key, client, region_id);
+    }
+
+    static skybox::JobStatus Cancel(SkyBoxServiceImpl& service, int job_id, const std::string& client, int region_id = 0)
+    {
+        FScopeLock lock(&service.m_lock);
+        std::map<int, SkyBoxJob*>::iterator itr = service.m_id2jobs.find(job_id);
+        if (itr != service.m_id2jobs.end())
+            return service.CancelJobLocked(itr->second, client, region_id);
+        itr = service.m_id2jobs_completed.find(job_id);
+        return itr != service.m_id2jobs_completed.end() ? itr->second->m_status : skybox::JobStatus::Failed;
+    }
+
+    static skybox::JobStatus Status(SkyBoxServiceImpl& service, int job_id)
+    {
+        grpc::ServerContext context;
+        skybox::QueryJobRequest request;
+        skybox::QueryJobReply reply;
+        request.set_job_id(job_id);
+        service.QueryJob(&context, &request, &reply);
+        return reply.job_status();
+    }
+
+    static SkyBoxJob* FindJob(SkyBoxServiceImpl& service, int job_id)
+    {
+        FScopeLock lock(&service.m_lock);
+        std::map<int, SkyBoxJob*>::iterator itr = service.m_id2jobs.find(job_id);
+        return itr != service.m_id2jobs.end() ? itr->second : NULL;
+    }
+
+    static int QueueDepth(SkyBoxServiceImpl& service)
+    {
+        FScopeLock lock(&service.m_lock);
+        return service.m_queue_depth;
+    }
+
+    static void SetRegionOwner(SkyBoxServiceImpl& service, int region_id, const std::string& client)
+    {
+        FScopeLock lock(&service.m_lock);
+        service.m_region_owners[region_id] = client;
+    }
+
+    static std::vector<SkyBoxPosition> RegionPositions(SkyBoxServiceImpl& service, int region_id)
+    {
+        FScopeLock lock(&service.m_lock);
+        std::vector<SkyBoxPosition> positions;
+        for (int child_id : service.m_id2regions[region_id])
+            positions.push_back(service.m_id2jobs[child_id]->m_position);
+        return positions;
+    }
+};
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSkyBoxSchedulerHoldersTest, "SkyBox.Scheduler.HoldersAndCancel", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSkyBoxSchedulerHoldersTest::RunTest(const FString& Parameters)
+{
+    std::unique_ptr<SkyBoxServiceImpl> service(SkyBoxServiceTest::Create());
+
+    //同一个位置两个客户端请求是同一个任务，同一个客户端重复请求只算一份
+    int job_id = SkyBoxServiceTest::Submit(*service, "a", 1.0f);
+    TestTrue(TEXT("same key shares the job"), SkyBoxServiceTest::Submit(*service, "b", 1.0f) == job_id);
+    TestTrue(TEXT("repeated request shares the job"), SkyBoxServiceTest::Submit(*service, "a", 1.0f) == job_id);
+    SkyBoxJob* job = SkyBoxServiceTest::FindJob(*service, job_id);
+    if (!TestNotNull(TEXT("job queued"), job))
+        return false;
+    TestTrue(TEXT("two holders"), job->m_holders.size() == 2);
+
+    //a取消两次，第二次不能把b的那份也撤掉；没请求过的c取消什么都不动
+    TestTrue(TEXT("a cancels, b still waits"), SkyBoxServiceTest::Cancel(*service, job_id, "a") == skybox::JobStatus::Waiting);
+    TestTrue(TEXT("a cancels again"), SkyBoxServiceTest::Cancel(*service, job_id, "a") == skybox::JobStatus::Waiting);
+    TestTrue(TEXT("c never held it"), SkyBoxServiceTest::Cancel(*service, job_id, "c") == skybox::JobStatus::Waiting);
+    TestTrue(TEXT("only b holds it"), job->m_holders.size() == 1 && job->m_holders.count("b") == 1);
+    TestTrue(TEXT("still waiting"), SkyBoxServiceTest::Status(*service, job_id) == skybox::JobStatus::Waiting);
+    TestTrue(TEXT("b cancels, nobody left"), SkyBoxServiceTest::Cancel(*service, job_id, "b") == skybox::JobStatus::Cancelled);
+    TestTrue(TEXT("archived as cancelled"), SkyBoxServiceTest::Status(*service, job_id) == skybox::JobStatus::Cancelled);
+    TestTrue(TEXT("queue empty"), SkyBoxServiceTest::QueueDepth(*service) == 0);
+    int resubmitted_id = SkyBoxServiceTest::Submit(*service, "a", 1.0f);
+    TestTrue(TEXT("cancelled job is not reused"), resubmitted_id != job_id);
+    SkyBoxServiceTest::Cancel(*service, resubmitted_id, "a");
+
+    //区域和客户端各持有一份，区域重复取消也只撤区域那份
+    int shared_id = SkyBoxServiceTest::Submit(*service, "a", 2.0f);
+    SkyBoxServiceTest::Submit(*service, "a", 2.0f, 42);
+    TestTrue(TEXT("region cancels"), SkyBoxServiceTest::Cancel(*service, shared_id, std::string(), 42) == skybox::JobStatus::Waiting);
+    TestTrue(TEXT("region cancels again"), SkyBoxServiceTest::Cancel(*service, shared_id, std::string(), 42) == skybox::JobStatus::Waiting);
+    TestTrue(TEXT("client cancels last"), SkyBoxServiceTest::Cancel(*service, shared_id, "a") == skybox::JobStatus::Cancelled);
+
+    //正在采集的任务只打标记，rig放回来时归档
+    int working_id = SkyBoxServiceTest::Submit(*service, "a", 3.0f);
+    SkyBoxJob* working = service->GetJob(0, -1);
+    if (!TestTrue(TEXT("rig takes the only waiting job"), working != NULL && working->m_id == working_id))
+        return false;
+    TestTrue(TEXT("working job cancels"), SkyBoxServiceTest::Cancel(*service, working_id, "a") == skybox::JobStatus::Cancelled);
+    TestTrue(TEXT("rig sees the flag"), service->IsJobCancelled(working));
+    TestTrue(TEXT("not archived while the rig holds it"), SkyBoxServiceTest::FindJob(*service, working_id) == working);
+    service->RequeueJob(working);
+    TestTrue(TEXT("archived when the rig gives it back"), SkyBoxServiceTest::Status(*service, working_id) == skybox::JobStatus::Cancelled);
+    TestTrue(TEXT("queue empty again"), SkyBoxServiceTest::QueueDepth(*service) == 0);
+    return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSkyBoxSchedulerCancelRPCTest, "SkyBox.Scheduler.CancelRPC", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSkyBoxSchedulerCancelRPCTest::RunTest(const FString& Parameters)
+{
+    //没带x-skybox-client、也没有对端地址的context，客户端名字是空串
+    std::unique_ptr<SkyBoxServiceImpl> service(SkyBoxServiceTest::Create());
+    grpc::ServerContext context;
+
+    skybox::CancelJobRequest cancel;
+    skybox::CancelJobReply cancel_reply;
+    cancel.set_job_id(12345);
+    TestTrue(TEXT("unknown job"), service->CancelJob(&context, &cancel, &cancel_reply).error_code() == grpc::StatusCode::NOT_FOUND);
+
+    //supersede：同一个客户端的旧任务被取消，新位置和旧任务一样的留着
+    skybox::GenerateSkyBoxRequest generate;
+    skybox::GenerateSkyBoxReply first;
+    generate.mutable_position()->set_x(10.0f);
+    TestTrue(TEXT("first generate"), service->GenerateSkyBox(&context, &generate, &first).ok());
+    skybox::GenerateSkyBoxReply second;
+    generate.mutable_position()->set_x(11.0f);
+    generate.set_supersede(true);
+    TestTrue(TEXT("superseding generate"), service->GenerateSkyBox(&context, &generate, &second).ok());
+    TestTrue(TEXT("old job superseded"), SkyBoxServiceTest::Status(*service, first.job_id()) == skybox::JobStatus::Cancelled);
+    skybox::GenerateSkyBoxReply third;
+    TestTrue(TEXT("same position again"), service->GenerateSkyBox(&context, &generate, &third).ok());
+    TestTrue(TEXT("same position keeps the job"), third.job_id() == second.job_id() && SkyBoxServiceTest::Status(*service, second.job_id()) == skybox::JobStatus::Waiting);
+
+    //队列满时被拒绝的supersede不能把原来的任务也弄没了；算上会腾出的名额时应该能进
+    service->SetAdmissionLimits(1, 0);
+    skybox::GenerateSkyBoxReply rejected;
+    generate.mutable_position()->set_x(12.0f);
+    generate.set_supersede(false);
+    TestTrue(TEXT("queue full"), service->GenerateSkyBox(&context, &generate, &rejected).error_code() == grpc::StatusCode::RESOURCE_EXHAUSTED);
+    TestTrue(TEXT("rejected request keeps the old job"), SkyBoxServiceTest::Status(*service, second.job_id()) == skybox::JobStatus::Waiting);
+    skybox::GenerateSkyBoxReply replaced;
+    generate.set_supersede(true);
+    TestTrue(TEXT("supersede fits after release"), service->GenerateSkyBox(&context, &generate, &replaced).ok());
+    TestTrue(TEXT("old job released"), SkyBoxServiceTest::Status(*service, second.job_id()) == skybox::JobStatus::Cancelled);
+    service->SetAdmissionLimits(0, 0);
+
+    //区域只有提交它的客户端能取消，重复取消结果不变
+    skybox::GenerateRegionRequest region;
+    skybox::GenerateRegionReply region_reply;
+    for (int32 i = 0; i < 3; ++i)
+    {
+        skybox::Point* point = region.add_positions();
+        point->set_x(100.0f * i);
+    }
+    TestTrue(TEXT("region accepted"), service->GenerateRegion(&context, &region, &region_reply).ok());
+    cancel.set_job_id(region_reply.job_id());
+    SkyBoxServiceTest::SetRegionOwner(*service, region_reply.job_id(), "someone-else");
+    TestTrue(TEXT("other client cannot cancel"), service->CancelJob(&context, &cancel, &cancel_reply).error_code() == grpc::StatusCode::PERMISSION_DENIED);
+    SkyBoxServiceTest::SetRegionOwner(*service, region_reply.job_id(), std::string());
+    TestTrue(TEXT("owner cancels"), service->CancelJob(&context, &cancel, &cancel_reply).ok() && cancel_reply.job_status() == skybox::JobStatus::Cancelled);
+    TestTrue(TEXT("owner cancels again"), service->CancelJob(&context, &cancel, &cancel_reply).ok() && cancel_reply.job_status() == skybox::JobStatus::Cancelled);
+    TestTrue(TEXT("only the superseding job is left"), SkyBoxServiceTest::QueueDepth(*service) == 1);
+    return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSkyBoxSchedulerFairnessTest, "SkyBox.Scheduler.WeightedFairness", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSkyBoxSchedulerFairnessTest::RunTest(const FString& Parameters)
+{
+    //权重3:1，两个客户端都一直有活时取到的任务数也是3:1
+    std::unique_ptr<SkyBoxServiceImpl> service(SkyBoxServiceTest::Create());
+    TestTrue(TEXT("weight a"), service->SetClientWeight("a", 3.0f) == 3.0f);
+    TestTrue(TEXT("weight b"), service->SetClientWeight("b", 1.0f) == 1.0f);
+    for (int32 i = 0; i < 40; ++i)
+    {
+        SkyBoxServiceTest::Submit(*service, "a", (float)i);
+        SkyBoxServiceTest::Submit(*service, "b", 1000.0f + i);
+    }
+    //预流送看到的顺序就是GetJob接下来取的顺序
+    TArray<SkyBoxPosition> peeked;
+    service->PeekWaitingPositions(0, 20, peeked);
+    TestTrue(TEXT("peeked 20"), peeked.Num() == 20);
+    int taken_a = 0;
+    int taken_b = 0;
+    for (int32 i = 0; i < 40; ++i)
+    {
+        SkyBoxJob* job = service->GetJob(0, -1);
+        if (!TestNotNull(TEXT("job available"), job))
+            return false;
+        if (i < peeked.Num())
+            TestTrue(*FString::Printf(TEXT("take %d follows the peeked order"), i), job->m_position.x == peeked[i].x);
+        if (job->m_client == "a")
+            ++taken_a;
+        else
+            ++taken_b;
+    }
+    TestTrue(*FString::Printf(TEXT("a took %d of 40"), taken_a), FMath::Abs(taken_a - 30) <= 1);
+    TestTrue(*FString::Printf(TEXT("b took %d of 40"), taken_b), FMath::Abs(taken_b - 10) <= 1);
+
+    //权重夹在[0.01, 100]，特别小的权重GetJob也不会转很多圈
+    std::unique_ptr<SkyBoxServiceImpl> tiny(SkyBoxServiceTest::Create());
+    TestTrue(TEXT("tiny weight clamped"), tiny->SetClientWeight("c", 1e-9f) == 0.01f);
+    TestTrue(TEXT("huge weight clamped"), tiny->SetClientWeight("d", 1e9f) == 100.0f);
+    TestTrue(TEXT("non-positive weight resets to 1"), tiny->SetClientWeight("d", 0.0f) == 1.0f);
+    for (int32 i = 0; i < 5; ++i)
+    {
+        SkyBoxServiceTest::Submit(*tiny, "c", (float)i);
+        SkyBoxServiceTest::Submit(*tiny, "d", 1000.0f + i);
+    }
+    int taken_c = 0;
+    for (int32 i = 0; i < 10; ++i)
+    {
+        SkyBoxJob* job = tiny->GetJob(0, -1);
+        if (!TestNotNull(TEXT("job available"), job))
+            return false;
+        taken_c += job->m_client == "c" ? 1 : 0;
+    }
+    TestTrue(TEXT("tiny weight client still gets all its jobs once alone"), taken_c == 5);
+    TestTrue(TEXT("queue drained"), tiny->GetJob(0, -1) == NULL);
+    return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSkyBoxSchedulerRegionTest, "SkyBox.Scheduler.RegionOrder", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSkyBoxSchedulerRegionTest::RunTest(const FString& Parameters)
+{
+    std::unique_ptr<SkyBoxServiceImpl> service(SkyBoxServiceTest::Create());
+    grpc::ServerContext context;
+
+    //网格按蛇形走：3x2x2，相邻两个子任务正好差一个间距
+    skybox::GenerateRegionRequest grid;
+    skybox::GenerateRegionReply grid_reply;
+    grid.mutable_max()->set_x(200.0f);
+    grid.mutable_max()->set_y(100.0f);
+    grid.mutable_max()->set_z(100.0f);
+    grid.set_spacing(100.0f);
+    if (!TestTrue(TEXT("grid accepted"), service->GenerateRegion(&context, &grid, &grid_reply).ok() && grid_reply.child_count() == 12))
+        return false;
+    std::vector<SkyBoxPosition> walk = SkyBoxServiceTest::RegionPositions(*service, grid_reply.job_id());
+    for (size_t i = 1; i < walk.size(); ++i)
+    {
+        float step = FMath::Abs(walk[i].x - walk[i - 1].x) + FMath::Abs(walk[i].y - walk[i - 1].y) + FMath::Abs(walk[i].z - walk[i - 1].z);
+        TestTrue(*FString::Printf(TEXT("serpentine step %d"), (int32)i), step == 100.0f);
+    }
+
+    //任意列表按Morton码排：打乱的4x4网格，每个2x2的象限排在一起
+    skybox::GenerateRegionRequest list;
+    skybox::GenerateRegionReply list_reply;
+    const int32 order[16] = { 15, 0, 9, 6, 3, 12, 5, 10, 1, 14, 7, 8, 11, 4, 13, 2 };
+    for (int32 index : order)
+    {
+        skybox::Point* point = list.add_positions();
+        point->set_x(1000.0f + 100.0f * (index % 4));
+        point->set_y(100.0f * (index / 4));
+    }
+    if (!TestTrue(TEXT("list accepted"), service->GenerateRegion(&context, &list, &list_reply).ok() && list_reply.child_count() == 16))
+        return false;
+    std::vector<SkyBoxPosition> sorted = SkyBoxServiceTest::RegionPositions(*service, list_reply.job_id());
+    TestTrue(TEXT("starts at the min corner"), sorted[0].x == 1000.0f && sorted[0].y == 0.0f);
+    for (size_t quad = 0; quad < 4; ++quad)
+    {
+        float min_x = sorted[quad * 4].x;
+        float max_x = min_x;
+        float min_y = sorted[quad * 4].y;
+        float max_y = min_y;
+        for (size_t i = quad * 4; i < quad * 4 + 4; ++i)
+        {
+            min_x = FMath::Min(min_x, sorted[i].x);
+            max_x = FMath::Max(max_x, sorted[i].x);
+            min_y = FMath::Min(min_y, sorted[i].y);
+            max_y = FMath::Max(max_y, sorted[i].y);
+        }
+        TestTrue(*FString::Printf(TEXT("quadrant %d is a 2x2 block"), (int32)quad), max_x - min_x == 100.0f && max_y - min_y == 100.0f);
+    }
+
+    //列表里重复的位置只算一次新任务：队列上限正好够两个不同的位置
+    std::unique_ptr<SkyBoxServiceImpl> limited(SkyBoxServiceTest::Create());
+    limited->SetAdmissionLimits(2, 0);
+    skybox::GenerateRegionRequest duplicated;
+    skybox::GenerateRegionReply duplicated_reply;
+    duplicated.add_positions()->set_x(1.0f);
+    duplicated.add_positions()->set_x(1.0f);
+    duplicated.add_positions()->set_x(2.0f);
+    TestTrue(TEXT("duplicates counted once"), limited->GenerateRegion(&context, &duplicated, &duplicated_reply).ok() && duplicated_reply.child_count() == 3);
+    TestTrue(TEXT("two distinct jobs queued"), SkyBoxServiceTest::QueueDepth(*limited) == 2);
+
+    //不是有限值的坐标、展开后太大的网格都直接拒绝
+    skybox::GenerateRegionRequest bad;
+    skybox::GenerateRegionReply bad_reply;
+    bad.add_positions()->set_x(NAN);
+    TestTrue(TEXT("nan position"), service->GenerateRegion(&context, &bad, &bad_reply).error_code() == grpc::StatusCode::INVALID_ARGUMENT);
+    skybox::GenerateRegionRequest huge;
+    huge.mutable_max()->set_x(3.0e38f);
+    huge.mutable_max()->set_y(3.0e38f);
+    huge.mutable_max()->set_z(3.0e38f);
+    huge.set_spacing(1.0e30f);
+    TestTrue(TEXT("grid too large"), service->GenerateRegion(&context, &huge, &bad_reply).error_code() == grpc::StatusCode::INVALID_ARGUMENT);
+    return true;
+}
+
+#endif
@@ -33,6 +33,11 @@ static const char* SkyBoxService_method_names[] = {
   "/skybox.SkyBoxService/SayHello",
   "/skybox.SkyBoxService/GenerateSkyBox",
   "/skybox.SkyBoxService/QueryJob",
+  "/skybox.SkyBoxService/GenerateRegion",
+  "/skybox.SkyBoxService/SetClientWeight",
+  "/skybox.SkyBoxService/CancelJob",
+  "/skybox.SkyBoxService/ExportTrace",
+  "/skybox.SkyBoxService/GetStats",
 };
 
 std::unique_ptr< SkyBoxService::Stub> SkyBoxService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -45,6 +50,11 @@ SkyBoxService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& chan
   : channel_(channel), rpcmethod_SayHello_(SkyBoxService_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_GenerateSkyBox_(SkyBoxService_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_QueryJob_(SkyBoxService_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GenerateRegion_(SkyBoxService_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SetClientWeight_(SkyBoxService_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_CancelJob_(SkyBoxService_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ExportTrace_(SkyBoxService_method_names[6], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetStats_(SkyBoxService_method_names[7], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::Status SkyBoxService::Stub::SayHello(::grpc::ClientContext* context, const ::skybox::HelloRequest& request, ::skybox::HelloReply* response) {
@@ -116,6 +126,121 @@ void SkyBoxService::Stub::experimental_async::QueryJob(::grpc::ClientContext* co
   return result;
 }
 
+::grpc::Status SkyBoxService::Stub::GenerateRegion(::grpc::ClientContext* context, const ::skybox::GenerateRegionRequest& request, ::skybox::GenerateRegionReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::skybox::GenerateRegionRequest, ::skybox::GenerateRegionReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GenerateRegion_, context, request, response);
+}
+
+void SkyBoxService::Stub::experimental_async::GenerateRegion(::grpc::ClientContext* context, const ::skybox::GenerateRegionRequest* request, ::skybox::GenerateRegionReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::skybox::GenerateRegionRequest, ::skybox::GenerateRegionReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GenerateRegion_, context, request, response, std::move(f));
+}
+
+void SkyBoxService::Stub::experimental_async::GenerateRegion(::grpc::ClientContext* context, const ::skybox::GenerateRegionRequest* request, ::skybox::GenerateRegionReply* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GenerateRegion_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::skybox::GenerateRegionReply>* SkyBoxService::Stub::PrepareAsyncGenerateRegionRaw(::grpc::ClientContext* context, const ::skybox::GenerateRegionRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::skybox::GenerateRegionReply, ::skybox::GenerateRegionRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GenerateRegion_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::skybox::GenerateRegionReply>* SkyBoxService::Stub::AsyncGenerateRegionRaw(::grpc::ClientContext* context, const ::skybox::GenerateRegionRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGenerateRegionRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status SkyBoxService::Stub::SetClientWeight(::grpc::ClientContext* context, const ::skybox::SetClientWeightRequest& request, ::skybox::SetClientWeightReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::skybox::SetClientWeightRequest, ::skybox::SetClientWeightReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SetClientWeight_, context, request, response);
+}
+
+void SkyBoxService::Stub::experimental_async::SetClientWeight(::grpc::ClientContext* context, const ::skybox::SetClientWeightRequest* request, ::skybox::SetClientWeightReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::skybox::SetClientWeightRequest, ::skybox::SetClientWeightReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetClientWeight_, context, request, response, std::move(f));
+}
+
+void SkyBoxService::Stub::experimental_async::SetClientWeight(::grpc::ClientContext* context, const ::skybox::SetClientWeightRequest* request, ::skybox::SetClientWeightReply* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetClientWeight_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::skybox::SetClientWeightReply>* SkyBoxService::Stub::PrepareAsyncSetClientWeightRaw(::grpc::ClientContext* context, const ::skybox::SetClientWeightRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::skybox::SetClientWeightReply, ::skybox::SetClientWeightRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_SetClientWeight_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::skybox::SetClientWeightReply>* SkyBoxService::Stub::AsyncSetClientWeightRaw(::grpc::ClientContext* context, const ::skybox::SetClientWeightRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncSetClientWeightRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status SkyBoxService::Stub::CancelJob(::grpc::ClientContext* context, const ::skybox::CancelJobRequest& request, ::skybox::CancelJobReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::skybox::CancelJobRequest, ::skybox::CancelJobReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_CancelJob_, context, request, response);
+}
+
+void SkyBoxService::Stub::experimental_async::CancelJob(::grpc::ClientContext* context, const ::skybox::CancelJobRequest* request, ::skybox::CancelJobReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::skybox::CancelJobRequest, ::skybox::CancelJobReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_CancelJob_, context, request, response, std::move(f));
+}
+
+void SkyBoxService::Stub::experimental_async::CancelJob(::grpc::ClientContext* context, const ::skybox::CancelJobRequest* request, ::skybox::CancelJobReply* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_CancelJob_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::skybox::CancelJobReply>* SkyBoxService::Stub::PrepareAsyncCancelJobRaw(::grpc::ClientContext* context, const ::skybox::CancelJobRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::skybox::CancelJobReply, ::skybox::CancelJobRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_CancelJob_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::skybox::CancelJobReply>* SkyBoxService::Stub::AsyncCancelJobRaw(::grpc::ClientContext* context, const ::skybox::CancelJobRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncCancelJobRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status SkyBoxService::Stub::ExportTrace(::grpc::ClientContext* context, const ::skybox::ExportTraceRequest& request, ::skybox::ExportTraceReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::skybox::ExportTraceRequest, ::skybox::ExportTraceReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_ExportTrace_, context, request, response);
+}
+
+void SkyBoxService::Stub::experimental_async::ExportTrace(::grpc::ClientContext* context, const ::skybox::ExportTraceRequest* request, ::skybox::ExportTraceReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::skybox::ExportTraceRequest, ::skybox::ExportTraceReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ExportTrace_, context, request, response, std::move(f));
+}
+
+void SkyBoxService::Stub::experimental_async::ExportTrace(::grpc::ClientContext* context, const ::skybox::ExportTraceRequest* request, ::skybox::ExportTraceReply* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ExportTrace_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::skybox::ExportTraceReply>* SkyBoxService::Stub::PrepareAsyncExportTraceRaw(::grpc::ClientContext* context, const ::skybox::ExportTraceRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::skybox::ExportTraceReply, ::skybox::ExportTraceRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_ExportTrace_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::skybox::ExportTraceReply>* SkyBoxService::Stub::AsyncExportTraceRaw(::grpc::ClientContext* context, const ::skybox::ExportTraceRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncExportTraceRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status SkyBoxService::Stub::GetStats(::grpc::ClientContext* context, const ::skybox::GetStatsRequest& request, ::skybox::GetStatsReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::skybox::GetStatsRequest, ::skybox::GetStatsReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetStats_, context, request, response);
+}
+
+void SkyBoxService::Stub::experimental_async::GetStats(::grpc::ClientContext* context, const ::skybox::GetStatsRequest* request, ::skybox::GetStatsReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::skybox::GetStatsRequest, ::skybox::GetStatsReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetStats_, context, request, response, std::move(f));
+}
+
+void SkyBoxService::Stub::experimental_async::GetStats(::grpc::ClientContext* context, const ::skybox::GetStatsRequest* request, ::skybox::GetStatsReply* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetStats_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::skybox::GetStatsReply>* SkyBoxService::Stub::PrepareAsyncGetStatsRaw(::grpc::ClientContext* context, const ::skybox::GetStatsRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::skybox::GetStatsReply, ::skybox::GetStatsRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetStats_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::skybox::GetStatsReply>* SkyBoxService::Stub::AsyncGetStatsRaw(::grpc::ClientContext* context, const ::skybox::GetStatsRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetStatsRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 SkyBoxService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       SkyBoxService_method_names[0],
@@ -147,6 +272,56 @@ SkyBoxService::Service::Service() {
              ::skybox::QueryJobReply* resp) {
                return service->QueryJob(ctx, req, resp);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      SkyBoxService_method_names[3],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< SkyBoxService::Service, ::skybox::GenerateRegionRequest, ::skybox::GenerateRegionReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](SkyBoxService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::skybox::GenerateRegionRequest* req,
+             ::skybox::GenerateRegionReply* resp) {
+               return service->GenerateRegion(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      SkyBoxService_method_names[4],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< SkyBoxService::Service, ::skybox::SetClientWeightRequest, ::skybox::SetClientWeightReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](SkyBoxService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::skybox::SetClientWeightRequest* req,
+             ::skybox::SetClientWeightReply* resp) {
+               return service->SetClientWeight(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      SkyBoxService_method_names[5],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< SkyBoxService::Service, ::skybox::CancelJobRequest, ::skybox::CancelJobReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](SkyBoxService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::skybox::CancelJobRequest* req,
+             ::skybox::CancelJobReply* resp) {
+               return service->CancelJob(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      SkyBoxService_method_names[6],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< SkyBoxService::Service, ::skybox::ExportTraceRequest, ::skybox::ExportTraceReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](SkyBoxService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::skybox::ExportTraceRequest* req,
+             ::skybox::ExportTraceReply* resp) {
+               return service->ExportTrace(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      SkyBoxService_method_names[7],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< SkyBoxService::Service, ::skybox::GetStatsRequest, ::skybox::GetStatsReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](SkyBoxService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::skybox::GetStatsRequest* req,
+             ::skybox::GetStatsReply* resp) {
+               return service->GetStats(ctx, req, resp);
+             }, this)));
 }
 
 SkyBoxService::Service::~Service() {
@@ -173,6 +348,41 @@ SkyBoxService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status SkyBoxService::Service::GenerateRegion(::grpc::ServerContext* context, const ::skybox::GenerateRegionRequest* request, ::skybox::GenerateRegionReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status SkyBoxService::Service::SetClientWeight(::grpc::ServerContext* context, const ::skybox::SetClientWeightRequest* request, ::skybox::SetClientWeightReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status SkyBoxService::Service::CancelJob(::grpc::ServerContext* context, const ::skybox::CancelJobRequest* request, ::skybox::CancelJobReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status SkyBoxService::Service::ExportTrace(::grpc::ServerContext* context, const ::skybox::ExportTraceRequest* request, ::skybox::ExportTraceReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status SkyBoxService::Service::GetStats(::grpc::ServerContext* context, const ::skybox::GetStatsRequest* request, ::skybox::GetStatsReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace skybox
 #pragma warning(pop)
@@ -57,6 +57,41 @@ class SkyBoxService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::skybox::QueryJobReply>> PrepareAsyncQueryJob(::grpc::ClientContext* context, const ::skybox::QueryJobRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::skybox::QueryJobReply>>(PrepareAsyncQueryJobRaw(context, request, cq));
     }
+    virtual ::grpc::Status GenerateRegion(::grpc::ClientContext* context, const ::skybox::GenerateRegionRequest& request, ::skybox::GenerateRegionReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::skybox::GenerateRegionReply>> AsyncGenerateRegion(::grpc::ClientContext* context, const ::skybox::GenerateRegionRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::skybox::GenerateRegionReply>>(AsyncGenerateRegionRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::skybox::GenerateRegionReply>> PrepareAsyncGenerateRegion(::grpc::ClientContext* context, const ::skybox::GenerateRegionRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::skybox::GenerateRegionReply>>(PrepareAsyncGenerateRegionRaw(context, request, cq));
+    }
+    virtual ::grpc::Status SetClientWeight(::grpc::ClientContext* context, const ::skybox::SetClientWeightRequest& request, ::skybox::SetClientWeightReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::skybox::SetClientWeightReply>> AsyncSetClientWeight(::grpc::ClientContext* context, const ::skybox::SetClientWeightRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::skybox::SetClientWeightReply>>(AsyncSetClientWeightRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::skybox::SetClientWeightReply>> PrepareAsyncSetClientWeight(::grpc::ClientContext* context, const ::skybox::SetClientWeightRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::skybox::SetClientWeightReply>>(PrepareAsyncSetClientWeightRaw(context, request, cq));
+    }
+    virtual ::grpc::Status CancelJob(::grpc::ClientContext* context, const ::skybox::CancelJobRequest& request, ::skybox::CancelJobReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::skybox::CancelJobReply>> AsyncCancelJob(::grpc::ClientContext* context, const ::skybox::CancelJobRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::skybox::CancelJobReply>>(AsyncCancelJobRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::skybox::CancelJobReply>> PrepareAsyncCancelJob(::grpc::ClientContext* context, const ::skybox::CancelJobRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::skybox::CancelJobReply>>(PrepareAsyncCancelJobRaw(context, request, cq));
+    }
+    virtual ::grpc::Status ExportTrace(::grpc::ClientContext* context, const ::skybox::ExportTraceRequest& request, ::skybox::ExportTraceReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::skybox::ExportTraceReply>> AsyncExportTrace(::grpc::ClientContext* context, const ::skybox::ExportTraceRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::skybox::ExportTraceReply>>(AsyncExportTraceRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::skybox::ExportTraceReply>> PrepareAsyncExportTrace(::grpc::ClientContext* context, const ::skybox::ExportTraceRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::skybox::ExportTraceReply>>(PrepareAsyncExportTraceRaw(context, request, cq));
+    }
+    virtual ::grpc::Status GetStats(::grpc::ClientContext* context, const ::skybox::GetStatsRequest& request, ::skybox::GetStatsReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::skybox::GetStatsReply>> AsyncGetStats(::grpc::ClientContext* context, const ::skybox::GetStatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::skybox::GetStatsReply>>(AsyncGetStatsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::skybox::GetStatsReply>> PrepareAsyncGetStats(::grpc::ClientContext* context, const ::skybox::GetStatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::skybox::GetStatsReply>>(PrepareAsyncGetStatsRaw(context, request, cq));
+    }
     class experimental_async_interface {
      public:
       virtual ~experimental_async_interface() {}
@@ -78,6 +113,36 @@ class SkyBoxService final {
       #else
       virtual void QueryJob(::grpc::ClientContext* context, const ::skybox::QueryJobRequest* request, ::skybox::QueryJobReply* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
       #endif
+      virtual void GenerateRegion(::grpc::ClientContext* context, const ::skybox::GenerateRegionRequest* request, ::skybox::GenerateRegionReply* response, std::function<void(::grpc::Status)>) = 0;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      virtual void GenerateRegion(::grpc::ClientContext* context, const ::skybox::GenerateRegionRequest* request, ::skybox::GenerateRegionReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      #else
+      virtual void GenerateRegion(::grpc::ClientContext* context, const ::skybox::GenerateRegionRequest* request, ::skybox::GenerateRegionReply* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
+      #endif
+      virtual void SetClientWeight(::grpc::ClientContext* context, const ::skybox::SetClientWeightRequest* request, ::skybox::SetClientWeightReply* response, std::function<void(::grpc::Status)>) = 0;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      virtual void SetClientWeight(::grpc::ClientContext* context, const ::skybox::SetClientWeightRequest* request, ::skybox::SetClientWeightReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      #else
+      virtual void SetClientWeight(::grpc::ClientContext* context, const ::skybox::SetClientWeightRequest* request, ::skybox::SetClientWeightReply* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
+      #endif
+      virtual void CancelJob(::grpc::ClientContext* context, const ::skybox::CancelJobRequest* request, ::skybox::CancelJobReply* response, std::function<void(::grpc::Status)>) = 0;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      virtual void CancelJob(::grpc::ClientContext* context, const ::skybox::CancelJobRequest* request, ::skybox::CancelJobReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      #else
+      virtual void CancelJob(::grpc::ClientContext* context, const ::skybox::CancelJobRequest* request, ::skybox::CancelJobReply* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
+      #endif
+      virtual void ExportTrace(::grpc::ClientContext* context, const ::skybox::ExportTraceRequest* request, ::skybox::ExportTraceReply* response, std::function<void(::grpc::Status)>) = 0;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      virtual void ExportTrace(::grpc::ClientContext* context, const ::skybox::ExportTraceRequest* request, ::skybox::ExportTraceReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      #else
+      virtual void ExportTrace(::grpc::ClientContext* context, const ::skybox::ExportTraceRequest* request, ::skybox::ExportTraceReply* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
+      #endif
+      virtual void GetStats(::grpc::ClientContext* context, const ::skybox::GetStatsRequest* request, ::skybox::GetStatsReply* response, std::function<void(::grpc::Status)>) = 0;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      virtual void GetStats(::grpc::ClientContext* context, const ::skybox::GetStatsRequest* request, ::skybox::GetStatsReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      #else
+      virtual void GetStats(::grpc::ClientContext* context, const ::skybox::GetStatsRequest* request, ::skybox::GetStatsReply* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
+      #endif
     };
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
     typedef class experimental_async_interface async_interface;
@@ -93,6 +158,16 @@ class SkyBoxService final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::skybox::GenerateSkyBoxReply>* PrepareAsyncGenerateSkyBoxRaw(::grpc::ClientContext* context, const ::skybox::GenerateSkyBoxRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::skybox::QueryJobReply>* AsyncQueryJobRaw(::grpc::ClientContext* context, const ::skybox::QueryJobRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::skybox::QueryJobReply>* PrepareAsyncQueryJobRaw(::grpc::ClientContext* context, const ::skybox::QueryJobRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::skybox::GenerateRegionReply>* AsyncGenerateRegionRaw(::grpc::ClientContext* context, const ::skybox::GenerateRegionRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::skybox::GenerateRegionReply>* PrepareAsyncGenerateRegionRaw(::grpc::ClientContext* context, const ::skybox::GenerateRegionRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::skybox::SetClientWeightReply>* AsyncSetClientWeightRaw(::grpc::ClientContext* context, const ::skybox::SetClientWeightRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::skybox::SetClientWeightReply>* PrepareAsyncSetClientWeightRaw(::grpc::ClientContext* context, const ::skybox::SetClientWeightRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::skybox::CancelJobReply>* AsyncCancelJobRaw(::grpc::ClientContext* context, const ::skybox::CancelJobRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::skybox::CancelJobReply>* PrepareAsyncCancelJobRaw(::grpc::ClientContext* context, const ::skybox::CancelJobRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::skybox::ExportTraceReply>* AsyncExportTraceRaw(::grpc::ClientContext* context, const ::skybox::ExportTraceRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::skybox::ExportTraceReply>* PrepareAsyncExportTraceRaw(::grpc::ClientContext* context, const ::skybox::ExportTraceRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::skybox::GetStatsReply>* AsyncGetStatsRaw(::grpc::ClientContext* context, const ::skybox::GetStatsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::skybox::GetStatsReply>* PrepareAsyncGetStatsRaw(::grpc::ClientContext* context, const ::skybox::GetStatsRequest& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -118,6 +193,41 @@ class SkyBoxService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::skybox::QueryJobReply>> PrepareAsyncQueryJob(::grpc::ClientContext* context, const ::skybox::QueryJobRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::skybox::QueryJobReply>>(PrepareAsyncQueryJobRaw(context, request, cq));
     }
+    ::grpc::Status GenerateRegion(::grpc::ClientContext* context, const ::skybox::GenerateRegionRequest& request, ::skybox::GenerateRegionReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::skybox::GenerateRegionReply>> AsyncGenerateRegion(::grpc::ClientContext* context, const ::skybox::GenerateRegionRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::skybox::GenerateRegionReply>>(AsyncGenerateRegionRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::skybox::GenerateRegionReply>> PrepareAsyncGenerateRegion(::grpc::ClientContext* context, const ::skybox::GenerateRegionRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::skybox::GenerateRegionReply>>(PrepareAsyncGenerateRegionRaw(context, request, cq));
+    }
+    ::grpc::Status SetClientWeight(::grpc::ClientContext* context, const ::skybox::SetClientWeightRequest& request, ::skybox::SetClientWeightReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::skybox::SetClientWeightReply>> AsyncSetClientWeight(::grpc::ClientContext* context, const ::skybox::SetClientWeightRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::skybox::SetClientWeightReply>>(AsyncSetClientWeightRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::skybox::SetClientWeightReply>> PrepareAsyncSetClientWeight(::grpc::ClientContext* context, const ::skybox::SetClientWeightRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::skybox::SetClientWeightReply>>(PrepareAsyncSetClientWeightRaw(context, request, cq));
+    }
+    ::grpc::Status CancelJob(::grpc::ClientContext* context, const ::skybox::CancelJobRequest& request, ::skybox::CancelJobReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::skybox::CancelJobReply>> AsyncCancelJob(::grpc::ClientContext* context, const ::skybox::CancelJobRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::skybox::CancelJobReply>>(AsyncCancelJobRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::skybox::CancelJobReply>> PrepareAsyncCancelJob(::grpc::ClientContext* context, const ::skybox::CancelJobRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::skybox::CancelJobReply>>(PrepareAsyncCancelJobRaw(context, request, cq));
+    }
+    ::grpc::Status ExportTrace(::grpc::ClientContext* context, const ::skybox::ExportTraceRequest& request, ::skybox::ExportTraceReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::skybox::ExportTraceReply>> AsyncExportTrace(::grpc::ClientContext* context, const ::skybox::ExportTraceRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::skybox::ExportTraceReply>>(AsyncExportTraceRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::skybox::ExportTraceReply>> PrepareAsyncExportTrace(::grpc::ClientContext* context, const ::skybox::ExportTraceRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::skybox::ExportTraceReply>>(PrepareAsyncExportTraceRaw(context, request, cq));
+    }
+    ::grpc::Status GetStats(::grpc::ClientContext* context, const ::skybox::GetStatsRequest& request, ::skybox::GetStatsReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::skybox::GetStatsReply>> AsyncGetStats(::grpc::ClientContext* context, const ::skybox::GetStatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::skybox::GetStatsReply>>(AsyncGetStatsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::skybox::GetStatsReply>> PrepareAsyncGetStats(::grpc::ClientContext* context, const ::skybox::GetStatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::skybox::GetStatsReply>>(PrepareAsyncGetStatsRaw(context, request, cq));
+    }
     class experimental_async final :
       public StubInterface::experimental_async_interface {
      public:
@@ -139,6 +249,36 @@ class SkyBoxService final {
       #else
       void QueryJob(::grpc::ClientContext* context, const ::skybox::QueryJobRequest* request, ::skybox::QueryJobReply* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
       #endif
+      void GenerateRegion(::grpc::ClientContext* context, const ::skybox::GenerateRegionRequest* request, ::skybox::GenerateRegionReply* response, std::function<void(::grpc::Status)>) override;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      void GenerateRegion(::grpc::ClientContext* context, const ::skybox::GenerateRegionRequest* request, ::skybox::GenerateRegionReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      #else
+      void GenerateRegion(::grpc::ClientContext* context, const ::skybox::GenerateRegionRequest* request, ::skybox::GenerateRegionReply* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
+      #endif
+      void SetClientWeight(::grpc::ClientContext* context, const ::skybox::SetClientWeightRequest* request, ::skybox::SetClientWeightReply* response, std::function<void(::grpc::Status)>) override;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      void SetClientWeight(::grpc::ClientContext* context, const ::skybox::SetClientWeightRequest* request, ::skybox::SetClientWeightReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      #else
+      void SetClientWeight(::grpc::ClientContext* context, const ::skybox::SetClientWeightRequest* request, ::skybox::SetClientWeightReply* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
+      #endif
+      void CancelJob(::grpc::ClientContext* context, const ::skybox::CancelJobRequest* request, ::skybox::CancelJobReply* response, std::function<void(::grpc::Status)>) override;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      void CancelJob(::grpc::ClientContext* context, const ::skybox::CancelJobRequest* request, ::skybox::CancelJobReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      #else
+      void CancelJob(::grpc::ClientContext* context, const ::skybox::CancelJobRequest* request, ::skybox::CancelJobReply* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
+      #endif
+      void ExportTrace(::grpc::ClientContext* context, const ::skybox::ExportTraceRequest* request, ::skybox::ExportTraceReply* response, std::function<void(::grpc::Status)>) override;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      void ExportTrace(::grpc::ClientContext* context, const ::skybox::ExportTraceRequest* request, ::skybox::ExportTraceReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      #else
+      void ExportTrace(::grpc::ClientContext* context, const ::skybox::ExportTraceRequest* request, ::skybox::ExportTraceReply* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
+      #endif
+      void GetStats(::grpc::ClientContext* context, const ::skybox::GetStatsRequest* request, ::skybox::GetStatsReply* response, std::function<void(::grpc::Status)>) override;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      void GetStats(::grpc::ClientContext* context, const ::skybox::GetStatsRequest* request, ::skybox::GetStatsReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      #else
+      void GetStats(::grpc::ClientContext* context, const ::skybox::GetStatsRequest* request, ::skybox::GetStatsReply* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
+      #endif
      private:
       friend class Stub;
       explicit experimental_async(Stub* stub): stub_(stub) { }
@@ -156,9 +296,24 @@ class SkyBoxService final {
     ::grpc::ClientAsyncResponseReader< ::skybox::GenerateSkyBoxReply>* PrepareAsyncGenerateSkyBoxRaw(::grpc::ClientContext* context, const ::skybox::GenerateSkyBoxRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::skybox::QueryJobReply>* AsyncQueryJobRaw(::grpc::ClientContext* context, const ::skybox::QueryJobRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::skybox::QueryJobReply>* PrepareAsyncQueryJobRaw(::grpc::ClientContext* context, const ::skybox::QueryJobRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::skybox::GenerateRegionReply>* AsyncGenerateRegionRaw(::grpc::ClientContext* context, const ::skybox::GenerateRegionRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::skybox::GenerateRegionReply>* PrepareAsyncGenerateRegionRaw(::grpc::ClientContext* context, const ::skybox::GenerateRegionRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::skybox::SetClientWeightReply>* AsyncSetClientWeightRaw(::grpc::ClientContext* context, const ::skybox::SetClientWeightRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::skybox::SetClientWeightReply>* PrepareAsyncSetClientWeightRaw(::grpc::ClientContext* context, const ::skybox::SetClientWeightRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::skybox::CancelJobReply>* AsyncCancelJobRaw(::grpc::ClientContext* context, const ::skybox::CancelJobRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::skybox::CancelJobReply>* PrepareAsyncCancelJobRaw(::grpc::ClientContext* context, const ::skybox::CancelJobRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::skybox::ExportTraceReply>* AsyncExportTraceRaw(::grpc::ClientContext* context, const ::skybox::ExportTraceRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::skybox::ExportTraceReply>* PrepareAsyncExportTraceRaw(::grpc::ClientContext* context, const ::skybox::ExportTraceRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::skybox::GetStatsReply>* AsyncGetStatsRaw(::grpc::ClientContext* context, const ::skybox::GetStatsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::skybox::GetStatsReply>* PrepareAsyncGetStatsRaw(::grpc::ClientContext* context, const ::skybox::GetStatsRequest& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_SayHello_;
     const ::grpc::internal::RpcMethod rpcmethod_GenerateSkyBox_;
     const ::grpc::internal::RpcMethod rpcmethod_QueryJob_;
+    const ::grpc::internal::RpcMethod rpcmethod_GenerateRegion_;
+    const ::grpc::internal::RpcMethod rpcmethod_SetClientWeight_;
+    const ::grpc::internal::RpcMethod rpcmethod_CancelJob_;
+    const ::grpc::internal::RpcMethod rpcmethod_ExportTrace_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetStats_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -169,6 +324,11 @@ class SkyBoxService final {
     virtual ::grpc::Status SayHello(::grpc::ServerContext* context, const ::skybox::HelloRequest* request, ::skybox::HelloReply* response);
     virtual ::grpc::Status GenerateSkyBox(::grpc::ServerContext* context, const ::skybox::GenerateSkyBoxRequest* request, ::skybox::GenerateSkyBoxReply* response);
     virtual ::grpc::Status QueryJob(::grpc::ServerContext* context, const ::skybox::QueryJobRequest* request, ::skybox::QueryJobReply* response);
+    virtual ::grpc::Status GenerateRegion(::grpc::ServerContext* context, const ::skybox::GenerateRegionRequest* request, ::skybox::GenerateRegionReply* response);
+    virtual ::grpc::Status SetClientWeight(::grpc::ServerContext* context, const ::skybox::SetClientWeightRequest* request, ::skybox::SetClientWeightReply* response);
+    virtual ::grpc::Status CancelJob(::grpc::ServerContext* context, const ::skybox::CancelJobRequest* request, ::skybox::CancelJobReply* response);
+    virtual ::grpc::Status ExportTrace(::grpc::ServerContext* context, const ::skybox::ExportTraceRequest* request, ::skybox::ExportTraceReply* response);
+    virtual ::grpc::Status GetStats(::grpc::ServerContext* context, const ::skybox::GetStatsRequest* request, ::skybox::GetStatsReply* response);
   };
   template <class BaseClass>
   class WithAsyncMethod_SayHello : public BaseClass {
@@ -230,7 +390,107 @@ class SkyBoxService final {
       ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_SayHello<WithAsyncMethod_GenerateSkyBox<WithAsyncMethod_QueryJob<Service > > > AsyncService;
+  template <class BaseClass>
+  class WithAsyncMethod_GenerateRegion : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_GenerateRegion() {
+      ::grpc::Service::MarkMethodAsync(3);
+    }
+    ~WithAsyncMethod_GenerateRegion() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GenerateRegion(::grpc::ServerContext* /*context*/, const ::skybox::GenerateRegionRequest* /*request*/, ::skybox::GenerateRegionReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGenerateRegion(::grpc::ServerContext* context, ::skybox::GenerateRegionRequest* request, ::grpc::ServerAsyncResponseWriter< ::skybox::GenerateRegionReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_SetClientWeight : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_SetClientWeight() {
+      ::grpc::Service::MarkMethodAsync(4);
+    }
+    ~WithAsyncMethod_SetClientWeight() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetClientWeight(::grpc::ServerContext* /*context*/, const ::skybox::SetClientWeightRequest* /*request*/, ::skybox::SetClientWeightReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSetClientWeight(::grpc::ServerContext* context, ::skybox::SetClientWeightRequest* request, ::grpc::ServerAsyncResponseWriter< ::skybox::SetClientWeightReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_CancelJob : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_CancelJob() {
+      ::grpc::Service::MarkMethodAsync(5);
+    }
+    ~WithAsyncMethod_CancelJob() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CancelJob(::grpc::ServerContext* /*context*/, const ::skybox::CancelJobRequest* /*request*/, ::skybox::CancelJobReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestCancelJob(::grpc::ServerContext* context, ::skybox::CancelJobRequest* request, ::grpc::ServerAsyncResponseWriter< ::skybox::CancelJobReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_ExportTrace : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_ExportTrace() {
+      ::grpc::Service::MarkMethodAsync(6);
+    }
+    ~WithAsyncMethod_ExportTrace() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExportTrace(::grpc::ServerContext* /*context*/, const ::skybox::ExportTraceRequest* /*request*/, ::skybox::ExportTraceReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestExportTrace(::grpc::ServerContext* context, ::skybox::ExportTraceRequest* request, ::grpc::ServerAsyncResponseWriter< ::skybox::ExportTraceReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_GetStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_GetStats() {
+      ::grpc::Service::MarkMethodAsync(7);
+    }
+    ~WithAsyncMethod_GetStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetStats(::grpc::ServerContext* /*context*/, const ::skybox::GetStatsRequest* /*request*/, ::skybox::GetStatsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetStats(::grpc::ServerContext* context, ::skybox::GetStatsRequest* request, ::grpc::ServerAsyncResponseWriter< ::skybox::GetStatsReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_SayHello<WithAsyncMethod_GenerateSkyBox<WithAsyncMethod_QueryJob<WithAsyncMethod_GenerateRegion<WithAsyncMethod_SetClientWeight<WithAsyncMethod_CancelJob<WithAsyncMethod_ExportTrace<WithAsyncMethod_GetStats<Service > > > > > > > > AsyncService;
   template <class BaseClass>
   class ExperimentalWithCallbackMethod_SayHello : public BaseClass {
    private:
@@ -372,115 +632,435 @@ class SkyBoxService final {
     #endif
       { return nullptr; }
   };
-  #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-  typedef ExperimentalWithCallbackMethod_SayHello<ExperimentalWithCallbackMethod_GenerateSkyBox<ExperimentalWithCallbackMethod_QueryJob<Service > > > CallbackService;
-  #endif
-
-  typedef ExperimentalWithCallbackMethod_SayHello<ExperimentalWithCallbackMethod_GenerateSkyBox<ExperimentalWithCallbackMethod_QueryJob<Service > > > ExperimentalCallbackService;
   template <class BaseClass>
-  class WithGenericMethod_SayHello : public BaseClass {
+  class ExperimentalWithCallbackMethod_GenerateRegion : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_SayHello() {
-      ::grpc::Service::MarkMethodGeneric(0);
+    ExperimentalWithCallbackMethod_GenerateRegion() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodCallback(3,
+          new ::grpc::internal::CallbackUnaryHandler< ::skybox::GenerateRegionRequest, ::skybox::GenerateRegionReply>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::skybox::GenerateRegionRequest* request, ::skybox::GenerateRegionReply* response) { return this->GenerateRegion(context, request, response); }));}
+    void SetMessageAllocatorFor_GenerateRegion(
+        ::grpc::experimental::MessageAllocator< ::skybox::GenerateRegionRequest, ::skybox::GenerateRegionReply>* allocator) {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(3);
+    #else
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(3);
+    #endif
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::skybox::GenerateRegionRequest, ::skybox::GenerateRegionReply>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithGenericMethod_SayHello() override {
+    ~ExperimentalWithCallbackMethod_GenerateRegion() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SayHello(::grpc::ServerContext* /*context*/, const ::skybox::HelloRequest* /*request*/, ::skybox::HelloReply* /*response*/) override {
+    ::grpc::Status GenerateRegion(::grpc::ServerContext* /*context*/, const ::skybox::GenerateRegionRequest* /*request*/, ::skybox::GenerateRegionReply* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* GenerateRegion(
+      ::grpc::CallbackServerContext* /*context*/, const ::skybox::GenerateRegionRequest* /*request*/, ::skybox::GenerateRegionReply* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* GenerateRegion(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::skybox::GenerateRegionRequest* /*request*/, ::skybox::GenerateRegionReply* /*response*/)
+    #endif
+      { return nullptr; }
   };
   template <class BaseClass>
-  class WithGenericMethod_GenerateSkyBox : public BaseClass {
+  class ExperimentalWithCallbackMethod_SetClientWeight : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_GenerateSkyBox() {
-      ::grpc::Service::MarkMethodGeneric(1);
+    ExperimentalWithCallbackMethod_SetClientWeight() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodCallback(4,
+          new ::grpc::internal::CallbackUnaryHandler< ::skybox::SetClientWeightRequest, ::skybox::SetClientWeightReply>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::skybox::SetClientWeightRequest* request, ::skybox::SetClientWeightReply* response) { return this->SetClientWeight(context, request, response); }));}
+    void SetMessageAllocatorFor_SetClientWeight(
+        ::grpc::experimental::MessageAllocator< ::skybox::SetClientWeightRequest, ::skybox::SetClientWeightReply>* allocator) {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(4);
+    #else
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(4);
+    #endif
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::skybox::SetClientWeightRequest, ::skybox::SetClientWeightReply>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithGenericMethod_GenerateSkyBox() override {
+    ~ExperimentalWithCallbackMethod_SetClientWeight() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GenerateSkyBox(::grpc::ServerContext* /*context*/, const ::skybox::GenerateSkyBoxRequest* /*request*/, ::skybox::GenerateSkyBoxReply* /*response*/) override {
+    ::grpc::Status SetClientWeight(::grpc::ServerContext* /*context*/, const ::skybox::SetClientWeightRequest* /*request*/, ::skybox::SetClientWeightReply* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* SetClientWeight(
+      ::grpc::CallbackServerContext* /*context*/, const ::skybox::SetClientWeightRequest* /*request*/, ::skybox::SetClientWeightReply* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* SetClientWeight(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::skybox::SetClientWeightRequest* /*request*/, ::skybox::SetClientWeightReply* /*response*/)
+    #endif
+      { return nullptr; }
   };
   template <class BaseClass>
-  class WithGenericMethod_QueryJob : public BaseClass {
+  class ExperimentalWithCallbackMethod_CancelJob : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_QueryJob() {
-      ::grpc::Service::MarkMethodGeneric(2);
+    ExperimentalWithCallbackMethod_CancelJob() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodCallback(5,
+          new ::grpc::internal::CallbackUnaryHandler< ::skybox::CancelJobRequest, ::skybox::CancelJobReply>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::skybox::CancelJobRequest* request, ::skybox::CancelJobReply* response) { return this->CancelJob(context, request, response); }));}
+    void SetMessageAllocatorFor_CancelJob(
+        ::grpc::experimental::MessageAllocator< ::skybox::CancelJobRequest, ::skybox::CancelJobReply>* allocator) {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(5);
+    #else
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(5);
+    #endif
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::skybox::CancelJobRequest, ::skybox::CancelJobReply>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithGenericMethod_QueryJob() override {
+    ~ExperimentalWithCallbackMethod_CancelJob() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status QueryJob(::grpc::ServerContext* /*context*/, const ::skybox::QueryJobRequest* /*request*/, ::skybox::QueryJobReply* /*response*/) override {
+    ::grpc::Status CancelJob(::grpc::ServerContext* /*context*/, const ::skybox::CancelJobRequest* /*request*/, ::skybox::CancelJobReply* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* CancelJob(
+      ::grpc::CallbackServerContext* /*context*/, const ::skybox::CancelJobRequest* /*request*/, ::skybox::CancelJobReply* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* CancelJob(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::skybox::CancelJobRequest* /*request*/, ::skybox::CancelJobReply* /*response*/)
+    #endif
+      { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawMethod_SayHello : public BaseClass {
+  class ExperimentalWithCallbackMethod_ExportTrace : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_SayHello() {
-      ::grpc::Service::MarkMethodRaw(0);
+    ExperimentalWithCallbackMethod_ExportTrace() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodCallback(6,
+          new ::grpc::internal::CallbackUnaryHandler< ::skybox::ExportTraceRequest, ::skybox::ExportTraceReply>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::skybox::ExportTraceRequest* request, ::skybox::ExportTraceReply* response) { return this->ExportTrace(context, request, response); }));}
+    void SetMessageAllocatorFor_ExportTrace(
+        ::grpc::experimental::MessageAllocator< ::skybox::ExportTraceRequest, ::skybox::ExportTraceReply>* allocator) {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(6);
+    #else
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(6);
+    #endif
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::skybox::ExportTraceRequest, ::skybox::ExportTraceReply>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithRawMethod_SayHello() override {
+    ~ExperimentalWithCallbackMethod_ExportTrace() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SayHello(::grpc::ServerContext* /*context*/, const ::skybox::HelloRequest* /*request*/, ::skybox::HelloReply* /*response*/) override {
+    ::grpc::Status ExportTrace(::grpc::ServerContext* /*context*/, const ::skybox::ExportTraceRequest* /*request*/, ::skybox::ExportTraceReply* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestSayHello(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
-    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* ExportTrace(
+      ::grpc::CallbackServerContext* /*context*/, const ::skybox::ExportTraceRequest* /*request*/, ::skybox::ExportTraceReply* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* ExportTrace(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::skybox::ExportTraceRequest* /*request*/, ::skybox::ExportTraceReply* /*response*/)
+    #endif
+      { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawMethod_GenerateSkyBox : public BaseClass {
+  class ExperimentalWithCallbackMethod_GetStats : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_GenerateSkyBox() {
-      ::grpc::Service::MarkMethodRaw(1);
+    ExperimentalWithCallbackMethod_GetStats() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodCallback(7,
+          new ::grpc::internal::CallbackUnaryHandler< ::skybox::GetStatsRequest, ::skybox::GetStatsReply>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::skybox::GetStatsRequest* request, ::skybox::GetStatsReply* response) { return this->GetStats(context, request, response); }));}
+    void SetMessageAllocatorFor_GetStats(
+        ::grpc::experimental::MessageAllocator< ::skybox::GetStatsRequest, ::skybox::GetStatsReply>* allocator) {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(7);
+    #else
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(7);
+    #endif
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::skybox::GetStatsRequest, ::skybox::GetStatsReply>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithRawMethod_GenerateSkyBox() override {
+    ~ExperimentalWithCallbackMethod_GetStats() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GenerateSkyBox(::grpc::ServerContext* /*context*/, const ::skybox::GenerateSkyBoxRequest* /*request*/, ::skybox::GenerateSkyBoxReply* /*response*/) override {
+    ::grpc::Status GetStats(::grpc::ServerContext* /*context*/, const ::skybox::GetStatsRequest* /*request*/, ::skybox::GetStatsReply* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestGenerateSkyBox(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
-    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* GetStats(
+      ::grpc::CallbackServerContext* /*context*/, const ::skybox::GetStatsRequest* /*request*/, ::skybox::GetStatsReply* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* GetStats(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::skybox::GetStatsRequest* /*request*/, ::skybox::GetStatsReply* /*response*/)
+    #endif
+      { return nullptr; }
   };
+  #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+  typedef ExperimentalWithCallbackMethod_SayHello<ExperimentalWithCallbackMethod_GenerateSkyBox<ExperimentalWithCallbackMethod_QueryJob<ExperimentalWithCallbackMethod_GenerateRegion<ExperimentalWithCallbackMethod_SetClientWeight<ExperimentalWithCallbackMethod_CancelJob<ExperimentalWithCallbackMethod_ExportTrace<ExperimentalWithCallbackMethod_GetStats<Service > > > > > > > > CallbackService;
+  #endif
+
+  typedef ExperimentalWithCallbackMethod_SayHello<ExperimentalWithCallbackMethod_GenerateSkyBox<ExperimentalWithCallbackMethod_QueryJob<ExperimentalWithCallbackMethod_GenerateRegion<ExperimentalWithCallbackMethod_SetClientWeight<ExperimentalWithCallbackMethod_CancelJob<ExperimentalWithCallbackMethod_ExportTrace<ExperimentalWithCallbackMethod_GetStats<Service > > > > > > > > ExperimentalCallbackService;
   template <class BaseClass>
-  class WithRawMethod_QueryJob : public BaseClass {
+  class WithGenericMethod_SayHello : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_QueryJob() {
-      ::grpc::Service::MarkMethodRaw(2);
+    WithGenericMethod_SayHello() {
+      ::grpc::Service::MarkMethodGeneric(0);
     }
-    ~WithRawMethod_QueryJob() override {
+    ~WithGenericMethod_SayHello() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status QueryJob(::grpc::ServerContext* /*context*/, const ::skybox::QueryJobRequest* /*request*/, ::skybox::QueryJobReply* /*response*/) override {
+    ::grpc::Status SayHello(::grpc::ServerContext* /*context*/, const ::skybox::HelloRequest* /*request*/, ::skybox::HelloReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_GenerateSkyBox : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GenerateSkyBox() {
+      ::grpc::Service::MarkMethodGeneric(1);
+    }
+    ~WithGenericMethod_GenerateSkyBox() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GenerateSkyBox(::grpc::ServerContext* /*context*/, const ::skybox::GenerateSkyBoxRequest* /*request*/, ::skybox::GenerateSkyBoxReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_QueryJob : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_QueryJob() {
+      ::grpc::Service::MarkMethodGeneric(2);
+    }
+    ~WithGenericMethod_QueryJob() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status QueryJob(::grpc::ServerContext* /*context*/, const ::skybox::QueryJobRequest* /*request*/, ::skybox::QueryJobReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_GenerateRegion : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GenerateRegion() {
+      ::grpc::Service::MarkMethodGeneric(3);
+    }
+    ~WithGenericMethod_GenerateRegion() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GenerateRegion(::grpc::ServerContext* /*context*/, const ::skybox::GenerateRegionRequest* /*request*/, ::skybox::GenerateRegionReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_SetClientWeight : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SetClientWeight() {
+      ::grpc::Service::MarkMethodGeneric(4);
+    }
+    ~WithGenericMethod_SetClientWeight() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetClientWeight(::grpc::ServerContext* /*context*/, const ::skybox::SetClientWeightRequest* /*request*/, ::skybox::SetClientWeightReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_CancelJob : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_CancelJob() {
+      ::grpc::Service::MarkMethodGeneric(5);
+    }
+    ~WithGenericMethod_CancelJob() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CancelJob(::grpc::ServerContext* /*context*/, const ::skybox::CancelJobRequest* /*request*/, ::skybox::CancelJobReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_ExportTrace : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_ExportTrace() {
+      ::grpc::Service::MarkMethodGeneric(6);
+    }
+    ~WithGenericMethod_ExportTrace() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExportTrace(::grpc::ServerContext* /*context*/, const ::skybox::ExportTraceRequest* /*request*/, ::skybox::ExportTraceReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_GetStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GetStats() {
+      ::grpc::Service::MarkMethodGeneric(7);
+    }
+    ~WithGenericMethod_GetStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetStats(::grpc::ServerContext* /*context*/, const ::skybox::GetStatsRequest* /*request*/, ::skybox::GetStatsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SayHello : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SayHello() {
+      ::grpc::Service::MarkMethodRaw(0);
+    }
+    ~WithRawMethod_SayHello() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SayHello(::grpc::ServerContext* /*context*/, const ::skybox::HelloRequest* /*request*/, ::skybox::HelloReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSayHello(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_GenerateSkyBox : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GenerateSkyBox() {
+      ::grpc::Service::MarkMethodRaw(1);
+    }
+    ~WithRawMethod_GenerateSkyBox() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GenerateSkyBox(::grpc::ServerContext* /*context*/, const ::skybox::GenerateSkyBoxRequest* /*request*/, ::skybox::GenerateSkyBoxReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGenerateSkyBox(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_QueryJob : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_QueryJob() {
+      ::grpc::Service::MarkMethodRaw(2);
+    }
+    ~WithRawMethod_QueryJob() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status QueryJob(::grpc::ServerContext* /*context*/, const ::skybox::QueryJobRequest* /*request*/, ::skybox::QueryJobReply* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
@@ -489,6 +1069,106 @@ class SkyBoxService final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_GenerateRegion : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GenerateRegion() {
+      ::grpc::Service::MarkMethodRaw(3);
+    }
+    ~WithRawMethod_GenerateRegion() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GenerateRegion(::grpc::ServerContext* /*context*/, const ::skybox::GenerateRegionRequest* /*request*/, ::skybox::GenerateRegionReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGenerateRegion(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SetClientWeight : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SetClientWeight() {
+      ::grpc::Service::MarkMethodRaw(4);
+    }
+    ~WithRawMethod_SetClientWeight() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetClientWeight(::grpc::ServerContext* /*context*/, const ::skybox::SetClientWeightRequest* /*request*/, ::skybox::SetClientWeightReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSetClientWeight(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_CancelJob : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_CancelJob() {
+      ::grpc::Service::MarkMethodRaw(5);
+    }
+    ~WithRawMethod_CancelJob() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CancelJob(::grpc::ServerContext* /*context*/, const ::skybox::CancelJobRequest* /*request*/, ::skybox::CancelJobReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestCancelJob(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_ExportTrace : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ExportTrace() {
+      ::grpc::Service::MarkMethodRaw(6);
+    }
+    ~WithRawMethod_ExportTrace() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExportTrace(::grpc::ServerContext* /*context*/, const ::skybox::ExportTraceRequest* /*request*/, ::skybox::ExportTraceReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestExportTrace(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_GetStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetStats() {
+      ::grpc::Service::MarkMethodRaw(7);
+    }
+    ~WithRawMethod_GetStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetStats(::grpc::ServerContext* /*context*/, const ::skybox::GetStatsRequest* /*request*/, ::skybox::GetStatsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetStats(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class ExperimentalWithRawCallbackMethod_SayHello : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -603,6 +1283,196 @@ class SkyBoxService final {
       { return nullptr; }
   };
   template <class BaseClass>
+  class ExperimentalWithRawCallbackMethod_GenerateRegion : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithRawCallbackMethod_GenerateRegion() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodRawCallback(3,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GenerateRegion(context, request, response); }));
+    }
+    ~ExperimentalWithRawCallbackMethod_GenerateRegion() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GenerateRegion(::grpc::ServerContext* /*context*/, const ::skybox::GenerateRegionRequest* /*request*/, ::skybox::GenerateRegionReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* GenerateRegion(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* GenerateRegion(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class ExperimentalWithRawCallbackMethod_SetClientWeight : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithRawCallbackMethod_SetClientWeight() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodRawCallback(4,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetClientWeight(context, request, response); }));
+    }
+    ~ExperimentalWithRawCallbackMethod_SetClientWeight() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetClientWeight(::grpc::ServerContext* /*context*/, const ::skybox::SetClientWeightRequest* /*request*/, ::skybox::SetClientWeightReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* SetClientWeight(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* SetClientWeight(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class ExperimentalWithRawCallbackMethod_CancelJob : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithRawCallbackMethod_CancelJob() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodRawCallback(5,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->CancelJob(context, request, response); }));
+    }
+    ~ExperimentalWithRawCallbackMethod_CancelJob() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status CancelJob(::grpc::ServerContext* /*context*/, const ::skybox::CancelJobRequest* /*request*/, ::skybox::CancelJobReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* CancelJob(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* CancelJob(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class ExperimentalWithRawCallbackMethod_ExportTrace : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithRawCallbackMethod_ExportTrace() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodRawCallback(6,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ExportTrace(context, request, response); }));
+    }
+    ~ExperimentalWithRawCallbackMethod_ExportTrace() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExportTrace(::grpc::ServerContext* /*context*/, const ::skybox::ExportTraceRequest* /*request*/, ::skybox::ExportTraceReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* ExportTrace(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* ExportTrace(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class ExperimentalWithRawCallbackMethod_GetStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithRawCallbackMethod_GetStats() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodRawCallback(7,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetStats(context, request, response); }));
+    }
+    ~ExperimentalWithRawCallbackMethod_GetStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetStats(::grpc::ServerContext* /*context*/, const ::skybox::GetStatsRequest* /*request*/, ::skybox::GetStatsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* GetStats(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* GetStats(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_SayHello : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -683,9 +1553,144 @@ class SkyBoxService final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedQueryJob(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::skybox::QueryJobRequest,::skybox::QueryJobReply>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_SayHello<WithStreamedUnaryMethod_GenerateSkyBox<WithStreamedUnaryMethod_QueryJob<Service > > > StreamedUnaryService;
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_GenerateRegion : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_GenerateRegion() {
+      ::grpc::Service::MarkMethodStreamed(3,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::skybox::GenerateRegionRequest, ::skybox::GenerateRegionReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::skybox::GenerateRegionRequest, ::skybox::GenerateRegionReply>* streamer) {
+                       return this->StreamedGenerateRegion(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_GenerateRegion() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GenerateRegion(::grpc::ServerContext* /*context*/, const ::skybox::GenerateRegionRequest* /*request*/, ::skybox::GenerateRegionReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedGenerateRegion(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::skybox::GenerateRegionRequest,::skybox::GenerateRegionReply>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_SetClientWeight : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_SetClientWeight() {
+      ::grpc::Service::MarkMethodStreamed(4,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::skybox::SetClientWeightRequest, ::skybox::SetClientWeightReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::skybox::SetClientWeightRequest, ::skybox::SetClientWeightReply>* streamer) {
+                       return this->StreamedSetClientWeight(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_SetClientWeight() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status SetClientWeight(::grpc::ServerContext* /*context*/, const ::skybox::SetClientWeightRequest* /*request*/, ::skybox::SetClientWeightReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedSetClientWeight(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::skybox::SetClientWeightRequest,::skybox::SetClientWeightReply>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_CancelJob : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_CancelJob() {
+      ::grpc::Service::MarkMethodStreamed(5,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::skybox::CancelJobRequest, ::skybox::CancelJobReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::skybox::CancelJobRequest, ::skybox::CancelJobReply>* streamer) {
+                       return this->StreamedCancelJob(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_CancelJob() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status CancelJob(::grpc::ServerContext* /*context*/, const ::skybox::CancelJobRequest* /*request*/, ::skybox::CancelJobReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedCancelJob(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::skybox::CancelJobRequest,::skybox::CancelJobReply>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_ExportTrace : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_ExportTrace() {
+      ::grpc::Service::MarkMethodStreamed(6,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::skybox::ExportTraceRequest, ::skybox::ExportTraceReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::skybox::ExportTraceRequest, ::skybox::ExportTraceReply>* streamer) {
+                       return this->StreamedExportTrace(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_ExportTrace() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status ExportTrace(::grpc::ServerContext* /*context*/, const ::skybox::ExportTraceRequest* /*request*/, ::skybox::ExportTraceReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedExportTrace(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::skybox::ExportTraceRequest,::skybox::ExportTraceReply>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_GetStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_GetStats() {
+      ::grpc::Service::MarkMethodStreamed(7,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::skybox::GetStatsRequest, ::skybox::GetStatsReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::skybox::GetStatsRequest, ::skybox::GetStatsReply>* streamer) {
+                       return this->StreamedGetStats(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_GetStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GetStats(::grpc::ServerContext* /*context*/, const ::skybox::GetStatsRequest* /*request*/, ::skybox::GetStatsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedGetStats(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::skybox::GetStatsRequest,::skybox::GetStatsReply>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_SayHello<WithStreamedUnaryMethod_GenerateSkyBox<WithStreamedUnaryMethod_QueryJob<WithStreamedUnaryMethod_GenerateRegion<WithStreamedUnaryMethod_SetClientWeight<WithStreamedUnaryMethod_CancelJob<WithStreamedUnaryMethod_ExportTrace<WithStreamedUnaryMethod_GetStats<Service > > > > > > > > StreamedUnaryService;
   typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_SayHello<WithStreamedUnaryMethod_GenerateSkyBox<WithStreamedUnaryMethod_QueryJob<Service > > > StreamedService;
+  typedef WithStreamedUnaryMethod_SayHello<WithStreamedUnaryMethod_GenerateSkyBox<WithStreamedUnaryMethod_QueryJob<WithStreamedUnaryMethod_GenerateRegion<WithStreamedUnaryMethod_SetClientWeight<WithStreamedUnaryMethod_CancelJob<WithStreamedUnaryMethod_ExportTrace<WithStreamedUnaryMethod_GetStats<Service > > > > > > > > StreamedService;
 };
 
 }  // namespace skybox
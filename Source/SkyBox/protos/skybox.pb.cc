@@ -65,7 +65,16 @@ struct PointDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PointDefaultTypeInternal _Point_default_instance_;
 constexpr GenerateSkyBoxRequest::GenerateSkyBoxRequest(
   ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : position_(nullptr){}
+  : position_(nullptr)
+  , resolution_(0)
+  , format_(0)
+
+  , quality_(0)
+
+  , scene_id_(0)
+  , supersede_(false)
+  , ibl_(0)
+{}
 struct GenerateSkyBoxRequestDefaultTypeInternal {
   constexpr GenerateSkyBoxRequestDefaultTypeInternal()
     : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
@@ -87,6 +96,178 @@ struct GenerateSkyBoxReplyDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT GenerateSkyBoxReplyDefaultTypeInternal _GenerateSkyBoxReply_default_instance_;
+constexpr GenerateRegionRequest::GenerateRegionRequest(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : positions_()
+  , min_(nullptr)
+  , max_(nullptr)
+  , spacing_(0)
+  , resolution_(0)
+  , format_(0)
+
+  , quality_(0)
+
+  , scene_id_(0)
+  , ibl_(0)
+{}
+struct GenerateRegionRequestDefaultTypeInternal {
+  constexpr GenerateRegionRequestDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~GenerateRegionRequestDefaultTypeInternal() {}
+  union {
+    GenerateRegionRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT GenerateRegionRequestDefaultTypeInternal _GenerateRegionRequest_default_instance_;
+constexpr GenerateRegionReply::GenerateRegionReply(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : job_id_(0)
+  , child_count_(0){}
+struct GenerateRegionReplyDefaultTypeInternal {
+  constexpr GenerateRegionReplyDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~GenerateRegionReplyDefaultTypeInternal() {}
+  union {
+    GenerateRegionReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT GenerateRegionReplyDefaultTypeInternal _GenerateRegionReply_default_instance_;
+constexpr SetClientWeightRequest::SetClientWeightRequest(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : client_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
+  , weight_(0){}
+struct SetClientWeightRequestDefaultTypeInternal {
+  constexpr SetClientWeightRequestDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~SetClientWeightRequestDefaultTypeInternal() {}
+  union {
+    SetClientWeightRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT SetClientWeightRequestDefaultTypeInternal _SetClientWeightRequest_default_instance_;
+constexpr SetClientWeightReply::SetClientWeightReply(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : weight_(0){}
+struct SetClientWeightReplyDefaultTypeInternal {
+  constexpr SetClientWeightReplyDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~SetClientWeightReplyDefaultTypeInternal() {}
+  union {
+    SetClientWeightReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT SetClientWeightReplyDefaultTypeInternal _SetClientWeightReply_default_instance_;
+constexpr CancelJobRequest::CancelJobRequest(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : job_id_(0){}
+struct CancelJobRequestDefaultTypeInternal {
+  constexpr CancelJobRequestDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~CancelJobRequestDefaultTypeInternal() {}
+  union {
+    CancelJobRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT CancelJobRequestDefaultTypeInternal _CancelJobRequest_default_instance_;
+constexpr CancelJobReply::CancelJobReply(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : job_id_(0)
+  , job_status_(0)
+{}
+struct CancelJobReplyDefaultTypeInternal {
+  constexpr CancelJobReplyDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~CancelJobReplyDefaultTypeInternal() {}
+  union {
+    CancelJobReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT CancelJobReplyDefaultTypeInternal _CancelJobReply_default_instance_;
+constexpr ExportTraceRequest::ExportTraceRequest(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : file_name_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
+  , max_events_(0){}
+struct ExportTraceRequestDefaultTypeInternal {
+  constexpr ExportTraceRequestDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~ExportTraceRequestDefaultTypeInternal() {}
+  union {
+    ExportTraceRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT ExportTraceRequestDefaultTypeInternal _ExportTraceRequest_default_instance_;
+constexpr ExportTraceReply::ExportTraceReply(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : trace_json_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
+  , event_count_(0)
+  , truncated_(false){}
+struct ExportTraceReplyDefaultTypeInternal {
+  constexpr ExportTraceReplyDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~ExportTraceReplyDefaultTypeInternal() {}
+  union {
+    ExportTraceReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT ExportTraceReplyDefaultTypeInternal _ExportTraceReply_default_instance_;
+constexpr GetStatsRequest::GetStatsRequest(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : prometheus_text_(false){}
+struct GetStatsRequestDefaultTypeInternal {
+  constexpr GetStatsRequestDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~GetStatsRequestDefaultTypeInternal() {}
+  union {
+    GetStatsRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT GetStatsRequestDefaultTypeInternal _GetStatsRequest_default_instance_;
+constexpr MetricValue::MetricValue(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : name_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
+  , value_(0){}
+struct MetricValueDefaultTypeInternal {
+  constexpr MetricValueDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~MetricValueDefaultTypeInternal() {}
+  union {
+    MetricValue _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT MetricValueDefaultTypeInternal _MetricValue_default_instance_;
+constexpr HistogramSummary::HistogramSummary(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : name_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
+  , count_(0)
+  , sum_(0)
+  , p50_(0)
+  , p90_(0)
+  , p99_(0)
+  , max_(0){}
+struct HistogramSummaryDefaultTypeInternal {
+  constexpr HistogramSummaryDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~HistogramSummaryDefaultTypeInternal() {}
+  union {
+    HistogramSummary _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT HistogramSummaryDefaultTypeInternal _HistogramSummary_default_instance_;
+constexpr GetStatsReply::GetStatsReply(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : counters_()
+  , gauges_()
+  , histograms_()
+  , prometheus_text_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string){}
+struct GetStatsReplyDefaultTypeInternal {
+  constexpr GetStatsReplyDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~GetStatsReplyDefaultTypeInternal() {}
+  union {
+    GetStatsReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT GetStatsReplyDefaultTypeInternal _GetStatsReply_default_instance_;
 constexpr QueryJobRequest::QueryJobRequest(
   ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
   : job_id_(0){}
@@ -101,8 +282,17 @@ struct QueryJobRequestDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT QueryJobRequestDefaultTypeInternal _QueryJobRequest_default_instance_;
 constexpr QueryJobReply::QueryJobReply(
   ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : job_id_(0)
+  : sh_coefficients_()
+  , _sh_coefficients_cached_byte_size_()
+  , child_job_ids_()
+  , _child_job_ids_cached_byte_size_()
+  , job_id_(0)
   , job_status_(0)
+
+  , total_count_(0)
+  , completed_count_(0)
+  , failed_count_(0)
+  , ibl_status_(0)
 {}
 struct QueryJobReplyDefaultTypeInternal {
   constexpr QueryJobReplyDefaultTypeInternal()
@@ -114,8 +304,8 @@ struct QueryJobReplyDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT QueryJobReplyDefaultTypeInternal _QueryJobReply_default_instance_;
 }  // namespace skybox
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_skybox_2eproto[7];
-static const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* file_level_enum_descriptors_skybox_2eproto[1];
+static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_skybox_2eproto[19];
+static const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* file_level_enum_descriptors_skybox_2eproto[5];
 static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_skybox_2eproto = nullptr;
 
 const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_skybox_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
@@ -145,6 +335,12 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_skybox_2eproto::offsets[] PROT
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   PROTOBUF_FIELD_OFFSET(::skybox::GenerateSkyBoxRequest, position_),
+  PROTOBUF_FIELD_OFFSET(::skybox::GenerateSkyBoxRequest, resolution_),
+  PROTOBUF_FIELD_OFFSET(::skybox::GenerateSkyBoxRequest, format_),
+  PROTOBUF_FIELD_OFFSET(::skybox::GenerateSkyBoxRequest, quality_),
+  PROTOBUF_FIELD_OFFSET(::skybox::GenerateSkyBoxRequest, scene_id_),
+  PROTOBUF_FIELD_OFFSET(::skybox::GenerateSkyBoxRequest, supersede_),
+  PROTOBUF_FIELD_OFFSET(::skybox::GenerateSkyBoxRequest, ibl_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::skybox::GenerateSkyBoxReply, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -152,6 +348,102 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_skybox_2eproto::offsets[] PROT
   ~0u,  // no _weak_field_map_
   PROTOBUF_FIELD_OFFSET(::skybox::GenerateSkyBoxReply, job_id_),
   ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::skybox::GenerateRegionRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::skybox::GenerateRegionRequest, min_),
+  PROTOBUF_FIELD_OFFSET(::skybox::GenerateRegionRequest, max_),
+  PROTOBUF_FIELD_OFFSET(::skybox::GenerateRegionRequest, spacing_),
+  PROTOBUF_FIELD_OFFSET(::skybox::GenerateRegionRequest, positions_),
+  PROTOBUF_FIELD_OFFSET(::skybox::GenerateRegionRequest, resolution_),
+  PROTOBUF_FIELD_OFFSET(::skybox::GenerateRegionRequest, format_),
+  PROTOBUF_FIELD_OFFSET(::skybox::GenerateRegionRequest, quality_),
+  PROTOBUF_FIELD_OFFSET(::skybox::GenerateRegionRequest, scene_id_),
+  PROTOBUF_FIELD_OFFSET(::skybox::GenerateRegionRequest, ibl_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::skybox::GenerateRegionReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::skybox::GenerateRegionReply, job_id_),
+  PROTOBUF_FIELD_OFFSET(::skybox::GenerateRegionReply, child_count_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::skybox::SetClientWeightRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::skybox::SetClientWeightRequest, client_),
+  PROTOBUF_FIELD_OFFSET(::skybox::SetClientWeightRequest, weight_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::skybox::SetClientWeightReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::skybox::SetClientWeightReply, weight_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::skybox::CancelJobRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::skybox::CancelJobRequest, job_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::skybox::CancelJobReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::skybox::CancelJobReply, job_id_),
+  PROTOBUF_FIELD_OFFSET(::skybox::CancelJobReply, job_status_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::skybox::ExportTraceRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::skybox::ExportTraceRequest, file_name_),
+  PROTOBUF_FIELD_OFFSET(::skybox::ExportTraceRequest, max_events_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::skybox::ExportTraceReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::skybox::ExportTraceReply, trace_json_),
+  PROTOBUF_FIELD_OFFSET(::skybox::ExportTraceReply, event_count_),
+  PROTOBUF_FIELD_OFFSET(::skybox::ExportTraceReply, truncated_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::skybox::GetStatsRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::skybox::GetStatsRequest, prometheus_text_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::skybox::MetricValue, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::skybox::MetricValue, name_),
+  PROTOBUF_FIELD_OFFSET(::skybox::MetricValue, value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::skybox::HistogramSummary, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::skybox::HistogramSummary, name_),
+  PROTOBUF_FIELD_OFFSET(::skybox::HistogramSummary, count_),
+  PROTOBUF_FIELD_OFFSET(::skybox::HistogramSummary, sum_),
+  PROTOBUF_FIELD_OFFSET(::skybox::HistogramSummary, p50_),
+  PROTOBUF_FIELD_OFFSET(::skybox::HistogramSummary, p90_),
+  PROTOBUF_FIELD_OFFSET(::skybox::HistogramSummary, p99_),
+  PROTOBUF_FIELD_OFFSET(::skybox::HistogramSummary, max_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::skybox::GetStatsReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::skybox::GetStatsReply, counters_),
+  PROTOBUF_FIELD_OFFSET(::skybox::GetStatsReply, gauges_),
+  PROTOBUF_FIELD_OFFSET(::skybox::GetStatsReply, histograms_),
+  PROTOBUF_FIELD_OFFSET(::skybox::GetStatsReply, prometheus_text_),
+  ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::skybox::QueryJobRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -164,15 +456,33 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_skybox_2eproto::offsets[] PROT
   ~0u,  // no _weak_field_map_
   PROTOBUF_FIELD_OFFSET(::skybox::QueryJobReply, job_id_),
   PROTOBUF_FIELD_OFFSET(::skybox::QueryJobReply, job_status_),
+  PROTOBUF_FIELD_OFFSET(::skybox::QueryJobReply, sh_coefficients_),
+  PROTOBUF_FIELD_OFFSET(::skybox::QueryJobReply, total_count_),
+  PROTOBUF_FIELD_OFFSET(::skybox::QueryJobReply, completed_count_),
+  PROTOBUF_FIELD_OFFSET(::skybox::QueryJobReply, failed_count_),
+  PROTOBUF_FIELD_OFFSET(::skybox::QueryJobReply, child_job_ids_),
+  PROTOBUF_FIELD_OFFSET(::skybox::QueryJobReply, ibl_status_),
 };
 static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, sizeof(::skybox::HelloRequest)},
   { 6, -1, sizeof(::skybox::HelloReply)},
   { 12, -1, sizeof(::skybox::Point)},
   { 20, -1, sizeof(::skybox::GenerateSkyBoxRequest)},
-  { 26, -1, sizeof(::skybox::GenerateSkyBoxReply)},
-  { 32, -1, sizeof(::skybox::QueryJobRequest)},
-  { 38, -1, sizeof(::skybox::QueryJobReply)},
+  { 32, -1, sizeof(::skybox::GenerateSkyBoxReply)},
+  { 38, -1, sizeof(::skybox::GenerateRegionRequest)},
+  { 52, -1, sizeof(::skybox::GenerateRegionReply)},
+  { 59, -1, sizeof(::skybox::SetClientWeightRequest)},
+  { 66, -1, sizeof(::skybox::SetClientWeightReply)},
+  { 72, -1, sizeof(::skybox::CancelJobRequest)},
+  { 78, -1, sizeof(::skybox::CancelJobReply)},
+  { 85, -1, sizeof(::skybox::ExportTraceRequest)},
+  { 92, -1, sizeof(::skybox::ExportTraceReply)},
+  { 100, -1, sizeof(::skybox::GetStatsRequest)},
+  { 106, -1, sizeof(::skybox::MetricValue)},
+  { 113, -1, sizeof(::skybox::HistogramSummary)},
+  { 125, -1, sizeof(::skybox::GetStatsReply)},
+  { 134, -1, sizeof(::skybox::QueryJobRequest)},
+  { 140, -1, sizeof(::skybox::QueryJobReply)},
 };
 
 static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
@@ -181,6 +491,18 @@ static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] =
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::skybox::_Point_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::skybox::_GenerateSkyBoxRequest_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::skybox::_GenerateSkyBoxReply_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::skybox::_GenerateRegionRequest_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::skybox::_GenerateRegionReply_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::skybox::_SetClientWeightRequest_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::skybox::_SetClientWeightReply_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::skybox::_CancelJobRequest_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::skybox::_CancelJobReply_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::skybox::_ExportTraceRequest_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::skybox::_ExportTraceReply_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::skybox::_GetStatsRequest_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::skybox::_MetricValue_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::skybox::_HistogramSummary_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::skybox::_GetStatsReply_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::skybox::_QueryJobRequest_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::skybox::_QueryJobReply_default_instance_),
 };
@@ -189,25 +511,75 @@ const char descriptor_table_protodef_skybox_2eproto[] PROTOBUF_SECTION_VARIABLE(
   "\n\014skybox.proto\022\006skybox\"\034\n\014HelloRequest\022\014"
   "\n\004name\030\001 \001(\t\"\035\n\nHelloReply\022\017\n\007message\030\001 "
   "\001(\t\"(\n\005Point\022\t\n\001x\030\001 \001(\002\022\t\n\001y\030\002 \001(\002\022\t\n\001z\030"
-  "\003 \001(\002\"8\n\025GenerateSkyBoxRequest\022\037\n\010positi"
-  "on\030\001 \001(\0132\r.skybox.Point\"%\n\023GenerateSkyBo"
-  "xReply\022\016\n\006job_id\030\001 \001(\005\"!\n\017QueryJobReques"
-  "t\022\016\n\006job_id\030\001 \001(\005\"F\n\rQueryJobReply\022\016\n\006jo"
-  "b_id\030\001 \001(\005\022%\n\njob_status\030\002 \001(\0162\021.skybox."
-  "JobStatus*@\n\tJobStatus\022\r\n\tSucceeded\020\000\022\n\n"
-  "\006Failed\020\001\022\013\n\007Waiting\020\002\022\013\n\007Working\020\0032\325\001\n\r"
-  "SkyBoxService\0226\n\010SayHello\022\024.skybox.Hello"
-  "Request\032\022.skybox.HelloReply\"\000\022N\n\016Generat"
-  "eSkyBox\022\035.skybox.GenerateSkyBoxRequest\032\033"
-  ".skybox.GenerateSkyBoxReply\"\000\022<\n\010QueryJo"
-  "b\022\027.skybox.QueryJobRequest\032\025.skybox.Quer"
-  "yJobReply\"\000B\'\n\021io.grpc.pb.skyboxB\013SkyBox"
-  "ProtoP\001\242\002\002PBb\006proto3"
+  "\003 \001(\002\"\334\001\n\025GenerateSkyBoxRequest\022\037\n\010posit"
+  "ion\030\001 \001(\0132\r.skybox.Point\022\022\n\nresolution\030\002"
+  " \001(\005\022#\n\006format\030\003 \001(\0162\023.skybox.ImageForma"
+  "t\022&\n\007quality\030\004 \001(\0162\025.skybox.QualityPrese"
+  "t\022\020\n\010scene_id\030\005 \001(\005\022\021\n\tsupersede\030\006 \001(\010\022\034"
+  "\n\003ibl\030\007 \001(\0162\017.skybox.IblMode\"%\n\023Generate"
+  "SkyBoxReply\022\016\n\006job_id\030\001 \001(\005\"\223\002\n\025Generate"
+  "RegionRequest\022\032\n\003min\030\001 \001(\0132\r.skybox.Poin"
+  "t\022\032\n\003max\030\002 \001(\0132\r.skybox.Point\022\017\n\007spacing"
+  "\030\003 \001(\002\022 \n\tpositions\030\004 \003(\0132\r.skybox.Point"
+  "\022\022\n\nresolution\030\005 \001(\005\022#\n\006format\030\006 \001(\0162\023.s"
+  "kybox.ImageFormat\022&\n\007quality\030\007 \001(\0162\025.sky"
+  "box.QualityPreset\022\020\n\010scene_id\030\010 \001(\005\022\034\n\003i"
+  "bl\030\t \001(\0162\017.skybox.IblMode\":\n\023GenerateReg"
+  "ionReply\022\016\n\006job_id\030\001 \001(\005\022\023\n\013child_count\030"
+  "\002 \001(\005\"8\n\026SetClientWeightRequest\022\016\n\006clien"
+  "t\030\001 \001(\t\022\016\n\006weight\030\002 \001(\002\"&\n\024SetClientWeig"
+  "htReply\022\016\n\006weight\030\001 \001(\002\"\"\n\020CancelJobRequ"
+  "est\022\016\n\006job_id\030\001 \001(\005\"G\n\016CancelJobReply\022\016\n"
+  "\006job_id\030\001 \001(\005\022%\n\njob_status\030\002 \001(\0162\021.skyb"
+  "ox.JobStatus\";\n\022ExportTraceRequest\022\021\n\tfi"
+  "le_name\030\001 \001(\t\022\022\n\nmax_events\030\002 \001(\005\"N\n\020Exp"
+  "ortTraceReply\022\022\n\ntrace_json\030\001 \001(\t\022\023\n\013eve"
+  "nt_count\030\002 \001(\005\022\021\n\ttruncated\030\003 \001(\010\"*\n\017Get"
+  "StatsRequest\022\027\n\017prometheus_text\030\001 \001(\010\"*\n"
+  "\013MetricValue\022\014\n\004name\030\001 \001(\t\022\r\n\005value\030\002 \001("
+  "\001\"p\n\020HistogramSummary\022\014\n\004name\030\001 \001(\t\022\r\n\005c"
+  "ount\030\002 \001(\001\022\013\n\003sum\030\003 \001(\001\022\013\n\003p50\030\004 \001(\001\022\013\n\003"
+  "p90\030\005 \001(\001\022\013\n\003p99\030\006 \001(\001\022\013\n\003max\030\007 \001(\001\"\242\001\n\r"
+  "GetStatsReply\022%\n\010counters\030\001 \003(\0132\023.skybox"
+  ".MetricValue\022#\n\006gauges\030\002 \003(\0132\023.skybox.Me"
+  "tricValue\022,\n\nhistograms\030\003 \003(\0132\030.skybox.H"
+  "istogramSummary\022\027\n\017prometheus_text\030\004 \001(\t"
+  "\"!\n\017QueryJobRequest\022\016\n\006job_id\030\001 \001(\005\"\341\001\n\r"
+  "QueryJobReply\022\016\n\006job_id\030\001 \001(\005\022%\n\njob_sta"
+  "tus\030\002 \001(\0162\021.skybox.JobStatus\022\027\n\017sh_coeff"
+  "icients\030\003 \003(\002\022\023\n\013total_count\030\004 \001(\005\022\027\n\017co"
+  "mpleted_count\030\005 \001(\005\022\024\n\014failed_count\030\006 \001("
+  "\005\022\025\n\rchild_job_ids\030\007 \003(\005\022%\n\nibl_status\030\010"
+  " \001(\0162\021.skybox.IblStatus*O\n\tJobStatus\022\r\n\t"
+  "Succeeded\020\000\022\n\n\006Failed\020\001\022\013\n\007Waiting\020\002\022\013\n\007"
+  "Working\020\003\022\r\n\tCancelled\020\004*<\n\013ImageFormat\022"
+  "\021\n\rServerDefault\020\000\022\007\n\003PNG\020\001\022\007\n\003EXR\020\002\022\010\n\004"
+  "RGBE\020\003*3\n\rQualityPreset\022\014\n\010Standard\020\000\022\t\n"
+  "\005Draft\020\001\022\t\n\005Final\020\002*C\n\007IblMode\022\020\n\014IblByQ"
+  "uality\020\000\022\n\n\006IblOff\020\001\022\r\n\tIblShOnly\020\002\022\013\n\007I"
+  "blFull\020\003*=\n\tIblStatus\022\017\n\013IblNotBaked\020\000\022\014"
+  "\n\010IblBaked\020\001\022\021\n\rIblBakeFailed\020\0022\276\004\n\rSkyB"
+  "oxService\0226\n\010SayHello\022\024.skybox.HelloRequ"
+  "est\032\022.skybox.HelloReply\"\000\022N\n\016GenerateSky"
+  "Box\022\035.skybox.GenerateSkyBoxRequest\032\033.sky"
+  "box.GenerateSkyBoxReply\"\000\022<\n\010QueryJob\022\027."
+  "skybox.QueryJobRequest\032\025.skybox.QueryJob"
+  "Reply\"\000\022N\n\016GenerateRegion\022\035.skybox.Gener"
+  "ateRegionRequest\032\033.skybox.GenerateRegion"
+  "Reply\"\000\022Q\n\017SetClientWeight\022\036.skybox.SetC"
+  "lientWeightRequest\032\034.skybox.SetClientWei"
+  "ghtReply\"\000\022?\n\tCancelJob\022\030.skybox.CancelJ"
+  "obRequest\032\026.skybox.CancelJobReply\"\000\022E\n\013E"
+  "xportTrace\022\032.skybox.ExportTraceRequest\032\030"
+  ".skybox.ExportTraceReply\"\000\022<\n\010GetStats\022\027"
+  ".skybox.GetStatsRequest\032\025.skybox.GetStat"
+  "sReply\"\000B\'\n\021io.grpc.pb.skyboxB\013SkyBoxPro"
+  "toP\001\242\002\002PBb\006proto3"
   ;
 static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_skybox_2eproto_once;
 const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_skybox_2eproto = {
-  false, false, 660, descriptor_table_protodef_skybox_2eproto, "skybox.proto", 
-  &descriptor_table_skybox_2eproto_once, nullptr, 0, 7,
+  false, false, 2657, descriptor_table_protodef_skybox_2eproto, "skybox.proto", 
+  &descriptor_table_skybox_2eproto_once, nullptr, 0, 19,
   schemas, file_default_instances, TableStruct_skybox_2eproto::offsets,
   file_level_metadata_skybox_2eproto, file_level_enum_descriptors_skybox_2eproto, file_level_service_descriptors_skybox_2eproto,
 };
@@ -230,6 +602,69 @@ bool JobStatus_IsValid(int value) {
     case 1:
     case 2:
     case 3:
+    case 4:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ImageFormat_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_skybox_2eproto);
+  return file_level_enum_descriptors_skybox_2eproto[1];
+}
+bool ImageFormat_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* QualityPreset_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_skybox_2eproto);
+  return file_level_enum_descriptors_skybox_2eproto[2];
+}
+bool QualityPreset_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* IblMode_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_skybox_2eproto);
+  return file_level_enum_descriptors_skybox_2eproto[3];
+}
+bool IblMode_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* IblStatus_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_skybox_2eproto);
+  return file_level_enum_descriptors_skybox_2eproto[4];
+}
+bool IblStatus_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
       return true;
     default:
       return false;
@@ -903,11 +1338,17 @@ GenerateSkyBoxRequest::GenerateSkyBoxRequest(const GenerateSkyBoxRequest& from)
   } else {
     position_ = nullptr;
   }
+  ::memcpy(&resolution_, &from.resolution_,
+    static_cast<size_t>(reinterpret_cast<char*>(&ibl_) -
+    reinterpret_cast<char*>(&resolution_)) + sizeof(ibl_));
   // @@protoc_insertion_point(copy_constructor:skybox.GenerateSkyBoxRequest)
 }
 
 void GenerateSkyBoxRequest::SharedCtor() {
-position_ = nullptr;
+::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
+    reinterpret_cast<char*>(&position_) - reinterpret_cast<char*>(this)),
+    0, static_cast<size_t>(reinterpret_cast<char*>(&ibl_) -
+    reinterpret_cast<char*>(&position_)) + sizeof(ibl_));
 }
 
 GenerateSkyBoxRequest::~GenerateSkyBoxRequest() {
@@ -941,6 +1382,9 @@ void GenerateSkyBoxRequest::Clear() {
     delete position_;
   }
   position_ = nullptr;
+  ::memset(&resolution_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&ibl_) -
+      reinterpret_cast<char*>(&resolution_)) + sizeof(ibl_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -958,6 +1402,51 @@ const char* GenerateSkyBoxRequest::_InternalParse(const char* ptr, ::PROTOBUF_NA
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
+      // int32 resolution = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          resolution_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .skybox.ImageFormat format = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_format(static_cast<::skybox::ImageFormat>(val));
+        } else goto handle_unusual;
+        continue;
+      // .skybox.QualityPreset quality = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_quality(static_cast<::skybox::QualityPreset>(val));
+        } else goto handle_unusual;
+        continue;
+      // int32 scene_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
+          scene_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bool supersede = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 48)) {
+          supersede_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .skybox.IblMode ibl = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 56)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_ibl(static_cast<::skybox::IblMode>(val));
+        } else goto handle_unusual;
+        continue;
       default: {
       handle_unusual:
         if ((tag & 7) == 4 || tag == 0) {
@@ -994,6 +1483,45 @@ failure:
         1, _Internal::position(this), target, stream);
   }
 
+  // int32 resolution = 2;
+  if (this->resolution() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_resolution(), target);
+  }
+
+  // .skybox.ImageFormat format = 3;
+  if (this->format() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_format(), target);
+  }
+
+  // .skybox.QualityPreset quality = 4;
+  if (this->quality() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_quality(), target);
+  }
+
+  // int32 scene_id = 5;
+  if (this->scene_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(5, this->_internal_scene_id(), target);
+  }
+
+  // bool supersede = 6;
+  if (this->supersede() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(6, this->_internal_supersede(), target);
+  }
+
+  // .skybox.IblMode ibl = 7;
+  if (this->ibl() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      7, this->_internal_ibl(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1017,6 +1545,43 @@ size_t GenerateSkyBoxRequest::ByteSizeLong() const {
         *position_);
   }
 
+  // int32 resolution = 2;
+  if (this->resolution() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_resolution());
+  }
+
+  // .skybox.ImageFormat format = 3;
+  if (this->format() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_format());
+  }
+
+  // .skybox.QualityPreset quality = 4;
+  if (this->quality() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_quality());
+  }
+
+  // int32 scene_id = 5;
+  if (this->scene_id() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_scene_id());
+  }
+
+  // bool supersede = 6;
+  if (this->supersede() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // .skybox.IblMode ibl = 7;
+  if (this->ibl() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_ibl());
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
         _internal_metadata_, total_size, &_cached_size_);
@@ -1051,6 +1616,24 @@ void GenerateSkyBoxRequest::MergeFrom(const GenerateSkyBoxRequest& from) {
   if (from.has_position()) {
     _internal_mutable_position()->::skybox::Point::MergeFrom(from._internal_position());
   }
+  if (from.resolution() != 0) {
+    _internal_set_resolution(from._internal_resolution());
+  }
+  if (from.format() != 0) {
+    _internal_set_format(from._internal_format());
+  }
+  if (from.quality() != 0) {
+    _internal_set_quality(from._internal_quality());
+  }
+  if (from.scene_id() != 0) {
+    _internal_set_scene_id(from._internal_scene_id());
+  }
+  if (from.supersede() != 0) {
+    _internal_set_supersede(from._internal_supersede());
+  }
+  if (from.ibl() != 0) {
+    _internal_set_ibl(from._internal_ibl());
+  }
 }
 
 void GenerateSkyBoxRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
@@ -1074,7 +1657,12 @@ bool GenerateSkyBoxRequest::IsInitialized() const {
 void GenerateSkyBoxRequest::InternalSwap(GenerateSkyBoxRequest* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  swap(position_, other->position_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GenerateSkyBoxRequest, ibl_)
+      + sizeof(GenerateSkyBoxRequest::ibl_)
+      - PROTOBUF_FIELD_OFFSET(GenerateSkyBoxRequest, position_)>(
+          reinterpret_cast<char*>(&position_),
+          reinterpret_cast<char*>(&other->position_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GenerateSkyBoxRequest::GetMetadata() const {
@@ -1273,22 +1861,3042 @@ void GenerateSkyBoxReply::InternalSwap(GenerateSkyBoxReply* other) {
 
 // ===================================================================
 
-class QueryJobRequest::_Internal {
+class GenerateRegionRequest::_Internal {
  public:
+  static const ::skybox::Point& min(const GenerateRegionRequest* msg);
+  static const ::skybox::Point& max(const GenerateRegionRequest* msg);
 };
 
-QueryJobRequest::QueryJobRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+const ::skybox::Point&
+GenerateRegionRequest::_Internal::min(const GenerateRegionRequest* msg) {
+  return *msg->min_;
+}
+const ::skybox::Point&
+GenerateRegionRequest::_Internal::max(const GenerateRegionRequest* msg) {
+  return *msg->max_;
+}
+GenerateRegionRequest::GenerateRegionRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  positions_(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:skybox.QueryJobRequest)
+  // @@protoc_insertion_point(arena_constructor:skybox.GenerateRegionRequest)
 }
-QueryJobRequest::QueryJobRequest(const QueryJobRequest& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
+GenerateRegionRequest::GenerateRegionRequest(const GenerateRegionRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      positions_(from.positions_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  job_id_ = from.job_id_;
-  // @@protoc_insertion_point(copy_constructor:skybox.QueryJobRequest)
-}
+  if (from._internal_has_min()) {
+    min_ = new ::skybox::Point(*from.min_);
+  } else {
+    min_ = nullptr;
+  }
+  if (from._internal_has_max()) {
+    max_ = new ::skybox::Point(*from.max_);
+  } else {
+    max_ = nullptr;
+  }
+  ::memcpy(&spacing_, &from.spacing_,
+    static_cast<size_t>(reinterpret_cast<char*>(&ibl_) -
+    reinterpret_cast<char*>(&spacing_)) + sizeof(ibl_));
+  // @@protoc_insertion_point(copy_constructor:skybox.GenerateRegionRequest)
+}
+
+void GenerateRegionRequest::SharedCtor() {
+::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
+    reinterpret_cast<char*>(&min_) - reinterpret_cast<char*>(this)),
+    0, static_cast<size_t>(reinterpret_cast<char*>(&ibl_) -
+    reinterpret_cast<char*>(&min_)) + sizeof(ibl_));
+}
+
+GenerateRegionRequest::~GenerateRegionRequest() {
+  // @@protoc_insertion_point(destructor:skybox.GenerateRegionRequest)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void GenerateRegionRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete min_;
+  if (this != internal_default_instance()) delete max_;
+}
+
+void GenerateRegionRequest::ArenaDtor(void* object) {
+  GenerateRegionRequest* _this = reinterpret_cast< GenerateRegionRequest* >(object);
+  (void)_this;
+}
+void GenerateRegionRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void GenerateRegionRequest::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void GenerateRegionRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:skybox.GenerateRegionRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  positions_.Clear();
+  if (GetArena() == nullptr && min_ != nullptr) {
+    delete min_;
+  }
+  min_ = nullptr;
+  if (GetArena() == nullptr && max_ != nullptr) {
+    delete max_;
+  }
+  max_ = nullptr;
+  ::memset(&spacing_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&ibl_) -
+      reinterpret_cast<char*>(&spacing_)) + sizeof(ibl_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GenerateRegionRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .skybox.Point min = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_min(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .skybox.Point max = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_max(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // float spacing = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 29)) {
+          spacing_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else goto handle_unusual;
+        continue;
+      // repeated .skybox.Point positions = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_positions(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // int32 resolution = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
+          resolution_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .skybox.ImageFormat format = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 48)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_format(static_cast<::skybox::ImageFormat>(val));
+        } else goto handle_unusual;
+        continue;
+      // .skybox.QualityPreset quality = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 56)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_quality(static_cast<::skybox::QualityPreset>(val));
+        } else goto handle_unusual;
+        continue;
+      // int32 scene_id = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 64)) {
+          scene_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .skybox.IblMode ibl = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 72)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_ibl(static_cast<::skybox::IblMode>(val));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* GenerateRegionRequest::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:skybox.GenerateRegionRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .skybox.Point min = 1;
+  if (this->has_min()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::min(this), target, stream);
+  }
+
+  // .skybox.Point max = 2;
+  if (this->has_max()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        2, _Internal::max(this), target, stream);
+  }
+
+  // float spacing = 3;
+  if (!(this->spacing() <= 0 && this->spacing() >= 0)) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(3, this->_internal_spacing(), target);
+  }
+
+  // repeated .skybox.Point positions = 4;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_positions_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, this->_internal_positions(i), target, stream);
+  }
+
+  // int32 resolution = 5;
+  if (this->resolution() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(5, this->_internal_resolution(), target);
+  }
+
+  // .skybox.ImageFormat format = 6;
+  if (this->format() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      6, this->_internal_format(), target);
+  }
+
+  // .skybox.QualityPreset quality = 7;
+  if (this->quality() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      7, this->_internal_quality(), target);
+  }
+
+  // int32 scene_id = 8;
+  if (this->scene_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(8, this->_internal_scene_id(), target);
+  }
+
+  // .skybox.IblMode ibl = 9;
+  if (this->ibl() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      9, this->_internal_ibl(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:skybox.GenerateRegionRequest)
+  return target;
+}
+
+size_t GenerateRegionRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:skybox.GenerateRegionRequest)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .skybox.Point positions = 4;
+  total_size += 1UL * this->_internal_positions_size();
+  for (const auto& msg : this->positions_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+
+  // .skybox.Point min = 1;
+  if (this->has_min()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *min_);
+  }
+
+  // .skybox.Point max = 2;
+  if (this->has_max()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *max_);
+  }
+
+  // float spacing = 3;
+  if (!(this->spacing() <= 0 && this->spacing() >= 0)) {
+    total_size += 1 + 4;
+  }
+
+  // int32 resolution = 5;
+  if (this->resolution() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_resolution());
+  }
+
+  // .skybox.ImageFormat format = 6;
+  if (this->format() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_format());
+  }
+
+  // .skybox.QualityPreset quality = 7;
+  if (this->quality() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_quality());
+  }
+
+  // int32 scene_id = 8;
+  if (this->scene_id() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_scene_id());
+  }
+
+  // .skybox.IblMode ibl = 9;
+  if (this->ibl() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_ibl());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void GenerateRegionRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:skybox.GenerateRegionRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  const GenerateRegionRequest* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GenerateRegionRequest>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:skybox.GenerateRegionRequest)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:skybox.GenerateRegionRequest)
+    MergeFrom(*source);
+  }
+}
+
+void GenerateRegionRequest::MergeFrom(const GenerateRegionRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:skybox.GenerateRegionRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  positions_.MergeFrom(from.positions_);
+  if (from.has_min()) {
+    _internal_mutable_min()->::skybox::Point::MergeFrom(from._internal_min());
+  }
+  if (from.has_max()) {
+    _internal_mutable_max()->::skybox::Point::MergeFrom(from._internal_max());
+  }
+  if (!(from.spacing() <= 0 && from.spacing() >= 0)) {
+    _internal_set_spacing(from._internal_spacing());
+  }
+  if (from.resolution() != 0) {
+    _internal_set_resolution(from._internal_resolution());
+  }
+  if (from.format() != 0) {
+    _internal_set_format(from._internal_format());
+  }
+  if (from.quality() != 0) {
+    _internal_set_quality(from._internal_quality());
+  }
+  if (from.scene_id() != 0) {
+    _internal_set_scene_id(from._internal_scene_id());
+  }
+  if (from.ibl() != 0) {
+    _internal_set_ibl(from._internal_ibl());
+  }
+}
+
+void GenerateRegionRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:skybox.GenerateRegionRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void GenerateRegionRequest::CopyFrom(const GenerateRegionRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:skybox.GenerateRegionRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GenerateRegionRequest::IsInitialized() const {
+  return true;
+}
+
+void GenerateRegionRequest::InternalSwap(GenerateRegionRequest* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  positions_.InternalSwap(&other->positions_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GenerateRegionRequest, ibl_)
+      + sizeof(GenerateRegionRequest::ibl_)
+      - PROTOBUF_FIELD_OFFSET(GenerateRegionRequest, min_)>(
+          reinterpret_cast<char*>(&min_),
+          reinterpret_cast<char*>(&other->min_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GenerateRegionRequest::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+class GenerateRegionReply::_Internal {
+ public:
+};
+
+GenerateRegionReply::GenerateRegionReply(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:skybox.GenerateRegionReply)
+}
+GenerateRegionReply::GenerateRegionReply(const GenerateRegionReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&job_id_, &from.job_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&child_count_) -
+    reinterpret_cast<char*>(&job_id_)) + sizeof(child_count_));
+  // @@protoc_insertion_point(copy_constructor:skybox.GenerateRegionReply)
+}
+
+void GenerateRegionReply::SharedCtor() {
+::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
+    reinterpret_cast<char*>(&job_id_) - reinterpret_cast<char*>(this)),
+    0, static_cast<size_t>(reinterpret_cast<char*>(&child_count_) -
+    reinterpret_cast<char*>(&job_id_)) + sizeof(child_count_));
+}
+
+GenerateRegionReply::~GenerateRegionReply() {
+  // @@protoc_insertion_point(destructor:skybox.GenerateRegionReply)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void GenerateRegionReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void GenerateRegionReply::ArenaDtor(void* object) {
+  GenerateRegionReply* _this = reinterpret_cast< GenerateRegionReply* >(object);
+  (void)_this;
+}
+void GenerateRegionReply::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void GenerateRegionReply::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void GenerateRegionReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:skybox.GenerateRegionReply)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&job_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&child_count_) -
+      reinterpret_cast<char*>(&job_id_)) + sizeof(child_count_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GenerateRegionReply::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // int32 job_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          job_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // int32 child_count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          child_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* GenerateRegionReply::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:skybox.GenerateRegionReply)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 job_id = 1;
+  if (this->job_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_job_id(), target);
+  }
+
+  // int32 child_count = 2;
+  if (this->child_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_child_count(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:skybox.GenerateRegionReply)
+  return target;
+}
+
+size_t GenerateRegionReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:skybox.GenerateRegionReply)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 job_id = 1;
+  if (this->job_id() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_job_id());
+  }
+
+  // int32 child_count = 2;
+  if (this->child_count() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_child_count());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void GenerateRegionReply::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:skybox.GenerateRegionReply)
+  GOOGLE_DCHECK_NE(&from, this);
+  const GenerateRegionReply* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GenerateRegionReply>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:skybox.GenerateRegionReply)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:skybox.GenerateRegionReply)
+    MergeFrom(*source);
+  }
+}
+
+void GenerateRegionReply::MergeFrom(const GenerateRegionReply& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:skybox.GenerateRegionReply)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.job_id() != 0) {
+    _internal_set_job_id(from._internal_job_id());
+  }
+  if (from.child_count() != 0) {
+    _internal_set_child_count(from._internal_child_count());
+  }
+}
+
+void GenerateRegionReply::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:skybox.GenerateRegionReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void GenerateRegionReply::CopyFrom(const GenerateRegionReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:skybox.GenerateRegionReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GenerateRegionReply::IsInitialized() const {
+  return true;
+}
+
+void GenerateRegionReply::InternalSwap(GenerateRegionReply* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GenerateRegionReply, child_count_)
+      + sizeof(GenerateRegionReply::child_count_)
+      - PROTOBUF_FIELD_OFFSET(GenerateRegionReply, job_id_)>(
+          reinterpret_cast<char*>(&job_id_),
+          reinterpret_cast<char*>(&other->job_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GenerateRegionReply::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+class SetClientWeightRequest::_Internal {
+ public:
+};
+
+SetClientWeightRequest::SetClientWeightRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:skybox.SetClientWeightRequest)
+}
+SetClientWeightRequest::SetClientWeightRequest(const SetClientWeightRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  client_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_client().empty()) {
+    client_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_client(), 
+      GetArena());
+  }
+  weight_ = from.weight_;
+  // @@protoc_insertion_point(copy_constructor:skybox.SetClientWeightRequest)
+}
+
+void SetClientWeightRequest::SharedCtor() {
+client_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+weight_ = 0;
+}
+
+SetClientWeightRequest::~SetClientWeightRequest() {
+  // @@protoc_insertion_point(destructor:skybox.SetClientWeightRequest)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void SetClientWeightRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  client_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+void SetClientWeightRequest::ArenaDtor(void* object) {
+  SetClientWeightRequest* _this = reinterpret_cast< SetClientWeightRequest* >(object);
+  (void)_this;
+}
+void SetClientWeightRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void SetClientWeightRequest::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void SetClientWeightRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:skybox.SetClientWeightRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  client_.ClearToEmpty();
+  weight_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SetClientWeightRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // string client = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          auto str = _internal_mutable_client();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "skybox.SetClientWeightRequest.client"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // float weight = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 21)) {
+          weight_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* SetClientWeightRequest::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:skybox.SetClientWeightRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string client = 1;
+  if (this->client().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_client().data(), static_cast<int>(this->_internal_client().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "skybox.SetClientWeightRequest.client");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_client(), target);
+  }
+
+  // float weight = 2;
+  if (!(this->weight() <= 0 && this->weight() >= 0)) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(2, this->_internal_weight(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:skybox.SetClientWeightRequest)
+  return target;
+}
+
+size_t SetClientWeightRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:skybox.SetClientWeightRequest)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string client = 1;
+  if (this->client().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_client());
+  }
+
+  // float weight = 2;
+  if (!(this->weight() <= 0 && this->weight() >= 0)) {
+    total_size += 1 + 4;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void SetClientWeightRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:skybox.SetClientWeightRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  const SetClientWeightRequest* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<SetClientWeightRequest>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:skybox.SetClientWeightRequest)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:skybox.SetClientWeightRequest)
+    MergeFrom(*source);
+  }
+}
+
+void SetClientWeightRequest::MergeFrom(const SetClientWeightRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:skybox.SetClientWeightRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.client().size() > 0) {
+    _internal_set_client(from._internal_client());
+  }
+  if (!(from.weight() <= 0 && from.weight() >= 0)) {
+    _internal_set_weight(from._internal_weight());
+  }
+}
+
+void SetClientWeightRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:skybox.SetClientWeightRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void SetClientWeightRequest::CopyFrom(const SetClientWeightRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:skybox.SetClientWeightRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SetClientWeightRequest::IsInitialized() const {
+  return true;
+}
+
+void SetClientWeightRequest::InternalSwap(SetClientWeightRequest* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  client_.Swap(&other->client_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  swap(weight_, other->weight_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SetClientWeightRequest::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+class SetClientWeightReply::_Internal {
+ public:
+};
+
+SetClientWeightReply::SetClientWeightReply(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:skybox.SetClientWeightReply)
+}
+SetClientWeightReply::SetClientWeightReply(const SetClientWeightReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  weight_ = from.weight_;
+  // @@protoc_insertion_point(copy_constructor:skybox.SetClientWeightReply)
+}
+
+void SetClientWeightReply::SharedCtor() {
+weight_ = 0;
+}
+
+SetClientWeightReply::~SetClientWeightReply() {
+  // @@protoc_insertion_point(destructor:skybox.SetClientWeightReply)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void SetClientWeightReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void SetClientWeightReply::ArenaDtor(void* object) {
+  SetClientWeightReply* _this = reinterpret_cast< SetClientWeightReply* >(object);
+  (void)_this;
+}
+void SetClientWeightReply::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void SetClientWeightReply::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void SetClientWeightReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:skybox.SetClientWeightReply)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  weight_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SetClientWeightReply::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // float weight = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 13)) {
+          weight_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* SetClientWeightReply::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:skybox.SetClientWeightReply)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // float weight = 1;
+  if (!(this->weight() <= 0 && this->weight() >= 0)) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(1, this->_internal_weight(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:skybox.SetClientWeightReply)
+  return target;
+}
+
+size_t SetClientWeightReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:skybox.SetClientWeightReply)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // float weight = 1;
+  if (!(this->weight() <= 0 && this->weight() >= 0)) {
+    total_size += 1 + 4;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void SetClientWeightReply::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:skybox.SetClientWeightReply)
+  GOOGLE_DCHECK_NE(&from, this);
+  const SetClientWeightReply* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<SetClientWeightReply>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:skybox.SetClientWeightReply)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:skybox.SetClientWeightReply)
+    MergeFrom(*source);
+  }
+}
+
+void SetClientWeightReply::MergeFrom(const SetClientWeightReply& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:skybox.SetClientWeightReply)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!(from.weight() <= 0 && from.weight() >= 0)) {
+    _internal_set_weight(from._internal_weight());
+  }
+}
+
+void SetClientWeightReply::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:skybox.SetClientWeightReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void SetClientWeightReply::CopyFrom(const SetClientWeightReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:skybox.SetClientWeightReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SetClientWeightReply::IsInitialized() const {
+  return true;
+}
+
+void SetClientWeightReply::InternalSwap(SetClientWeightReply* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  swap(weight_, other->weight_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SetClientWeightReply::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+class CancelJobRequest::_Internal {
+ public:
+};
+
+CancelJobRequest::CancelJobRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:skybox.CancelJobRequest)
+}
+CancelJobRequest::CancelJobRequest(const CancelJobRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  job_id_ = from.job_id_;
+  // @@protoc_insertion_point(copy_constructor:skybox.CancelJobRequest)
+}
+
+void CancelJobRequest::SharedCtor() {
+job_id_ = 0;
+}
+
+CancelJobRequest::~CancelJobRequest() {
+  // @@protoc_insertion_point(destructor:skybox.CancelJobRequest)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void CancelJobRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void CancelJobRequest::ArenaDtor(void* object) {
+  CancelJobRequest* _this = reinterpret_cast< CancelJobRequest* >(object);
+  (void)_this;
+}
+void CancelJobRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void CancelJobRequest::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void CancelJobRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:skybox.CancelJobRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  job_id_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CancelJobRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // int32 job_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          job_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* CancelJobRequest::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:skybox.CancelJobRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 job_id = 1;
+  if (this->job_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_job_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:skybox.CancelJobRequest)
+  return target;
+}
+
+size_t CancelJobRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:skybox.CancelJobRequest)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 job_id = 1;
+  if (this->job_id() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_job_id());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void CancelJobRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:skybox.CancelJobRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  const CancelJobRequest* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<CancelJobRequest>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:skybox.CancelJobRequest)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:skybox.CancelJobRequest)
+    MergeFrom(*source);
+  }
+}
+
+void CancelJobRequest::MergeFrom(const CancelJobRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:skybox.CancelJobRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.job_id() != 0) {
+    _internal_set_job_id(from._internal_job_id());
+  }
+}
+
+void CancelJobRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:skybox.CancelJobRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void CancelJobRequest::CopyFrom(const CancelJobRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:skybox.CancelJobRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CancelJobRequest::IsInitialized() const {
+  return true;
+}
+
+void CancelJobRequest::InternalSwap(CancelJobRequest* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  swap(job_id_, other->job_id_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CancelJobRequest::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+class CancelJobReply::_Internal {
+ public:
+};
+
+CancelJobReply::CancelJobReply(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:skybox.CancelJobReply)
+}
+CancelJobReply::CancelJobReply(const CancelJobReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&job_id_, &from.job_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&job_status_) -
+    reinterpret_cast<char*>(&job_id_)) + sizeof(job_status_));
+  // @@protoc_insertion_point(copy_constructor:skybox.CancelJobReply)
+}
+
+void CancelJobReply::SharedCtor() {
+::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
+    reinterpret_cast<char*>(&job_id_) - reinterpret_cast<char*>(this)),
+    0, static_cast<size_t>(reinterpret_cast<char*>(&job_status_) -
+    reinterpret_cast<char*>(&job_id_)) + sizeof(job_status_));
+}
+
+CancelJobReply::~CancelJobReply() {
+  // @@protoc_insertion_point(destructor:skybox.CancelJobReply)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void CancelJobReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void CancelJobReply::ArenaDtor(void* object) {
+  CancelJobReply* _this = reinterpret_cast< CancelJobReply* >(object);
+  (void)_this;
+}
+void CancelJobReply::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void CancelJobReply::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void CancelJobReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:skybox.CancelJobReply)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&job_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&job_status_) -
+      reinterpret_cast<char*>(&job_id_)) + sizeof(job_status_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CancelJobReply::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // int32 job_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          job_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .skybox.JobStatus job_status = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_job_status(static_cast<::skybox::JobStatus>(val));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* CancelJobReply::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:skybox.CancelJobReply)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 job_id = 1;
+  if (this->job_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_job_id(), target);
+  }
+
+  // .skybox.JobStatus job_status = 2;
+  if (this->job_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_job_status(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:skybox.CancelJobReply)
+  return target;
+}
+
+size_t CancelJobReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:skybox.CancelJobReply)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 job_id = 1;
+  if (this->job_id() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_job_id());
+  }
+
+  // .skybox.JobStatus job_status = 2;
+  if (this->job_status() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_job_status());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void CancelJobReply::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:skybox.CancelJobReply)
+  GOOGLE_DCHECK_NE(&from, this);
+  const CancelJobReply* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<CancelJobReply>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:skybox.CancelJobReply)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:skybox.CancelJobReply)
+    MergeFrom(*source);
+  }
+}
+
+void CancelJobReply::MergeFrom(const CancelJobReply& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:skybox.CancelJobReply)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.job_id() != 0) {
+    _internal_set_job_id(from._internal_job_id());
+  }
+  if (from.job_status() != 0) {
+    _internal_set_job_status(from._internal_job_status());
+  }
+}
+
+void CancelJobReply::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:skybox.CancelJobReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void CancelJobReply::CopyFrom(const CancelJobReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:skybox.CancelJobReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CancelJobReply::IsInitialized() const {
+  return true;
+}
+
+void CancelJobReply::InternalSwap(CancelJobReply* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CancelJobReply, job_status_)
+      + sizeof(CancelJobReply::job_status_)
+      - PROTOBUF_FIELD_OFFSET(CancelJobReply, job_id_)>(
+          reinterpret_cast<char*>(&job_id_),
+          reinterpret_cast<char*>(&other->job_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CancelJobReply::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+class ExportTraceRequest::_Internal {
+ public:
+};
+
+ExportTraceRequest::ExportTraceRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:skybox.ExportTraceRequest)
+}
+ExportTraceRequest::ExportTraceRequest(const ExportTraceRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  file_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_file_name().empty()) {
+    file_name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_file_name(), 
+      GetArena());
+  }
+  max_events_ = from.max_events_;
+  // @@protoc_insertion_point(copy_constructor:skybox.ExportTraceRequest)
+}
+
+void ExportTraceRequest::SharedCtor() {
+file_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+max_events_ = 0;
+}
+
+ExportTraceRequest::~ExportTraceRequest() {
+  // @@protoc_insertion_point(destructor:skybox.ExportTraceRequest)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void ExportTraceRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  file_name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+void ExportTraceRequest::ArenaDtor(void* object) {
+  ExportTraceRequest* _this = reinterpret_cast< ExportTraceRequest* >(object);
+  (void)_this;
+}
+void ExportTraceRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void ExportTraceRequest::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void ExportTraceRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:skybox.ExportTraceRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  file_name_.ClearToEmpty();
+  max_events_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ExportTraceRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // string file_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          auto str = _internal_mutable_file_name();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "skybox.ExportTraceRequest.file_name"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // int32 max_events = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          max_events_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* ExportTraceRequest::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:skybox.ExportTraceRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string file_name = 1;
+  if (this->file_name().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_file_name().data(), static_cast<int>(this->_internal_file_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "skybox.ExportTraceRequest.file_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_file_name(), target);
+  }
+
+  // int32 max_events = 2;
+  if (this->max_events() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_max_events(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:skybox.ExportTraceRequest)
+  return target;
+}
+
+size_t ExportTraceRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:skybox.ExportTraceRequest)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string file_name = 1;
+  if (this->file_name().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_file_name());
+  }
+
+  // int32 max_events = 2;
+  if (this->max_events() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_max_events());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void ExportTraceRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:skybox.ExportTraceRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  const ExportTraceRequest* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ExportTraceRequest>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:skybox.ExportTraceRequest)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:skybox.ExportTraceRequest)
+    MergeFrom(*source);
+  }
+}
+
+void ExportTraceRequest::MergeFrom(const ExportTraceRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:skybox.ExportTraceRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.file_name().size() > 0) {
+    _internal_set_file_name(from._internal_file_name());
+  }
+  if (from.max_events() != 0) {
+    _internal_set_max_events(from._internal_max_events());
+  }
+}
+
+void ExportTraceRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:skybox.ExportTraceRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void ExportTraceRequest::CopyFrom(const ExportTraceRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:skybox.ExportTraceRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ExportTraceRequest::IsInitialized() const {
+  return true;
+}
+
+void ExportTraceRequest::InternalSwap(ExportTraceRequest* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  file_name_.Swap(&other->file_name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  swap(max_events_, other->max_events_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ExportTraceRequest::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+class ExportTraceReply::_Internal {
+ public:
+};
+
+ExportTraceReply::ExportTraceReply(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:skybox.ExportTraceReply)
+}
+ExportTraceReply::ExportTraceReply(const ExportTraceReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  trace_json_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_trace_json().empty()) {
+    trace_json_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_trace_json(), 
+      GetArena());
+  }
+  ::memcpy(&event_count_, &from.event_count_,
+    static_cast<size_t>(reinterpret_cast<char*>(&truncated_) -
+    reinterpret_cast<char*>(&event_count_)) + sizeof(truncated_));
+  // @@protoc_insertion_point(copy_constructor:skybox.ExportTraceReply)
+}
+
+void ExportTraceReply::SharedCtor() {
+trace_json_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
+    reinterpret_cast<char*>(&event_count_) - reinterpret_cast<char*>(this)),
+    0, static_cast<size_t>(reinterpret_cast<char*>(&truncated_) -
+    reinterpret_cast<char*>(&event_count_)) + sizeof(truncated_));
+}
+
+ExportTraceReply::~ExportTraceReply() {
+  // @@protoc_insertion_point(destructor:skybox.ExportTraceReply)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void ExportTraceReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  trace_json_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+void ExportTraceReply::ArenaDtor(void* object) {
+  ExportTraceReply* _this = reinterpret_cast< ExportTraceReply* >(object);
+  (void)_this;
+}
+void ExportTraceReply::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void ExportTraceReply::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void ExportTraceReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:skybox.ExportTraceReply)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  trace_json_.ClearToEmpty();
+  ::memset(&event_count_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&truncated_) -
+      reinterpret_cast<char*>(&event_count_)) + sizeof(truncated_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ExportTraceReply::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // string trace_json = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          auto str = _internal_mutable_trace_json();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "skybox.ExportTraceReply.trace_json"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // int32 event_count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          event_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bool truncated = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
+          truncated_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* ExportTraceReply::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:skybox.ExportTraceReply)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string trace_json = 1;
+  if (this->trace_json().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_trace_json().data(), static_cast<int>(this->_internal_trace_json().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "skybox.ExportTraceReply.trace_json");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_trace_json(), target);
+  }
+
+  // int32 event_count = 2;
+  if (this->event_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_event_count(), target);
+  }
+
+  // bool truncated = 3;
+  if (this->truncated() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(3, this->_internal_truncated(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:skybox.ExportTraceReply)
+  return target;
+}
+
+size_t ExportTraceReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:skybox.ExportTraceReply)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string trace_json = 1;
+  if (this->trace_json().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_trace_json());
+  }
+
+  // int32 event_count = 2;
+  if (this->event_count() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_event_count());
+  }
+
+  // bool truncated = 3;
+  if (this->truncated() != 0) {
+    total_size += 1 + 1;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void ExportTraceReply::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:skybox.ExportTraceReply)
+  GOOGLE_DCHECK_NE(&from, this);
+  const ExportTraceReply* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ExportTraceReply>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:skybox.ExportTraceReply)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:skybox.ExportTraceReply)
+    MergeFrom(*source);
+  }
+}
+
+void ExportTraceReply::MergeFrom(const ExportTraceReply& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:skybox.ExportTraceReply)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.trace_json().size() > 0) {
+    _internal_set_trace_json(from._internal_trace_json());
+  }
+  if (from.event_count() != 0) {
+    _internal_set_event_count(from._internal_event_count());
+  }
+  if (from.truncated() != 0) {
+    _internal_set_truncated(from._internal_truncated());
+  }
+}
+
+void ExportTraceReply::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:skybox.ExportTraceReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void ExportTraceReply::CopyFrom(const ExportTraceReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:skybox.ExportTraceReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ExportTraceReply::IsInitialized() const {
+  return true;
+}
+
+void ExportTraceReply::InternalSwap(ExportTraceReply* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  trace_json_.Swap(&other->trace_json_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ExportTraceReply, truncated_)
+      + sizeof(ExportTraceReply::truncated_)
+      - PROTOBUF_FIELD_OFFSET(ExportTraceReply, event_count_)>(
+          reinterpret_cast<char*>(&event_count_),
+          reinterpret_cast<char*>(&other->event_count_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ExportTraceReply::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+class GetStatsRequest::_Internal {
+ public:
+};
+
+GetStatsRequest::GetStatsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:skybox.GetStatsRequest)
+}
+GetStatsRequest::GetStatsRequest(const GetStatsRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  prometheus_text_ = from.prometheus_text_;
+  // @@protoc_insertion_point(copy_constructor:skybox.GetStatsRequest)
+}
+
+void GetStatsRequest::SharedCtor() {
+prometheus_text_ = false;
+}
+
+GetStatsRequest::~GetStatsRequest() {
+  // @@protoc_insertion_point(destructor:skybox.GetStatsRequest)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void GetStatsRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void GetStatsRequest::ArenaDtor(void* object) {
+  GetStatsRequest* _this = reinterpret_cast< GetStatsRequest* >(object);
+  (void)_this;
+}
+void GetStatsRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void GetStatsRequest::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void GetStatsRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:skybox.GetStatsRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  prometheus_text_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetStatsRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // bool prometheus_text = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          prometheus_text_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* GetStatsRequest::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:skybox.GetStatsRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool prometheus_text = 1;
+  if (this->prometheus_text() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(1, this->_internal_prometheus_text(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:skybox.GetStatsRequest)
+  return target;
+}
+
+size_t GetStatsRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:skybox.GetStatsRequest)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bool prometheus_text = 1;
+  if (this->prometheus_text() != 0) {
+    total_size += 1 + 1;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void GetStatsRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:skybox.GetStatsRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  const GetStatsRequest* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GetStatsRequest>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:skybox.GetStatsRequest)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:skybox.GetStatsRequest)
+    MergeFrom(*source);
+  }
+}
+
+void GetStatsRequest::MergeFrom(const GetStatsRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:skybox.GetStatsRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.prometheus_text() != 0) {
+    _internal_set_prometheus_text(from._internal_prometheus_text());
+  }
+}
+
+void GetStatsRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:skybox.GetStatsRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void GetStatsRequest::CopyFrom(const GetStatsRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:skybox.GetStatsRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetStatsRequest::IsInitialized() const {
+  return true;
+}
+
+void GetStatsRequest::InternalSwap(GetStatsRequest* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  swap(prometheus_text_, other->prometheus_text_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetStatsRequest::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+class MetricValue::_Internal {
+ public:
+};
+
+MetricValue::MetricValue(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:skybox.MetricValue)
+}
+MetricValue::MetricValue(const MetricValue& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_name().empty()) {
+    name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_name(), 
+      GetArena());
+  }
+  value_ = from.value_;
+  // @@protoc_insertion_point(copy_constructor:skybox.MetricValue)
+}
+
+void MetricValue::SharedCtor() {
+name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+value_ = 0;
+}
+
+MetricValue::~MetricValue() {
+  // @@protoc_insertion_point(destructor:skybox.MetricValue)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void MetricValue::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+void MetricValue::ArenaDtor(void* object) {
+  MetricValue* _this = reinterpret_cast< MetricValue* >(object);
+  (void)_this;
+}
+void MetricValue::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void MetricValue::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void MetricValue::Clear() {
+// @@protoc_insertion_point(message_clear_start:skybox.MetricValue)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  name_.ClearToEmpty();
+  value_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MetricValue::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "skybox.MetricValue.name"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // double value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 17)) {
+          value_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* MetricValue::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:skybox.MetricValue)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (this->name().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "skybox.MetricValue.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // double value = 2;
+  if (!(this->value() <= 0 && this->value() >= 0)) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(2, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:skybox.MetricValue)
+  return target;
+}
+
+size_t MetricValue::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:skybox.MetricValue)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (this->name().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // double value = 2;
+  if (!(this->value() <= 0 && this->value() >= 0)) {
+    total_size += 1 + 8;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void MetricValue::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:skybox.MetricValue)
+  GOOGLE_DCHECK_NE(&from, this);
+  const MetricValue* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<MetricValue>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:skybox.MetricValue)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:skybox.MetricValue)
+    MergeFrom(*source);
+  }
+}
+
+void MetricValue::MergeFrom(const MetricValue& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:skybox.MetricValue)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.name().size() > 0) {
+    _internal_set_name(from._internal_name());
+  }
+  if (!(from.value() <= 0 && from.value() >= 0)) {
+    _internal_set_value(from._internal_value());
+  }
+}
+
+void MetricValue::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:skybox.MetricValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void MetricValue::CopyFrom(const MetricValue& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:skybox.MetricValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MetricValue::IsInitialized() const {
+  return true;
+}
+
+void MetricValue::InternalSwap(MetricValue* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  name_.Swap(&other->name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  swap(value_, other->value_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MetricValue::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+class HistogramSummary::_Internal {
+ public:
+};
+
+HistogramSummary::HistogramSummary(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:skybox.HistogramSummary)
+}
+HistogramSummary::HistogramSummary(const HistogramSummary& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_name().empty()) {
+    name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_name(), 
+      GetArena());
+  }
+  ::memcpy(&count_, &from.count_,
+    static_cast<size_t>(reinterpret_cast<char*>(&max_) -
+    reinterpret_cast<char*>(&count_)) + sizeof(max_));
+  // @@protoc_insertion_point(copy_constructor:skybox.HistogramSummary)
+}
+
+void HistogramSummary::SharedCtor() {
+name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
+    reinterpret_cast<char*>(&count_) - reinterpret_cast<char*>(this)),
+    0, static_cast<size_t>(reinterpret_cast<char*>(&max_) -
+    reinterpret_cast<char*>(&count_)) + sizeof(max_));
+}
+
+HistogramSummary::~HistogramSummary() {
+  // @@protoc_insertion_point(destructor:skybox.HistogramSummary)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void HistogramSummary::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+void HistogramSummary::ArenaDtor(void* object) {
+  HistogramSummary* _this = reinterpret_cast< HistogramSummary* >(object);
+  (void)_this;
+}
+void HistogramSummary::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void HistogramSummary::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void HistogramSummary::Clear() {
+// @@protoc_insertion_point(message_clear_start:skybox.HistogramSummary)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  name_.ClearToEmpty();
+  ::memset(&count_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&max_) -
+      reinterpret_cast<char*>(&count_)) + sizeof(max_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* HistogramSummary::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "skybox.HistogramSummary.name"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // double count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 17)) {
+          count_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else goto handle_unusual;
+        continue;
+      // double sum = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 25)) {
+          sum_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else goto handle_unusual;
+        continue;
+      // double p50 = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 33)) {
+          p50_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else goto handle_unusual;
+        continue;
+      // double p90 = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 41)) {
+          p90_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else goto handle_unusual;
+        continue;
+      // double p99 = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 49)) {
+          p99_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else goto handle_unusual;
+        continue;
+      // double max = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 57)) {
+          max_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* HistogramSummary::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:skybox.HistogramSummary)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (this->name().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "skybox.HistogramSummary.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // double count = 2;
+  if (!(this->count() <= 0 && this->count() >= 0)) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(2, this->_internal_count(), target);
+  }
+
+  // double sum = 3;
+  if (!(this->sum() <= 0 && this->sum() >= 0)) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(3, this->_internal_sum(), target);
+  }
+
+  // double p50 = 4;
+  if (!(this->p50() <= 0 && this->p50() >= 0)) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(4, this->_internal_p50(), target);
+  }
+
+  // double p90 = 5;
+  if (!(this->p90() <= 0 && this->p90() >= 0)) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(5, this->_internal_p90(), target);
+  }
+
+  // double p99 = 6;
+  if (!(this->p99() <= 0 && this->p99() >= 0)) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(6, this->_internal_p99(), target);
+  }
+
+  // double max = 7;
+  if (!(this->max() <= 0 && this->max() >= 0)) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(7, this->_internal_max(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:skybox.HistogramSummary)
+  return target;
+}
+
+size_t HistogramSummary::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:skybox.HistogramSummary)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (this->name().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // double count = 2;
+  if (!(this->count() <= 0 && this->count() >= 0)) {
+    total_size += 1 + 8;
+  }
+
+  // double sum = 3;
+  if (!(this->sum() <= 0 && this->sum() >= 0)) {
+    total_size += 1 + 8;
+  }
+
+  // double p50 = 4;
+  if (!(this->p50() <= 0 && this->p50() >= 0)) {
+    total_size += 1 + 8;
+  }
+
+  // double p90 = 5;
+  if (!(this->p90() <= 0 && this->p90() >= 0)) {
+    total_size += 1 + 8;
+  }
+
+  // double p99 = 6;
+  if (!(this->p99() <= 0 && this->p99() >= 0)) {
+    total_size += 1 + 8;
+  }
+
+  // double max = 7;
+  if (!(this->max() <= 0 && this->max() >= 0)) {
+    total_size += 1 + 8;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void HistogramSummary::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:skybox.HistogramSummary)
+  GOOGLE_DCHECK_NE(&from, this);
+  const HistogramSummary* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<HistogramSummary>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:skybox.HistogramSummary)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:skybox.HistogramSummary)
+    MergeFrom(*source);
+  }
+}
+
+void HistogramSummary::MergeFrom(const HistogramSummary& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:skybox.HistogramSummary)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.name().size() > 0) {
+    _internal_set_name(from._internal_name());
+  }
+  if (!(from.count() <= 0 && from.count() >= 0)) {
+    _internal_set_count(from._internal_count());
+  }
+  if (!(from.sum() <= 0 && from.sum() >= 0)) {
+    _internal_set_sum(from._internal_sum());
+  }
+  if (!(from.p50() <= 0 && from.p50() >= 0)) {
+    _internal_set_p50(from._internal_p50());
+  }
+  if (!(from.p90() <= 0 && from.p90() >= 0)) {
+    _internal_set_p90(from._internal_p90());
+  }
+  if (!(from.p99() <= 0 && from.p99() >= 0)) {
+    _internal_set_p99(from._internal_p99());
+  }
+  if (!(from.max() <= 0 && from.max() >= 0)) {
+    _internal_set_max(from._internal_max());
+  }
+}
+
+void HistogramSummary::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:skybox.HistogramSummary)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void HistogramSummary::CopyFrom(const HistogramSummary& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:skybox.HistogramSummary)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool HistogramSummary::IsInitialized() const {
+  return true;
+}
+
+void HistogramSummary::InternalSwap(HistogramSummary* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  name_.Swap(&other->name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(HistogramSummary, max_)
+      + sizeof(HistogramSummary::max_)
+      - PROTOBUF_FIELD_OFFSET(HistogramSummary, count_)>(
+          reinterpret_cast<char*>(&count_),
+          reinterpret_cast<char*>(&other->count_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata HistogramSummary::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+class GetStatsReply::_Internal {
+ public:
+};
+
+GetStatsReply::GetStatsReply(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  counters_(arena),
+  gauges_(arena),
+  histograms_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:skybox.GetStatsReply)
+}
+GetStatsReply::GetStatsReply(const GetStatsReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      counters_(from.counters_),
+      gauges_(from.gauges_),
+      histograms_(from.histograms_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  prometheus_text_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_prometheus_text().empty()) {
+    prometheus_text_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_prometheus_text(), 
+      GetArena());
+  }
+  // @@protoc_insertion_point(copy_constructor:skybox.GetStatsReply)
+}
+
+void GetStatsReply::SharedCtor() {
+prometheus_text_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+GetStatsReply::~GetStatsReply() {
+  // @@protoc_insertion_point(destructor:skybox.GetStatsReply)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void GetStatsReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  prometheus_text_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+void GetStatsReply::ArenaDtor(void* object) {
+  GetStatsReply* _this = reinterpret_cast< GetStatsReply* >(object);
+  (void)_this;
+}
+void GetStatsReply::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void GetStatsReply::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void GetStatsReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:skybox.GetStatsReply)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  counters_.Clear();
+  gauges_.Clear();
+  histograms_.Clear();
+  prometheus_text_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetStatsReply::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // repeated .skybox.MetricValue counters = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_counters(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .skybox.MetricValue gauges = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_gauges(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated .skybox.HistogramSummary histograms = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_histograms(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // string prometheus_text = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          auto str = _internal_mutable_prometheus_text();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "skybox.GetStatsReply.prometheus_text"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* GetStatsReply::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:skybox.GetStatsReply)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .skybox.MetricValue counters = 1;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_counters_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, this->_internal_counters(i), target, stream);
+  }
+
+  // repeated .skybox.MetricValue gauges = 2;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_gauges_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, this->_internal_gauges(i), target, stream);
+  }
+
+  // repeated .skybox.HistogramSummary histograms = 3;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_histograms_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, this->_internal_histograms(i), target, stream);
+  }
+
+  // string prometheus_text = 4;
+  if (this->prometheus_text().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_prometheus_text().data(), static_cast<int>(this->_internal_prometheus_text().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "skybox.GetStatsReply.prometheus_text");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_prometheus_text(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:skybox.GetStatsReply)
+  return target;
+}
+
+size_t GetStatsReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:skybox.GetStatsReply)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .skybox.MetricValue counters = 1;
+  total_size += 1UL * this->_internal_counters_size();
+  for (const auto& msg : this->counters_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+
+  // repeated .skybox.MetricValue gauges = 2;
+  total_size += 1UL * this->_internal_gauges_size();
+  for (const auto& msg : this->gauges_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+
+  // repeated .skybox.HistogramSummary histograms = 3;
+  total_size += 1UL * this->_internal_histograms_size();
+  for (const auto& msg : this->histograms_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+
+  // string prometheus_text = 4;
+  if (this->prometheus_text().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_prometheus_text());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void GetStatsReply::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:skybox.GetStatsReply)
+  GOOGLE_DCHECK_NE(&from, this);
+  const GetStatsReply* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GetStatsReply>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:skybox.GetStatsReply)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:skybox.GetStatsReply)
+    MergeFrom(*source);
+  }
+}
+
+void GetStatsReply::MergeFrom(const GetStatsReply& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:skybox.GetStatsReply)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  counters_.MergeFrom(from.counters_);
+  gauges_.MergeFrom(from.gauges_);
+  histograms_.MergeFrom(from.histograms_);
+  if (from.prometheus_text().size() > 0) {
+    _internal_set_prometheus_text(from._internal_prometheus_text());
+  }
+}
+
+void GetStatsReply::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:skybox.GetStatsReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void GetStatsReply::CopyFrom(const GetStatsReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:skybox.GetStatsReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetStatsReply::IsInitialized() const {
+  return true;
+}
+
+void GetStatsReply::InternalSwap(GetStatsReply* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  counters_.InternalSwap(&other->counters_);
+  gauges_.InternalSwap(&other->gauges_);
+  histograms_.InternalSwap(&other->histograms_);
+  prometheus_text_.Swap(&other->prometheus_text_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetStatsReply::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+class QueryJobRequest::_Internal {
+ public:
+};
+
+QueryJobRequest::QueryJobRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:skybox.QueryJobRequest)
+}
+QueryJobRequest::QueryJobRequest(const QueryJobRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  job_id_ = from.job_id_;
+  // @@protoc_insertion_point(copy_constructor:skybox.QueryJobRequest)
+}
 
 void QueryJobRequest::SharedCtor() {
 job_id_ = 0;
@@ -1467,25 +5075,29 @@ class QueryJobReply::_Internal {
 };
 
 QueryJobReply::QueryJobReply(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  sh_coefficients_(arena),
+  child_job_ids_(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
   // @@protoc_insertion_point(arena_constructor:skybox.QueryJobReply)
 }
 QueryJobReply::QueryJobReply(const QueryJobReply& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      sh_coefficients_(from.sh_coefficients_),
+      child_job_ids_(from.child_job_ids_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::memcpy(&job_id_, &from.job_id_,
-    static_cast<size_t>(reinterpret_cast<char*>(&job_status_) -
-    reinterpret_cast<char*>(&job_id_)) + sizeof(job_status_));
+    static_cast<size_t>(reinterpret_cast<char*>(&ibl_status_) -
+    reinterpret_cast<char*>(&job_id_)) + sizeof(ibl_status_));
   // @@protoc_insertion_point(copy_constructor:skybox.QueryJobReply)
 }
 
 void QueryJobReply::SharedCtor() {
 ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
     reinterpret_cast<char*>(&job_id_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&job_status_) -
-    reinterpret_cast<char*>(&job_id_)) + sizeof(job_status_));
+    0, static_cast<size_t>(reinterpret_cast<char*>(&ibl_status_) -
+    reinterpret_cast<char*>(&job_id_)) + sizeof(ibl_status_));
 }
 
 QueryJobReply::~QueryJobReply() {
@@ -1514,9 +5126,11 @@ void QueryJobReply::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  sh_coefficients_.Clear();
+  child_job_ids_.Clear();
   ::memset(&job_id_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&job_status_) -
-      reinterpret_cast<char*>(&job_id_)) + sizeof(job_status_));
+      reinterpret_cast<char*>(&ibl_status_) -
+      reinterpret_cast<char*>(&job_id_)) + sizeof(ibl_status_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -1542,6 +5156,55 @@ const char* QueryJobReply::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_
           _internal_set_job_status(static_cast<::skybox::JobStatus>(val));
         } else goto handle_unusual;
         continue;
+      // repeated float sh_coefficients = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_sh_coefficients(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 29) {
+          _internal_add_sh_coefficients(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else goto handle_unusual;
+        continue;
+      // int32 total_count = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
+          total_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // int32 completed_count = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
+          completed_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // int32 failed_count = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 48)) {
+          failed_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated int32 child_job_ids = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_child_job_ids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 56) {
+          _internal_add_child_job_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .skybox.IblStatus ibl_status = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 64)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_ibl_status(static_cast<::skybox::IblStatus>(val));
+        } else goto handle_unusual;
+        continue;
       default: {
       handle_unusual:
         if ((tag & 7) == 4 || tag == 0) {
@@ -1583,6 +5246,45 @@ failure:
       2, this->_internal_job_status(), target);
   }
 
+  // repeated float sh_coefficients = 3;
+  if (this->_internal_sh_coefficients_size() > 0) {
+    target = stream->WriteFixedPacked(3, _internal_sh_coefficients(), target);
+  }
+
+  // int32 total_count = 4;
+  if (this->total_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(4, this->_internal_total_count(), target);
+  }
+
+  // int32 completed_count = 5;
+  if (this->completed_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(5, this->_internal_completed_count(), target);
+  }
+
+  // int32 failed_count = 6;
+  if (this->failed_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(6, this->_internal_failed_count(), target);
+  }
+
+  // repeated int32 child_job_ids = 7;
+  {
+    int byte_size = _child_job_ids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          7, _internal_child_job_ids(), byte_size, target);
+    }
+  }
+
+  // .skybox.IblStatus ibl_status = 8;
+  if (this->ibl_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      8, this->_internal_ibl_status(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1599,6 +5301,38 @@ size_t QueryJobReply::ByteSizeLong() const {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // repeated float sh_coefficients = 3;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_sh_coefficients_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _sh_coefficients_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+
+  // repeated int32 child_job_ids = 7;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      Int32Size(this->child_job_ids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _child_job_ids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+
   // int32 job_id = 1;
   if (this->job_id() != 0) {
     total_size += 1 +
@@ -1612,6 +5346,33 @@ size_t QueryJobReply::ByteSizeLong() const {
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_job_status());
   }
 
+  // int32 total_count = 4;
+  if (this->total_count() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_total_count());
+  }
+
+  // int32 completed_count = 5;
+  if (this->completed_count() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_completed_count());
+  }
+
+  // int32 failed_count = 6;
+  if (this->failed_count() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_failed_count());
+  }
+
+  // .skybox.IblStatus ibl_status = 8;
+  if (this->ibl_status() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_ibl_status());
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
         _internal_metadata_, total_size, &_cached_size_);
@@ -1643,12 +5404,26 @@ void QueryJobReply::MergeFrom(const QueryJobReply& from) {
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
+  sh_coefficients_.MergeFrom(from.sh_coefficients_);
+  child_job_ids_.MergeFrom(from.child_job_ids_);
   if (from.job_id() != 0) {
     _internal_set_job_id(from._internal_job_id());
   }
   if (from.job_status() != 0) {
     _internal_set_job_status(from._internal_job_status());
   }
+  if (from.total_count() != 0) {
+    _internal_set_total_count(from._internal_total_count());
+  }
+  if (from.completed_count() != 0) {
+    _internal_set_completed_count(from._internal_completed_count());
+  }
+  if (from.failed_count() != 0) {
+    _internal_set_failed_count(from._internal_failed_count());
+  }
+  if (from.ibl_status() != 0) {
+    _internal_set_ibl_status(from._internal_ibl_status());
+  }
 }
 
 void QueryJobReply::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
@@ -1672,9 +5447,11 @@ bool QueryJobReply::IsInitialized() const {
 void QueryJobReply::InternalSwap(QueryJobReply* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  sh_coefficients_.InternalSwap(&other->sh_coefficients_);
+  child_job_ids_.InternalSwap(&other->child_job_ids_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(QueryJobReply, job_status_)
-      + sizeof(QueryJobReply::job_status_)
+      PROTOBUF_FIELD_OFFSET(QueryJobReply, ibl_status_)
+      + sizeof(QueryJobReply::ibl_status_)
       - PROTOBUF_FIELD_OFFSET(QueryJobReply, job_id_)>(
           reinterpret_cast<char*>(&job_id_),
           reinterpret_cast<char*>(&other->job_id_));
@@ -1703,6 +5480,42 @@ template<> PROTOBUF_NOINLINE ::skybox::GenerateSkyBoxRequest* Arena::CreateMaybe
 template<> PROTOBUF_NOINLINE ::skybox::GenerateSkyBoxReply* Arena::CreateMaybeMessage< ::skybox::GenerateSkyBoxReply >(Arena* arena) {
   return Arena::CreateMessageInternal< ::skybox::GenerateSkyBoxReply >(arena);
 }
+template<> PROTOBUF_NOINLINE ::skybox::GenerateRegionRequest* Arena::CreateMaybeMessage< ::skybox::GenerateRegionRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::skybox::GenerateRegionRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::skybox::GenerateRegionReply* Arena::CreateMaybeMessage< ::skybox::GenerateRegionReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::skybox::GenerateRegionReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::skybox::SetClientWeightRequest* Arena::CreateMaybeMessage< ::skybox::SetClientWeightRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::skybox::SetClientWeightRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::skybox::SetClientWeightReply* Arena::CreateMaybeMessage< ::skybox::SetClientWeightReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::skybox::SetClientWeightReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::skybox::CancelJobRequest* Arena::CreateMaybeMessage< ::skybox::CancelJobRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::skybox::CancelJobRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::skybox::CancelJobReply* Arena::CreateMaybeMessage< ::skybox::CancelJobReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::skybox::CancelJobReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::skybox::ExportTraceRequest* Arena::CreateMaybeMessage< ::skybox::ExportTraceRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::skybox::ExportTraceRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::skybox::ExportTraceReply* Arena::CreateMaybeMessage< ::skybox::ExportTraceReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::skybox::ExportTraceReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::skybox::GetStatsRequest* Arena::CreateMaybeMessage< ::skybox::GetStatsRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::skybox::GetStatsRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::skybox::MetricValue* Arena::CreateMaybeMessage< ::skybox::MetricValue >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::skybox::MetricValue >(arena);
+}
+template<> PROTOBUF_NOINLINE ::skybox::HistogramSummary* Arena::CreateMaybeMessage< ::skybox::HistogramSummary >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::skybox::HistogramSummary >(arena);
+}
+template<> PROTOBUF_NOINLINE ::skybox::GetStatsReply* Arena::CreateMaybeMessage< ::skybox::GetStatsReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::skybox::GetStatsReply >(arena);
+}
 template<> PROTOBUF_NOINLINE ::skybox::QueryJobRequest* Arena::CreateMaybeMessage< ::skybox::QueryJobRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::skybox::QueryJobRequest >(arena);
 }
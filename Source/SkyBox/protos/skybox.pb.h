@@ -47,7 +47,7 @@ struct TableStruct_skybox_2eproto {
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[7]
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[19]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
   static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
@@ -56,18 +56,48 @@ struct TableStruct_skybox_2eproto {
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_skybox_2eproto;
 ::PROTOBUF_NAMESPACE_ID::Metadata descriptor_table_skybox_2eproto_metadata_getter(int index);
 namespace skybox {
+class CancelJobReply;
+struct CancelJobReplyDefaultTypeInternal;
+extern CancelJobReplyDefaultTypeInternal _CancelJobReply_default_instance_;
+class CancelJobRequest;
+struct CancelJobRequestDefaultTypeInternal;
+extern CancelJobRequestDefaultTypeInternal _CancelJobRequest_default_instance_;
+class ExportTraceReply;
+struct ExportTraceReplyDefaultTypeInternal;
+extern ExportTraceReplyDefaultTypeInternal _ExportTraceReply_default_instance_;
+class ExportTraceRequest;
+struct ExportTraceRequestDefaultTypeInternal;
+extern ExportTraceRequestDefaultTypeInternal _ExportTraceRequest_default_instance_;
+class GenerateRegionReply;
+struct GenerateRegionReplyDefaultTypeInternal;
+extern GenerateRegionReplyDefaultTypeInternal _GenerateRegionReply_default_instance_;
+class GenerateRegionRequest;
+struct GenerateRegionRequestDefaultTypeInternal;
+extern GenerateRegionRequestDefaultTypeInternal _GenerateRegionRequest_default_instance_;
 class GenerateSkyBoxReply;
 struct GenerateSkyBoxReplyDefaultTypeInternal;
 extern GenerateSkyBoxReplyDefaultTypeInternal _GenerateSkyBoxReply_default_instance_;
 class GenerateSkyBoxRequest;
 struct GenerateSkyBoxRequestDefaultTypeInternal;
 extern GenerateSkyBoxRequestDefaultTypeInternal _GenerateSkyBoxRequest_default_instance_;
+class GetStatsReply;
+struct GetStatsReplyDefaultTypeInternal;
+extern GetStatsReplyDefaultTypeInternal _GetStatsReply_default_instance_;
+class GetStatsRequest;
+struct GetStatsRequestDefaultTypeInternal;
+extern GetStatsRequestDefaultTypeInternal _GetStatsRequest_default_instance_;
 class HelloReply;
 struct HelloReplyDefaultTypeInternal;
 extern HelloReplyDefaultTypeInternal _HelloReply_default_instance_;
 class HelloRequest;
 struct HelloRequestDefaultTypeInternal;
 extern HelloRequestDefaultTypeInternal _HelloRequest_default_instance_;
+class HistogramSummary;
+struct HistogramSummaryDefaultTypeInternal;
+extern HistogramSummaryDefaultTypeInternal _HistogramSummary_default_instance_;
+class MetricValue;
+struct MetricValueDefaultTypeInternal;
+extern MetricValueDefaultTypeInternal _MetricValue_default_instance_;
 class Point;
 struct PointDefaultTypeInternal;
 extern PointDefaultTypeInternal _Point_default_instance_;
@@ -77,15 +107,33 @@ extern QueryJobReplyDefaultTypeInternal _QueryJobReply_default_instance_;
 class QueryJobRequest;
 struct QueryJobRequestDefaultTypeInternal;
 extern QueryJobRequestDefaultTypeInternal _QueryJobRequest_default_instance_;
+class SetClientWeightReply;
+struct SetClientWeightReplyDefaultTypeInternal;
+extern SetClientWeightReplyDefaultTypeInternal _SetClientWeightReply_default_instance_;
+class SetClientWeightRequest;
+struct SetClientWeightRequestDefaultTypeInternal;
+extern SetClientWeightRequestDefaultTypeInternal _SetClientWeightRequest_default_instance_;
 }  // namespace skybox
 PROTOBUF_NAMESPACE_OPEN
+template<> ::skybox::CancelJobReply* Arena::CreateMaybeMessage<::skybox::CancelJobReply>(Arena*);
+template<> ::skybox::CancelJobRequest* Arena::CreateMaybeMessage<::skybox::CancelJobRequest>(Arena*);
+template<> ::skybox::ExportTraceReply* Arena::CreateMaybeMessage<::skybox::ExportTraceReply>(Arena*);
+template<> ::skybox::ExportTraceRequest* Arena::CreateMaybeMessage<::skybox::ExportTraceRequest>(Arena*);
+template<> ::skybox::GenerateRegionReply* Arena::CreateMaybeMessage<::skybox::GenerateRegionReply>(Arena*);
+template<> ::skybox::GenerateRegionRequest* Arena::CreateMaybeMessage<::skybox::GenerateRegionRequest>(Arena*);
 template<> ::skybox::GenerateSkyBoxReply* Arena::CreateMaybeMessage<::skybox::GenerateSkyBoxReply>(Arena*);
 template<> ::skybox::GenerateSkyBoxRequest* Arena::CreateMaybeMessage<::skybox::GenerateSkyBoxRequest>(Arena*);
+template<> ::skybox::GetStatsReply* Arena::CreateMaybeMessage<::skybox::GetStatsReply>(Arena*);
+template<> ::skybox::GetStatsRequest* Arena::CreateMaybeMessage<::skybox::GetStatsRequest>(Arena*);
 template<> ::skybox::HelloReply* Arena::CreateMaybeMessage<::skybox::HelloReply>(Arena*);
 template<> ::skybox::HelloRequest* Arena::CreateMaybeMessage<::skybox::HelloRequest>(Arena*);
+template<> ::skybox::HistogramSummary* Arena::CreateMaybeMessage<::skybox::HistogramSummary>(Arena*);
+template<> ::skybox::MetricValue* Arena::CreateMaybeMessage<::skybox::MetricValue>(Arena*);
 template<> ::skybox::Point* Arena::CreateMaybeMessage<::skybox::Point>(Arena*);
 template<> ::skybox::QueryJobReply* Arena::CreateMaybeMessage<::skybox::QueryJobReply>(Arena*);
 template<> ::skybox::QueryJobRequest* Arena::CreateMaybeMessage<::skybox::QueryJobRequest>(Arena*);
+template<> ::skybox::SetClientWeightReply* Arena::CreateMaybeMessage<::skybox::SetClientWeightReply>(Arena*);
+template<> ::skybox::SetClientWeightRequest* Arena::CreateMaybeMessage<::skybox::SetClientWeightRequest>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace skybox {
 
@@ -94,12 +142,13 @@ enum JobStatus : int {
   Failed = 1,
   Waiting = 2,
   Working = 3,
+  Cancelled = 4,
   JobStatus_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
   JobStatus_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
 };
 bool JobStatus_IsValid(int value);
 constexpr JobStatus JobStatus_MIN = Succeeded;
-constexpr JobStatus JobStatus_MAX = Working;
+constexpr JobStatus JobStatus_MAX = Cancelled;
 constexpr int JobStatus_ARRAYSIZE = JobStatus_MAX + 1;
 
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* JobStatus_descriptor();
@@ -116,6 +165,112 @@ inline bool JobStatus_Parse(
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<JobStatus>(
     JobStatus_descriptor(), name, value);
 }
+enum ImageFormat : int {
+  ServerDefault = 0,
+  PNG = 1,
+  EXR = 2,
+  RGBE = 3,
+  ImageFormat_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
+  ImageFormat_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+};
+bool ImageFormat_IsValid(int value);
+constexpr ImageFormat ImageFormat_MIN = ServerDefault;
+constexpr ImageFormat ImageFormat_MAX = RGBE;
+constexpr int ImageFormat_ARRAYSIZE = ImageFormat_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ImageFormat_descriptor();
+template<typename T>
+inline const std::string& ImageFormat_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ImageFormat>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ImageFormat_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ImageFormat_descriptor(), enum_t_value);
+}
+inline bool ImageFormat_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ImageFormat* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ImageFormat>(
+    ImageFormat_descriptor(), name, value);
+}
+enum QualityPreset : int {
+  Standard = 0,
+  Draft = 1,
+  Final = 2,
+  QualityPreset_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
+  QualityPreset_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+};
+bool QualityPreset_IsValid(int value);
+constexpr QualityPreset QualityPreset_MIN = Standard;
+constexpr QualityPreset QualityPreset_MAX = Final;
+constexpr int QualityPreset_ARRAYSIZE = QualityPreset_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* QualityPreset_descriptor();
+template<typename T>
+inline const std::string& QualityPreset_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, QualityPreset>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function QualityPreset_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    QualityPreset_descriptor(), enum_t_value);
+}
+inline bool QualityPreset_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, QualityPreset* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<QualityPreset>(
+    QualityPreset_descriptor(), name, value);
+}
+enum IblMode : int {
+  IblByQuality = 0,
+  IblOff = 1,
+  IblShOnly = 2,
+  IblFull = 3,
+  IblMode_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
+  IblMode_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+};
+bool IblMode_IsValid(int value);
+constexpr IblMode IblMode_MIN = IblByQuality;
+constexpr IblMode IblMode_MAX = IblFull;
+constexpr int IblMode_ARRAYSIZE = IblMode_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* IblMode_descriptor();
+template<typename T>
+inline const std::string& IblMode_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, IblMode>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function IblMode_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    IblMode_descriptor(), enum_t_value);
+}
+inline bool IblMode_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, IblMode* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<IblMode>(
+    IblMode_descriptor(), name, value);
+}
+enum IblStatus : int {
+  IblNotBaked = 0,
+  IblBaked = 1,
+  IblBakeFailed = 2,
+  IblStatus_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
+  IblStatus_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+};
+bool IblStatus_IsValid(int value);
+constexpr IblStatus IblStatus_MIN = IblNotBaked;
+constexpr IblStatus IblStatus_MAX = IblBakeFailed;
+constexpr int IblStatus_ARRAYSIZE = IblStatus_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* IblStatus_descriptor();
+template<typename T>
+inline const std::string& IblStatus_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, IblStatus>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function IblStatus_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    IblStatus_descriptor(), enum_t_value);
+}
+inline bool IblStatus_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, IblStatus* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<IblStatus>(
+    IblStatus_descriptor(), name, value);
+}
 // ===================================================================
 
 class HelloRequest PROTOBUF_FINAL :
@@ -679,6 +834,12 @@ class GenerateSkyBoxRequest PROTOBUF_FINAL :
 
   enum : int {
     kPositionFieldNumber = 1,
+    kResolutionFieldNumber = 2,
+    kFormatFieldNumber = 3,
+    kQualityFieldNumber = 4,
+    kSceneIdFieldNumber = 5,
+    kSupersedeFieldNumber = 6,
+    kIblFieldNumber = 7,
   };
   // .skybox.Point position = 1;
   bool has_position() const;
@@ -698,6 +859,60 @@ class GenerateSkyBoxRequest PROTOBUF_FINAL :
       ::skybox::Point* position);
   ::skybox::Point* unsafe_arena_release_position();
 
+  // int32 resolution = 2;
+  void clear_resolution();
+  ::PROTOBUF_NAMESPACE_ID::int32 resolution() const;
+  void set_resolution(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_resolution() const;
+  void _internal_set_resolution(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // .skybox.ImageFormat format = 3;
+  void clear_format();
+  ::skybox::ImageFormat format() const;
+  void set_format(::skybox::ImageFormat value);
+  private:
+  ::skybox::ImageFormat _internal_format() const;
+  void _internal_set_format(::skybox::ImageFormat value);
+  public:
+
+  // .skybox.QualityPreset quality = 4;
+  void clear_quality();
+  ::skybox::QualityPreset quality() const;
+  void set_quality(::skybox::QualityPreset value);
+  private:
+  ::skybox::QualityPreset _internal_quality() const;
+  void _internal_set_quality(::skybox::QualityPreset value);
+  public:
+
+  // int32 scene_id = 5;
+  void clear_scene_id();
+  ::PROTOBUF_NAMESPACE_ID::int32 scene_id() const;
+  void set_scene_id(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_scene_id() const;
+  void _internal_set_scene_id(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // bool supersede = 6;
+  void clear_supersede();
+  bool supersede() const;
+  void set_supersede(bool value);
+  private:
+  bool _internal_supersede() const;
+  void _internal_set_supersede(bool value);
+  public:
+
+  // .skybox.IblMode ibl = 7;
+  void clear_ibl();
+  ::skybox::IblMode ibl() const;
+  void set_ibl(::skybox::IblMode value);
+  private:
+  ::skybox::IblMode _internal_ibl() const;
+  void _internal_set_ibl(::skybox::IblMode value);
+  public:
+
   // @@protoc_insertion_point(class_scope:skybox.GenerateSkyBoxRequest)
  private:
   class _Internal;
@@ -706,6 +921,12 @@ class GenerateSkyBoxRequest PROTOBUF_FINAL :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   ::skybox::Point* position_;
+  ::PROTOBUF_NAMESPACE_ID::int32 resolution_;
+  int format_;
+  int quality_;
+  ::PROTOBUF_NAMESPACE_ID::int32 scene_id_;
+  bool supersede_;
+  int ibl_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_skybox_2eproto;
 };
@@ -848,24 +1069,24 @@ class GenerateSkyBoxReply PROTOBUF_FINAL :
 };
 // -------------------------------------------------------------------
 
-class QueryJobRequest PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:skybox.QueryJobRequest) */ {
+class GenerateRegionRequest PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:skybox.GenerateRegionRequest) */ {
  public:
-  inline QueryJobRequest() : QueryJobRequest(nullptr) {}
-  virtual ~QueryJobRequest();
-  explicit constexpr QueryJobRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline GenerateRegionRequest() : GenerateRegionRequest(nullptr) {}
+  virtual ~GenerateRegionRequest();
+  explicit constexpr GenerateRegionRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  QueryJobRequest(const QueryJobRequest& from);
-  QueryJobRequest(QueryJobRequest&& from) noexcept
-    : QueryJobRequest() {
+  GenerateRegionRequest(const GenerateRegionRequest& from);
+  GenerateRegionRequest(GenerateRegionRequest&& from) noexcept
+    : GenerateRegionRequest() {
     *this = ::std::move(from);
   }
 
-  inline QueryJobRequest& operator=(const QueryJobRequest& from) {
+  inline GenerateRegionRequest& operator=(const GenerateRegionRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline QueryJobRequest& operator=(QueryJobRequest&& from) noexcept {
+  inline GenerateRegionRequest& operator=(GenerateRegionRequest&& from) noexcept {
     if (GetArena() == from.GetArena()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -883,20 +1104,20 @@ class QueryJobRequest PROTOBUF_FINAL :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return GetMetadataStatic().reflection;
   }
-  static const QueryJobRequest& default_instance() {
+  static const GenerateRegionRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const QueryJobRequest* internal_default_instance() {
-    return reinterpret_cast<const QueryJobRequest*>(
-               &_QueryJobRequest_default_instance_);
+  static inline const GenerateRegionRequest* internal_default_instance() {
+    return reinterpret_cast<const GenerateRegionRequest*>(
+               &_GenerateRegionRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     5;
 
-  friend void swap(QueryJobRequest& a, QueryJobRequest& b) {
+  friend void swap(GenerateRegionRequest& a, GenerateRegionRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(QueryJobRequest* other) {
+  inline void Swap(GenerateRegionRequest* other) {
     if (other == this) return;
     if (GetArena() == other->GetArena()) {
       InternalSwap(other);
@@ -904,7 +1125,7 @@ class QueryJobRequest PROTOBUF_FINAL :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(QueryJobRequest* other) {
+  void UnsafeArenaSwap(GenerateRegionRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -912,17 +1133,17 @@ class QueryJobRequest PROTOBUF_FINAL :
 
   // implements Message ----------------------------------------------
 
-  inline QueryJobRequest* New() const final {
-    return CreateMaybeMessage<QueryJobRequest>(nullptr);
+  inline GenerateRegionRequest* New() const final {
+    return CreateMaybeMessage<GenerateRegionRequest>(nullptr);
   }
 
-  QueryJobRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<QueryJobRequest>(arena);
+  GenerateRegionRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<GenerateRegionRequest>(arena);
   }
   void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
   void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const QueryJobRequest& from);
-  void MergeFrom(const QueryJobRequest& from);
+  void CopyFrom(const GenerateRegionRequest& from);
+  void MergeFrom(const GenerateRegionRequest& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -936,13 +1157,13 @@ class QueryJobRequest PROTOBUF_FINAL :
   inline void SharedCtor();
   inline void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(QueryJobRequest* other);
+  void InternalSwap(GenerateRegionRequest* other);
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "skybox.QueryJobRequest";
+    return "skybox.GenerateRegionRequest";
   }
   protected:
-  explicit QueryJobRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit GenerateRegionRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   private:
   static void ArenaDtor(void* object);
   inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
@@ -961,48 +1182,163 @@ class QueryJobRequest PROTOBUF_FINAL :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kJobIdFieldNumber = 1,
+    kMinFieldNumber = 1,
+    kMaxFieldNumber = 2,
+    kSpacingFieldNumber = 3,
+    kPositionsFieldNumber = 4,
+    kResolutionFieldNumber = 5,
+    kFormatFieldNumber = 6,
+    kQualityFieldNumber = 7,
+    kSceneIdFieldNumber = 8,
+    kIblFieldNumber = 9,
   };
-  // int32 job_id = 1;
-  void clear_job_id();
-  ::PROTOBUF_NAMESPACE_ID::int32 job_id() const;
-  void set_job_id(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // .skybox.Point min = 1;
+  bool has_min() const;
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_job_id() const;
-  void _internal_set_job_id(::PROTOBUF_NAMESPACE_ID::int32 value);
+  bool _internal_has_min() const;
+  public:
+  void clear_min();
+  const ::skybox::Point& min() const;
+  ::skybox::Point* release_min();
+  ::skybox::Point* mutable_min();
+  void set_allocated_min(::skybox::Point* min);
+  private:
+  const ::skybox::Point& _internal_min() const;
+  ::skybox::Point* _internal_mutable_min();
   public:
+  void unsafe_arena_set_allocated_min(
+      ::skybox::Point* min);
+  ::skybox::Point* unsafe_arena_release_min();
 
-  // @@protoc_insertion_point(class_scope:skybox.QueryJobRequest)
+  // .skybox.Point max = 2;
+  bool has_max() const;
+  private:
+  bool _internal_has_max() const;
+  public:
+  void clear_max();
+  const ::skybox::Point& max() const;
+  ::skybox::Point* release_max();
+  ::skybox::Point* mutable_max();
+  void set_allocated_max(::skybox::Point* max);
+  private:
+  const ::skybox::Point& _internal_max() const;
+  ::skybox::Point* _internal_mutable_max();
+  public:
+  void unsafe_arena_set_allocated_max(
+      ::skybox::Point* max);
+  ::skybox::Point* unsafe_arena_release_max();
+
+  // float spacing = 3;
+  void clear_spacing();
+  float spacing() const;
+  void set_spacing(float value);
+  private:
+  float _internal_spacing() const;
+  void _internal_set_spacing(float value);
+  public:
+
+  // repeated .skybox.Point positions = 4;
+  int positions_size() const;
+  private:
+  int _internal_positions_size() const;
+  public:
+  void clear_positions();
+  ::skybox::Point* mutable_positions(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::skybox::Point >*
+      mutable_positions();
+  private:
+  const ::skybox::Point& _internal_positions(int index) const;
+  ::skybox::Point* _internal_add_positions();
+  public:
+  const ::skybox::Point& positions(int index) const;
+  ::skybox::Point* add_positions();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::skybox::Point >&
+      positions() const;
+
+  // int32 resolution = 5;
+  void clear_resolution();
+  ::PROTOBUF_NAMESPACE_ID::int32 resolution() const;
+  void set_resolution(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_resolution() const;
+  void _internal_set_resolution(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // .skybox.ImageFormat format = 6;
+  void clear_format();
+  ::skybox::ImageFormat format() const;
+  void set_format(::skybox::ImageFormat value);
+  private:
+  ::skybox::ImageFormat _internal_format() const;
+  void _internal_set_format(::skybox::ImageFormat value);
+  public:
+
+  // .skybox.QualityPreset quality = 7;
+  void clear_quality();
+  ::skybox::QualityPreset quality() const;
+  void set_quality(::skybox::QualityPreset value);
+  private:
+  ::skybox::QualityPreset _internal_quality() const;
+  void _internal_set_quality(::skybox::QualityPreset value);
+  public:
+
+  // int32 scene_id = 8;
+  void clear_scene_id();
+  ::PROTOBUF_NAMESPACE_ID::int32 scene_id() const;
+  void set_scene_id(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_scene_id() const;
+  void _internal_set_scene_id(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // .skybox.IblMode ibl = 9;
+  void clear_ibl();
+  ::skybox::IblMode ibl() const;
+  void set_ibl(::skybox::IblMode value);
+  private:
+  ::skybox::IblMode _internal_ibl() const;
+  void _internal_set_ibl(::skybox::IblMode value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:skybox.GenerateRegionRequest)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::int32 job_id_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::skybox::Point > positions_;
+  ::skybox::Point* min_;
+  ::skybox::Point* max_;
+  float spacing_;
+  ::PROTOBUF_NAMESPACE_ID::int32 resolution_;
+  int format_;
+  int quality_;
+  ::PROTOBUF_NAMESPACE_ID::int32 scene_id_;
+  int ibl_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_skybox_2eproto;
 };
 // -------------------------------------------------------------------
 
-class QueryJobReply PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:skybox.QueryJobReply) */ {
+class GenerateRegionReply PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:skybox.GenerateRegionReply) */ {
  public:
-  inline QueryJobReply() : QueryJobReply(nullptr) {}
-  virtual ~QueryJobReply();
-  explicit constexpr QueryJobReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline GenerateRegionReply() : GenerateRegionReply(nullptr) {}
+  virtual ~GenerateRegionReply();
+  explicit constexpr GenerateRegionReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  QueryJobReply(const QueryJobReply& from);
-  QueryJobReply(QueryJobReply&& from) noexcept
-    : QueryJobReply() {
+  GenerateRegionReply(const GenerateRegionReply& from);
+  GenerateRegionReply(GenerateRegionReply&& from) noexcept
+    : GenerateRegionReply() {
     *this = ::std::move(from);
   }
 
-  inline QueryJobReply& operator=(const QueryJobReply& from) {
+  inline GenerateRegionReply& operator=(const GenerateRegionReply& from) {
     CopyFrom(from);
     return *this;
   }
-  inline QueryJobReply& operator=(QueryJobReply&& from) noexcept {
+  inline GenerateRegionReply& operator=(GenerateRegionReply&& from) noexcept {
     if (GetArena() == from.GetArena()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -1020,20 +1356,20 @@ class QueryJobReply PROTOBUF_FINAL :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return GetMetadataStatic().reflection;
   }
-  static const QueryJobReply& default_instance() {
+  static const GenerateRegionReply& default_instance() {
     return *internal_default_instance();
   }
-  static inline const QueryJobReply* internal_default_instance() {
-    return reinterpret_cast<const QueryJobReply*>(
-               &_QueryJobReply_default_instance_);
+  static inline const GenerateRegionReply* internal_default_instance() {
+    return reinterpret_cast<const GenerateRegionReply*>(
+               &_GenerateRegionReply_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     6;
 
-  friend void swap(QueryJobReply& a, QueryJobReply& b) {
+  friend void swap(GenerateRegionReply& a, GenerateRegionReply& b) {
     a.Swap(&b);
   }
-  inline void Swap(QueryJobReply* other) {
+  inline void Swap(GenerateRegionReply* other) {
     if (other == this) return;
     if (GetArena() == other->GetArena()) {
       InternalSwap(other);
@@ -1041,7 +1377,7 @@ class QueryJobReply PROTOBUF_FINAL :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(QueryJobReply* other) {
+  void UnsafeArenaSwap(GenerateRegionReply* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -1049,17 +1385,17 @@ class QueryJobReply PROTOBUF_FINAL :
 
   // implements Message ----------------------------------------------
 
-  inline QueryJobReply* New() const final {
-    return CreateMaybeMessage<QueryJobReply>(nullptr);
+  inline GenerateRegionReply* New() const final {
+    return CreateMaybeMessage<GenerateRegionReply>(nullptr);
   }
 
-  QueryJobReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<QueryJobReply>(arena);
+  GenerateRegionReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<GenerateRegionReply>(arena);
   }
   void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
   void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const QueryJobReply& from);
-  void MergeFrom(const QueryJobReply& from);
+  void CopyFrom(const GenerateRegionReply& from);
+  void MergeFrom(const GenerateRegionReply& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -1073,13 +1409,13 @@ class QueryJobReply PROTOBUF_FINAL :
   inline void SharedCtor();
   inline void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(QueryJobReply* other);
+  void InternalSwap(GenerateRegionReply* other);
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "skybox.QueryJobReply";
+    return "skybox.GenerateRegionReply";
   }
   protected:
-  explicit QueryJobReply(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit GenerateRegionReply(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   private:
   static void ArenaDtor(void* object);
   inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
@@ -1099,7 +1435,7 @@ class QueryJobReply PROTOBUF_FINAL :
 
   enum : int {
     kJobIdFieldNumber = 1,
-    kJobStatusFieldNumber = 2,
+    kChildCountFieldNumber = 2,
   };
   // int32 job_id = 1;
   void clear_job_id();
@@ -1110,16 +1446,16 @@ class QueryJobReply PROTOBUF_FINAL :
   void _internal_set_job_id(::PROTOBUF_NAMESPACE_ID::int32 value);
   public:
 
-  // .skybox.JobStatus job_status = 2;
-  void clear_job_status();
-  ::skybox::JobStatus job_status() const;
-  void set_job_status(::skybox::JobStatus value);
+  // int32 child_count = 2;
+  void clear_child_count();
+  ::PROTOBUF_NAMESPACE_ID::int32 child_count() const;
+  void set_child_count(::PROTOBUF_NAMESPACE_ID::int32 value);
   private:
-  ::skybox::JobStatus _internal_job_status() const;
-  void _internal_set_job_status(::skybox::JobStatus value);
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_child_count() const;
+  void _internal_set_child_count(::PROTOBUF_NAMESPACE_ID::int32 value);
   public:
 
-  // @@protoc_insertion_point(class_scope:skybox.QueryJobReply)
+  // @@protoc_insertion_point(class_scope:skybox.GenerateRegionReply)
  private:
   class _Internal;
 
@@ -1127,320 +1463,3639 @@ class QueryJobReply PROTOBUF_FINAL :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::int32 job_id_;
-  int job_status_;
+  ::PROTOBUF_NAMESPACE_ID::int32 child_count_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_skybox_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class SetClientWeightRequest PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:skybox.SetClientWeightRequest) */ {
+ public:
+  inline SetClientWeightRequest() : SetClientWeightRequest(nullptr) {}
+  virtual ~SetClientWeightRequest();
+  explicit constexpr SetClientWeightRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// ===================================================================
+  SetClientWeightRequest(const SetClientWeightRequest& from);
+  SetClientWeightRequest(SetClientWeightRequest&& from) noexcept
+    : SetClientWeightRequest() {
+    *this = ::std::move(from);
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// HelloRequest
+  inline SetClientWeightRequest& operator=(const SetClientWeightRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SetClientWeightRequest& operator=(SetClientWeightRequest&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// string name = 1;
-inline void HelloRequest::clear_name() {
-  name_.ClearToEmpty();
-}
-inline const std::string& HelloRequest::name() const {
-  // @@protoc_insertion_point(field_get:skybox.HelloRequest.name)
-  return _internal_name();
-}
-inline void HelloRequest::set_name(const std::string& value) {
-  _internal_set_name(value);
-  // @@protoc_insertion_point(field_set:skybox.HelloRequest.name)
-}
-inline std::string* HelloRequest::mutable_name() {
-  // @@protoc_insertion_point(field_mutable:skybox.HelloRequest.name)
-  return _internal_mutable_name();
-}
-inline const std::string& HelloRequest::_internal_name() const {
-  return name_.Get();
-}
-inline void HelloRequest::_internal_set_name(const std::string& value) {
-  
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void HelloRequest::set_name(std::string&& value) {
-  
-  name_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:skybox.HelloRequest.name)
-}
-inline void HelloRequest::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:skybox.HelloRequest.name)
-}
-inline void HelloRequest::set_name(const char* value,
-    size_t size) {
-  
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:skybox.HelloRequest.name)
-}
-inline std::string* HelloRequest::_internal_mutable_name() {
-  
-  return name_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
-}
-inline std::string* HelloRequest::release_name() {
-  // @@protoc_insertion_point(field_release:skybox.HelloRequest.name)
-  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline void HelloRequest::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
-    
-  } else {
-    
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
   }
-  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:skybox.HelloRequest.name)
-}
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const SetClientWeightRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SetClientWeightRequest* internal_default_instance() {
+    return reinterpret_cast<const SetClientWeightRequest*>(
+               &_SetClientWeightRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
 
-// -------------------------------------------------------------------
+  friend void swap(SetClientWeightRequest& a, SetClientWeightRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SetClientWeightRequest* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SetClientWeightRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
 
-// HelloReply
+  // implements Message ----------------------------------------------
 
-// string message = 1;
-inline void HelloReply::clear_message() {
-  message_.ClearToEmpty();
-}
+  inline SetClientWeightRequest* New() const final {
+    return CreateMaybeMessage<SetClientWeightRequest>(nullptr);
+  }
+
+  SetClientWeightRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<SetClientWeightRequest>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const SetClientWeightRequest& from);
+  void MergeFrom(const SetClientWeightRequest& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SetClientWeightRequest* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "skybox.SetClientWeightRequest";
+  }
+  protected:
+  explicit SetClientWeightRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    return ::descriptor_table_skybox_2eproto_metadata_getter(kIndexInFileMessages);
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kClientFieldNumber = 1,
+    kWeightFieldNumber = 2,
+  };
+  // string client = 1;
+  void clear_client();
+  const std::string& client() const;
+  void set_client(const std::string& value);
+  void set_client(std::string&& value);
+  void set_client(const char* value);
+  void set_client(const char* value, size_t size);
+  std::string* mutable_client();
+  std::string* release_client();
+  void set_allocated_client(std::string* client);
+  private:
+  const std::string& _internal_client() const;
+  void _internal_set_client(const std::string& value);
+  std::string* _internal_mutable_client();
+  public:
+
+  // float weight = 2;
+  void clear_weight();
+  float weight() const;
+  void set_weight(float value);
+  private:
+  float _internal_weight() const;
+  void _internal_set_weight(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:skybox.SetClientWeightRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr client_;
+  float weight_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_skybox_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SetClientWeightReply PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:skybox.SetClientWeightReply) */ {
+ public:
+  inline SetClientWeightReply() : SetClientWeightReply(nullptr) {}
+  virtual ~SetClientWeightReply();
+  explicit constexpr SetClientWeightReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SetClientWeightReply(const SetClientWeightReply& from);
+  SetClientWeightReply(SetClientWeightReply&& from) noexcept
+    : SetClientWeightReply() {
+    *this = ::std::move(from);
+  }
+
+  inline SetClientWeightReply& operator=(const SetClientWeightReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SetClientWeightReply& operator=(SetClientWeightReply&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const SetClientWeightReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SetClientWeightReply* internal_default_instance() {
+    return reinterpret_cast<const SetClientWeightReply*>(
+               &_SetClientWeightReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(SetClientWeightReply& a, SetClientWeightReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SetClientWeightReply* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SetClientWeightReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline SetClientWeightReply* New() const final {
+    return CreateMaybeMessage<SetClientWeightReply>(nullptr);
+  }
+
+  SetClientWeightReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<SetClientWeightReply>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const SetClientWeightReply& from);
+  void MergeFrom(const SetClientWeightReply& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SetClientWeightReply* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "skybox.SetClientWeightReply";
+  }
+  protected:
+  explicit SetClientWeightReply(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    return ::descriptor_table_skybox_2eproto_metadata_getter(kIndexInFileMessages);
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kWeightFieldNumber = 1,
+  };
+  // float weight = 1;
+  void clear_weight();
+  float weight() const;
+  void set_weight(float value);
+  private:
+  float _internal_weight() const;
+  void _internal_set_weight(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:skybox.SetClientWeightReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  float weight_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_skybox_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CancelJobRequest PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:skybox.CancelJobRequest) */ {
+ public:
+  inline CancelJobRequest() : CancelJobRequest(nullptr) {}
+  virtual ~CancelJobRequest();
+  explicit constexpr CancelJobRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CancelJobRequest(const CancelJobRequest& from);
+  CancelJobRequest(CancelJobRequest&& from) noexcept
+    : CancelJobRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline CancelJobRequest& operator=(const CancelJobRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CancelJobRequest& operator=(CancelJobRequest&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const CancelJobRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CancelJobRequest* internal_default_instance() {
+    return reinterpret_cast<const CancelJobRequest*>(
+               &_CancelJobRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(CancelJobRequest& a, CancelJobRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CancelJobRequest* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CancelJobRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline CancelJobRequest* New() const final {
+    return CreateMaybeMessage<CancelJobRequest>(nullptr);
+  }
+
+  CancelJobRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<CancelJobRequest>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const CancelJobRequest& from);
+  void MergeFrom(const CancelJobRequest& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CancelJobRequest* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "skybox.CancelJobRequest";
+  }
+  protected:
+  explicit CancelJobRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    return ::descriptor_table_skybox_2eproto_metadata_getter(kIndexInFileMessages);
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kJobIdFieldNumber = 1,
+  };
+  // int32 job_id = 1;
+  void clear_job_id();
+  ::PROTOBUF_NAMESPACE_ID::int32 job_id() const;
+  void set_job_id(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_job_id() const;
+  void _internal_set_job_id(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:skybox.CancelJobRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::int32 job_id_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_skybox_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CancelJobReply PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:skybox.CancelJobReply) */ {
+ public:
+  inline CancelJobReply() : CancelJobReply(nullptr) {}
+  virtual ~CancelJobReply();
+  explicit constexpr CancelJobReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CancelJobReply(const CancelJobReply& from);
+  CancelJobReply(CancelJobReply&& from) noexcept
+    : CancelJobReply() {
+    *this = ::std::move(from);
+  }
+
+  inline CancelJobReply& operator=(const CancelJobReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CancelJobReply& operator=(CancelJobReply&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const CancelJobReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CancelJobReply* internal_default_instance() {
+    return reinterpret_cast<const CancelJobReply*>(
+               &_CancelJobReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(CancelJobReply& a, CancelJobReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CancelJobReply* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CancelJobReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline CancelJobReply* New() const final {
+    return CreateMaybeMessage<CancelJobReply>(nullptr);
+  }
+
+  CancelJobReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<CancelJobReply>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const CancelJobReply& from);
+  void MergeFrom(const CancelJobReply& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CancelJobReply* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "skybox.CancelJobReply";
+  }
+  protected:
+  explicit CancelJobReply(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    return ::descriptor_table_skybox_2eproto_metadata_getter(kIndexInFileMessages);
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kJobIdFieldNumber = 1,
+    kJobStatusFieldNumber = 2,
+  };
+  // int32 job_id = 1;
+  void clear_job_id();
+  ::PROTOBUF_NAMESPACE_ID::int32 job_id() const;
+  void set_job_id(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_job_id() const;
+  void _internal_set_job_id(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // .skybox.JobStatus job_status = 2;
+  void clear_job_status();
+  ::skybox::JobStatus job_status() const;
+  void set_job_status(::skybox::JobStatus value);
+  private:
+  ::skybox::JobStatus _internal_job_status() const;
+  void _internal_set_job_status(::skybox::JobStatus value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:skybox.CancelJobReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::int32 job_id_;
+  int job_status_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_skybox_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ExportTraceRequest PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:skybox.ExportTraceRequest) */ {
+ public:
+  inline ExportTraceRequest() : ExportTraceRequest(nullptr) {}
+  virtual ~ExportTraceRequest();
+  explicit constexpr ExportTraceRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ExportTraceRequest(const ExportTraceRequest& from);
+  ExportTraceRequest(ExportTraceRequest&& from) noexcept
+    : ExportTraceRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ExportTraceRequest& operator=(const ExportTraceRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ExportTraceRequest& operator=(ExportTraceRequest&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const ExportTraceRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ExportTraceRequest* internal_default_instance() {
+    return reinterpret_cast<const ExportTraceRequest*>(
+               &_ExportTraceRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(ExportTraceRequest& a, ExportTraceRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ExportTraceRequest* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ExportTraceRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline ExportTraceRequest* New() const final {
+    return CreateMaybeMessage<ExportTraceRequest>(nullptr);
+  }
+
+  ExportTraceRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<ExportTraceRequest>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const ExportTraceRequest& from);
+  void MergeFrom(const ExportTraceRequest& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ExportTraceRequest* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "skybox.ExportTraceRequest";
+  }
+  protected:
+  explicit ExportTraceRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    return ::descriptor_table_skybox_2eproto_metadata_getter(kIndexInFileMessages);
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFileNameFieldNumber = 1,
+    kMaxEventsFieldNumber = 2,
+  };
+  // string file_name = 1;
+  void clear_file_name();
+  const std::string& file_name() const;
+  void set_file_name(const std::string& value);
+  void set_file_name(std::string&& value);
+  void set_file_name(const char* value);
+  void set_file_name(const char* value, size_t size);
+  std::string* mutable_file_name();
+  std::string* release_file_name();
+  void set_allocated_file_name(std::string* file_name);
+  private:
+  const std::string& _internal_file_name() const;
+  void _internal_set_file_name(const std::string& value);
+  std::string* _internal_mutable_file_name();
+  public:
+
+  // int32 max_events = 2;
+  void clear_max_events();
+  ::PROTOBUF_NAMESPACE_ID::int32 max_events() const;
+  void set_max_events(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_max_events() const;
+  void _internal_set_max_events(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:skybox.ExportTraceRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr file_name_;
+  ::PROTOBUF_NAMESPACE_ID::int32 max_events_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_skybox_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ExportTraceReply PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:skybox.ExportTraceReply) */ {
+ public:
+  inline ExportTraceReply() : ExportTraceReply(nullptr) {}
+  virtual ~ExportTraceReply();
+  explicit constexpr ExportTraceReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ExportTraceReply(const ExportTraceReply& from);
+  ExportTraceReply(ExportTraceReply&& from) noexcept
+    : ExportTraceReply() {
+    *this = ::std::move(from);
+  }
+
+  inline ExportTraceReply& operator=(const ExportTraceReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ExportTraceReply& operator=(ExportTraceReply&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const ExportTraceReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ExportTraceReply* internal_default_instance() {
+    return reinterpret_cast<const ExportTraceReply*>(
+               &_ExportTraceReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(ExportTraceReply& a, ExportTraceReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ExportTraceReply* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ExportTraceReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline ExportTraceReply* New() const final {
+    return CreateMaybeMessage<ExportTraceReply>(nullptr);
+  }
+
+  ExportTraceReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<ExportTraceReply>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const ExportTraceReply& from);
+  void MergeFrom(const ExportTraceReply& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ExportTraceReply* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "skybox.ExportTraceReply";
+  }
+  protected:
+  explicit ExportTraceReply(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    return ::descriptor_table_skybox_2eproto_metadata_getter(kIndexInFileMessages);
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTraceJsonFieldNumber = 1,
+    kEventCountFieldNumber = 2,
+    kTruncatedFieldNumber = 3,
+  };
+  // string trace_json = 1;
+  void clear_trace_json();
+  const std::string& trace_json() const;
+  void set_trace_json(const std::string& value);
+  void set_trace_json(std::string&& value);
+  void set_trace_json(const char* value);
+  void set_trace_json(const char* value, size_t size);
+  std::string* mutable_trace_json();
+  std::string* release_trace_json();
+  void set_allocated_trace_json(std::string* trace_json);
+  private:
+  const std::string& _internal_trace_json() const;
+  void _internal_set_trace_json(const std::string& value);
+  std::string* _internal_mutable_trace_json();
+  public:
+
+  // int32 event_count = 2;
+  void clear_event_count();
+  ::PROTOBUF_NAMESPACE_ID::int32 event_count() const;
+  void set_event_count(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_event_count() const;
+  void _internal_set_event_count(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // bool truncated = 3;
+  void clear_truncated();
+  bool truncated() const;
+  void set_truncated(bool value);
+  private:
+  bool _internal_truncated() const;
+  void _internal_set_truncated(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:skybox.ExportTraceReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr trace_json_;
+  ::PROTOBUF_NAMESPACE_ID::int32 event_count_;
+  bool truncated_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_skybox_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetStatsRequest PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:skybox.GetStatsRequest) */ {
+ public:
+  inline GetStatsRequest() : GetStatsRequest(nullptr) {}
+  virtual ~GetStatsRequest();
+  explicit constexpr GetStatsRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetStatsRequest(const GetStatsRequest& from);
+  GetStatsRequest(GetStatsRequest&& from) noexcept
+    : GetStatsRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline GetStatsRequest& operator=(const GetStatsRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetStatsRequest& operator=(GetStatsRequest&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const GetStatsRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetStatsRequest* internal_default_instance() {
+    return reinterpret_cast<const GetStatsRequest*>(
+               &_GetStatsRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(GetStatsRequest& a, GetStatsRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetStatsRequest* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetStatsRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline GetStatsRequest* New() const final {
+    return CreateMaybeMessage<GetStatsRequest>(nullptr);
+  }
+
+  GetStatsRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<GetStatsRequest>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const GetStatsRequest& from);
+  void MergeFrom(const GetStatsRequest& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetStatsRequest* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "skybox.GetStatsRequest";
+  }
+  protected:
+  explicit GetStatsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    return ::descriptor_table_skybox_2eproto_metadata_getter(kIndexInFileMessages);
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPrometheusTextFieldNumber = 1,
+  };
+  // bool prometheus_text = 1;
+  void clear_prometheus_text();
+  bool prometheus_text() const;
+  void set_prometheus_text(bool value);
+  private:
+  bool _internal_prometheus_text() const;
+  void _internal_set_prometheus_text(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:skybox.GetStatsRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  bool prometheus_text_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_skybox_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MetricValue PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:skybox.MetricValue) */ {
+ public:
+  inline MetricValue() : MetricValue(nullptr) {}
+  virtual ~MetricValue();
+  explicit constexpr MetricValue(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MetricValue(const MetricValue& from);
+  MetricValue(MetricValue&& from) noexcept
+    : MetricValue() {
+    *this = ::std::move(from);
+  }
+
+  inline MetricValue& operator=(const MetricValue& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MetricValue& operator=(MetricValue&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const MetricValue& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MetricValue* internal_default_instance() {
+    return reinterpret_cast<const MetricValue*>(
+               &_MetricValue_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(MetricValue& a, MetricValue& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MetricValue* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MetricValue* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline MetricValue* New() const final {
+    return CreateMaybeMessage<MetricValue>(nullptr);
+  }
+
+  MetricValue* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<MetricValue>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const MetricValue& from);
+  void MergeFrom(const MetricValue& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MetricValue* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "skybox.MetricValue";
+  }
+  protected:
+  explicit MetricValue(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    return ::descriptor_table_skybox_2eproto_metadata_getter(kIndexInFileMessages);
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  void set_name(const std::string& value);
+  void set_name(std::string&& value);
+  void set_name(const char* value);
+  void set_name(const char* value, size_t size);
+  std::string* mutable_name();
+  std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // double value = 2;
+  void clear_value();
+  double value() const;
+  void set_value(double value);
+  private:
+  double _internal_value() const;
+  void _internal_set_value(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:skybox.MetricValue)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+  double value_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_skybox_2eproto;
+};
+// -------------------------------------------------------------------
+
+class HistogramSummary PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:skybox.HistogramSummary) */ {
+ public:
+  inline HistogramSummary() : HistogramSummary(nullptr) {}
+  virtual ~HistogramSummary();
+  explicit constexpr HistogramSummary(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HistogramSummary(const HistogramSummary& from);
+  HistogramSummary(HistogramSummary&& from) noexcept
+    : HistogramSummary() {
+    *this = ::std::move(from);
+  }
+
+  inline HistogramSummary& operator=(const HistogramSummary& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HistogramSummary& operator=(HistogramSummary&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const HistogramSummary& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HistogramSummary* internal_default_instance() {
+    return reinterpret_cast<const HistogramSummary*>(
+               &_HistogramSummary_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(HistogramSummary& a, HistogramSummary& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HistogramSummary* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HistogramSummary* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline HistogramSummary* New() const final {
+    return CreateMaybeMessage<HistogramSummary>(nullptr);
+  }
+
+  HistogramSummary* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<HistogramSummary>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const HistogramSummary& from);
+  void MergeFrom(const HistogramSummary& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(HistogramSummary* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "skybox.HistogramSummary";
+  }
+  protected:
+  explicit HistogramSummary(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    return ::descriptor_table_skybox_2eproto_metadata_getter(kIndexInFileMessages);
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kCountFieldNumber = 2,
+    kSumFieldNumber = 3,
+    kP50FieldNumber = 4,
+    kP90FieldNumber = 5,
+    kP99FieldNumber = 6,
+    kMaxFieldNumber = 7,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  void set_name(const std::string& value);
+  void set_name(std::string&& value);
+  void set_name(const char* value);
+  void set_name(const char* value, size_t size);
+  std::string* mutable_name();
+  std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // double count = 2;
+  void clear_count();
+  double count() const;
+  void set_count(double value);
+  private:
+  double _internal_count() const;
+  void _internal_set_count(double value);
+  public:
+
+  // double sum = 3;
+  void clear_sum();
+  double sum() const;
+  void set_sum(double value);
+  private:
+  double _internal_sum() const;
+  void _internal_set_sum(double value);
+  public:
+
+  // double p50 = 4;
+  void clear_p50();
+  double p50() const;
+  void set_p50(double value);
+  private:
+  double _internal_p50() const;
+  void _internal_set_p50(double value);
+  public:
+
+  // double p90 = 5;
+  void clear_p90();
+  double p90() const;
+  void set_p90(double value);
+  private:
+  double _internal_p90() const;
+  void _internal_set_p90(double value);
+  public:
+
+  // double p99 = 6;
+  void clear_p99();
+  double p99() const;
+  void set_p99(double value);
+  private:
+  double _internal_p99() const;
+  void _internal_set_p99(double value);
+  public:
+
+  // double max = 7;
+  void clear_max();
+  double max() const;
+  void set_max(double value);
+  private:
+  double _internal_max() const;
+  void _internal_set_max(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:skybox.HistogramSummary)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+  double count_;
+  double sum_;
+  double p50_;
+  double p90_;
+  double p99_;
+  double max_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_skybox_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetStatsReply PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:skybox.GetStatsReply) */ {
+ public:
+  inline GetStatsReply() : GetStatsReply(nullptr) {}
+  virtual ~GetStatsReply();
+  explicit constexpr GetStatsReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetStatsReply(const GetStatsReply& from);
+  GetStatsReply(GetStatsReply&& from) noexcept
+    : GetStatsReply() {
+    *this = ::std::move(from);
+  }
+
+  inline GetStatsReply& operator=(const GetStatsReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetStatsReply& operator=(GetStatsReply&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const GetStatsReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetStatsReply* internal_default_instance() {
+    return reinterpret_cast<const GetStatsReply*>(
+               &_GetStatsReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(GetStatsReply& a, GetStatsReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetStatsReply* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetStatsReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline GetStatsReply* New() const final {
+    return CreateMaybeMessage<GetStatsReply>(nullptr);
+  }
+
+  GetStatsReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<GetStatsReply>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const GetStatsReply& from);
+  void MergeFrom(const GetStatsReply& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetStatsReply* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "skybox.GetStatsReply";
+  }
+  protected:
+  explicit GetStatsReply(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    return ::descriptor_table_skybox_2eproto_metadata_getter(kIndexInFileMessages);
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCountersFieldNumber = 1,
+    kGaugesFieldNumber = 2,
+    kHistogramsFieldNumber = 3,
+    kPrometheusTextFieldNumber = 4,
+  };
+  // repeated .skybox.MetricValue counters = 1;
+  int counters_size() const;
+  private:
+  int _internal_counters_size() const;
+  public:
+  void clear_counters();
+  ::skybox::MetricValue* mutable_counters(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::skybox::MetricValue >*
+      mutable_counters();
+  private:
+  const ::skybox::MetricValue& _internal_counters(int index) const;
+  ::skybox::MetricValue* _internal_add_counters();
+  public:
+  const ::skybox::MetricValue& counters(int index) const;
+  ::skybox::MetricValue* add_counters();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::skybox::MetricValue >&
+      counters() const;
+
+  // repeated .skybox.MetricValue gauges = 2;
+  int gauges_size() const;
+  private:
+  int _internal_gauges_size() const;
+  public:
+  void clear_gauges();
+  ::skybox::MetricValue* mutable_gauges(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::skybox::MetricValue >*
+      mutable_gauges();
+  private:
+  const ::skybox::MetricValue& _internal_gauges(int index) const;
+  ::skybox::MetricValue* _internal_add_gauges();
+  public:
+  const ::skybox::MetricValue& gauges(int index) const;
+  ::skybox::MetricValue* add_gauges();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::skybox::MetricValue >&
+      gauges() const;
+
+  // repeated .skybox.HistogramSummary histograms = 3;
+  int histograms_size() const;
+  private:
+  int _internal_histograms_size() const;
+  public:
+  void clear_histograms();
+  ::skybox::HistogramSummary* mutable_histograms(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::skybox::HistogramSummary >*
+      mutable_histograms();
+  private:
+  const ::skybox::HistogramSummary& _internal_histograms(int index) const;
+  ::skybox::HistogramSummary* _internal_add_histograms();
+  public:
+  const ::skybox::HistogramSummary& histograms(int index) const;
+  ::skybox::HistogramSummary* add_histograms();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::skybox::HistogramSummary >&
+      histograms() const;
+
+  // string prometheus_text = 4;
+  void clear_prometheus_text();
+  const std::string& prometheus_text() const;
+  void set_prometheus_text(const std::string& value);
+  void set_prometheus_text(std::string&& value);
+  void set_prometheus_text(const char* value);
+  void set_prometheus_text(const char* value, size_t size);
+  std::string* mutable_prometheus_text();
+  std::string* release_prometheus_text();
+  void set_allocated_prometheus_text(std::string* prometheus_text);
+  private:
+  const std::string& _internal_prometheus_text() const;
+  void _internal_set_prometheus_text(const std::string& value);
+  std::string* _internal_mutable_prometheus_text();
+  public:
+
+  // @@protoc_insertion_point(class_scope:skybox.GetStatsReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::skybox::MetricValue > counters_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::skybox::MetricValue > gauges_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::skybox::HistogramSummary > histograms_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr prometheus_text_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_skybox_2eproto;
+};
+// -------------------------------------------------------------------
+
+class QueryJobRequest PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:skybox.QueryJobRequest) */ {
+ public:
+  inline QueryJobRequest() : QueryJobRequest(nullptr) {}
+  virtual ~QueryJobRequest();
+  explicit constexpr QueryJobRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  QueryJobRequest(const QueryJobRequest& from);
+  QueryJobRequest(QueryJobRequest&& from) noexcept
+    : QueryJobRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline QueryJobRequest& operator=(const QueryJobRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline QueryJobRequest& operator=(QueryJobRequest&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const QueryJobRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const QueryJobRequest* internal_default_instance() {
+    return reinterpret_cast<const QueryJobRequest*>(
+               &_QueryJobRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(QueryJobRequest& a, QueryJobRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(QueryJobRequest* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(QueryJobRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline QueryJobRequest* New() const final {
+    return CreateMaybeMessage<QueryJobRequest>(nullptr);
+  }
+
+  QueryJobRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<QueryJobRequest>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const QueryJobRequest& from);
+  void MergeFrom(const QueryJobRequest& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(QueryJobRequest* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "skybox.QueryJobRequest";
+  }
+  protected:
+  explicit QueryJobRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    return ::descriptor_table_skybox_2eproto_metadata_getter(kIndexInFileMessages);
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kJobIdFieldNumber = 1,
+  };
+  // int32 job_id = 1;
+  void clear_job_id();
+  ::PROTOBUF_NAMESPACE_ID::int32 job_id() const;
+  void set_job_id(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_job_id() const;
+  void _internal_set_job_id(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:skybox.QueryJobRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::int32 job_id_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_skybox_2eproto;
+};
+// -------------------------------------------------------------------
+
+class QueryJobReply PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:skybox.QueryJobReply) */ {
+ public:
+  inline QueryJobReply() : QueryJobReply(nullptr) {}
+  virtual ~QueryJobReply();
+  explicit constexpr QueryJobReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  QueryJobReply(const QueryJobReply& from);
+  QueryJobReply(QueryJobReply&& from) noexcept
+    : QueryJobReply() {
+    *this = ::std::move(from);
+  }
+
+  inline QueryJobReply& operator=(const QueryJobReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline QueryJobReply& operator=(QueryJobReply&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const QueryJobReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const QueryJobReply* internal_default_instance() {
+    return reinterpret_cast<const QueryJobReply*>(
+               &_QueryJobReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(QueryJobReply& a, QueryJobReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(QueryJobReply* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(QueryJobReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline QueryJobReply* New() const final {
+    return CreateMaybeMessage<QueryJobReply>(nullptr);
+  }
+
+  QueryJobReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<QueryJobReply>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const QueryJobReply& from);
+  void MergeFrom(const QueryJobReply& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(QueryJobReply* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "skybox.QueryJobReply";
+  }
+  protected:
+  explicit QueryJobReply(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    return ::descriptor_table_skybox_2eproto_metadata_getter(kIndexInFileMessages);
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kJobIdFieldNumber = 1,
+    kJobStatusFieldNumber = 2,
+    kShCoefficientsFieldNumber = 3,
+    kTotalCountFieldNumber = 4,
+    kCompletedCountFieldNumber = 5,
+    kFailedCountFieldNumber = 6,
+    kChildJobIdsFieldNumber = 7,
+    kIblStatusFieldNumber = 8,
+  };
+  // int32 job_id = 1;
+  void clear_job_id();
+  ::PROTOBUF_NAMESPACE_ID::int32 job_id() const;
+  void set_job_id(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_job_id() const;
+  void _internal_set_job_id(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // .skybox.JobStatus job_status = 2;
+  void clear_job_status();
+  ::skybox::JobStatus job_status() const;
+  void set_job_status(::skybox::JobStatus value);
+  private:
+  ::skybox::JobStatus _internal_job_status() const;
+  void _internal_set_job_status(::skybox::JobStatus value);
+  public:
+
+  // repeated float sh_coefficients = 3;
+  int sh_coefficients_size() const;
+  private:
+  int _internal_sh_coefficients_size() const;
+  public:
+  void clear_sh_coefficients();
+  private:
+  float _internal_sh_coefficients(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_sh_coefficients() const;
+  void _internal_add_sh_coefficients(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_sh_coefficients();
+  public:
+  float sh_coefficients(int index) const;
+  void set_sh_coefficients(int index, float value);
+  void add_sh_coefficients(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      sh_coefficients() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_sh_coefficients();
+
+  // int32 total_count = 4;
+  void clear_total_count();
+  ::PROTOBUF_NAMESPACE_ID::int32 total_count() const;
+  void set_total_count(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_total_count() const;
+  void _internal_set_total_count(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // int32 completed_count = 5;
+  void clear_completed_count();
+  ::PROTOBUF_NAMESPACE_ID::int32 completed_count() const;
+  void set_completed_count(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_completed_count() const;
+  void _internal_set_completed_count(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // int32 failed_count = 6;
+  void clear_failed_count();
+  ::PROTOBUF_NAMESPACE_ID::int32 failed_count() const;
+  void set_failed_count(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_failed_count() const;
+  void _internal_set_failed_count(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // repeated int32 child_job_ids = 7;
+  int child_job_ids_size() const;
+  private:
+  int _internal_child_job_ids_size() const;
+  public:
+  void clear_child_job_ids();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_child_job_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_child_job_ids() const;
+  void _internal_add_child_job_ids(::PROTOBUF_NAMESPACE_ID::int32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_child_job_ids();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int32 child_job_ids(int index) const;
+  void set_child_job_ids(int index, ::PROTOBUF_NAMESPACE_ID::int32 value);
+  void add_child_job_ids(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      child_job_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_child_job_ids();
+
+  // .skybox.IblStatus ibl_status = 8;
+  void clear_ibl_status();
+  ::skybox::IblStatus ibl_status() const;
+  void set_ibl_status(::skybox::IblStatus value);
+  private:
+  ::skybox::IblStatus _internal_ibl_status() const;
+  void _internal_set_ibl_status(::skybox::IblStatus value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:skybox.QueryJobReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > sh_coefficients_;
+  mutable std::atomic<int> _sh_coefficients_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 > child_job_ids_;
+  mutable std::atomic<int> _child_job_ids_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::int32 job_id_;
+  int job_status_;
+  ::PROTOBUF_NAMESPACE_ID::int32 total_count_;
+  ::PROTOBUF_NAMESPACE_ID::int32 completed_count_;
+  ::PROTOBUF_NAMESPACE_ID::int32 failed_count_;
+  int ibl_status_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_skybox_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// HelloRequest
+
+// string name = 1;
+inline void HelloRequest::clear_name() {
+  name_.ClearToEmpty();
+}
+inline const std::string& HelloRequest::name() const {
+  // @@protoc_insertion_point(field_get:skybox.HelloRequest.name)
+  return _internal_name();
+}
+inline void HelloRequest::set_name(const std::string& value) {
+  _internal_set_name(value);
+  // @@protoc_insertion_point(field_set:skybox.HelloRequest.name)
+}
+inline std::string* HelloRequest::mutable_name() {
+  // @@protoc_insertion_point(field_mutable:skybox.HelloRequest.name)
+  return _internal_mutable_name();
+}
+inline const std::string& HelloRequest::_internal_name() const {
+  return name_.Get();
+}
+inline void HelloRequest::_internal_set_name(const std::string& value) {
+  
+  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void HelloRequest::set_name(std::string&& value) {
+  
+  name_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:skybox.HelloRequest.name)
+}
+inline void HelloRequest::set_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:skybox.HelloRequest.name)
+}
+inline void HelloRequest::set_name(const char* value,
+    size_t size) {
+  
+  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:skybox.HelloRequest.name)
+}
+inline std::string* HelloRequest::_internal_mutable_name() {
+  
+  return name_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* HelloRequest::release_name() {
+  // @@protoc_insertion_point(field_release:skybox.HelloRequest.name)
+  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void HelloRequest::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:skybox.HelloRequest.name)
+}
+
+// -------------------------------------------------------------------
+
+// HelloReply
+
+// string message = 1;
+inline void HelloReply::clear_message() {
+  message_.ClearToEmpty();
+}
 inline const std::string& HelloReply::message() const {
   // @@protoc_insertion_point(field_get:skybox.HelloReply.message)
   return _internal_message();
 }
-inline void HelloReply::set_message(const std::string& value) {
-  _internal_set_message(value);
-  // @@protoc_insertion_point(field_set:skybox.HelloReply.message)
+inline void HelloReply::set_message(const std::string& value) {
+  _internal_set_message(value);
+  // @@protoc_insertion_point(field_set:skybox.HelloReply.message)
+}
+inline std::string* HelloReply::mutable_message() {
+  // @@protoc_insertion_point(field_mutable:skybox.HelloReply.message)
+  return _internal_mutable_message();
+}
+inline const std::string& HelloReply::_internal_message() const {
+  return message_.Get();
+}
+inline void HelloReply::_internal_set_message(const std::string& value) {
+  
+  message_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void HelloReply::set_message(std::string&& value) {
+  
+  message_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:skybox.HelloReply.message)
+}
+inline void HelloReply::set_message(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  message_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:skybox.HelloReply.message)
+}
+inline void HelloReply::set_message(const char* value,
+    size_t size) {
+  
+  message_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:skybox.HelloReply.message)
+}
+inline std::string* HelloReply::_internal_mutable_message() {
+  
+  return message_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* HelloReply::release_message() {
+  // @@protoc_insertion_point(field_release:skybox.HelloReply.message)
+  return message_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void HelloReply::set_allocated_message(std::string* message) {
+  if (message != nullptr) {
+    
+  } else {
+    
+  }
+  message_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), message,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:skybox.HelloReply.message)
+}
+
+// -------------------------------------------------------------------
+
+// Point
+
+// float x = 1;
+inline void Point::clear_x() {
+  x_ = 0;
+}
+inline float Point::_internal_x() const {
+  return x_;
+}
+inline float Point::x() const {
+  // @@protoc_insertion_point(field_get:skybox.Point.x)
+  return _internal_x();
+}
+inline void Point::_internal_set_x(float value) {
+  
+  x_ = value;
+}
+inline void Point::set_x(float value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:skybox.Point.x)
+}
+
+// float y = 2;
+inline void Point::clear_y() {
+  y_ = 0;
+}
+inline float Point::_internal_y() const {
+  return y_;
+}
+inline float Point::y() const {
+  // @@protoc_insertion_point(field_get:skybox.Point.y)
+  return _internal_y();
+}
+inline void Point::_internal_set_y(float value) {
+  
+  y_ = value;
+}
+inline void Point::set_y(float value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:skybox.Point.y)
+}
+
+// float z = 3;
+inline void Point::clear_z() {
+  z_ = 0;
+}
+inline float Point::_internal_z() const {
+  return z_;
+}
+inline float Point::z() const {
+  // @@protoc_insertion_point(field_get:skybox.Point.z)
+  return _internal_z();
+}
+inline void Point::_internal_set_z(float value) {
+  
+  z_ = value;
+}
+inline void Point::set_z(float value) {
+  _internal_set_z(value);
+  // @@protoc_insertion_point(field_set:skybox.Point.z)
+}
+
+// -------------------------------------------------------------------
+
+// GenerateSkyBoxRequest
+
+// .skybox.Point position = 1;
+inline bool GenerateSkyBoxRequest::_internal_has_position() const {
+  return this != internal_default_instance() && position_ != nullptr;
+}
+inline bool GenerateSkyBoxRequest::has_position() const {
+  return _internal_has_position();
+}
+inline void GenerateSkyBoxRequest::clear_position() {
+  if (GetArena() == nullptr && position_ != nullptr) {
+    delete position_;
+  }
+  position_ = nullptr;
+}
+inline const ::skybox::Point& GenerateSkyBoxRequest::_internal_position() const {
+  const ::skybox::Point* p = position_;
+  return p != nullptr ? *p : reinterpret_cast<const ::skybox::Point&>(
+      ::skybox::_Point_default_instance_);
+}
+inline const ::skybox::Point& GenerateSkyBoxRequest::position() const {
+  // @@protoc_insertion_point(field_get:skybox.GenerateSkyBoxRequest.position)
+  return _internal_position();
+}
+inline void GenerateSkyBoxRequest::unsafe_arena_set_allocated_position(
+    ::skybox::Point* position) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(position_);
+  }
+  position_ = position;
+  if (position) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:skybox.GenerateSkyBoxRequest.position)
+}
+inline ::skybox::Point* GenerateSkyBoxRequest::release_position() {
+  
+  ::skybox::Point* temp = position_;
+  position_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::skybox::Point* GenerateSkyBoxRequest::unsafe_arena_release_position() {
+  // @@protoc_insertion_point(field_release:skybox.GenerateSkyBoxRequest.position)
+  
+  ::skybox::Point* temp = position_;
+  position_ = nullptr;
+  return temp;
+}
+inline ::skybox::Point* GenerateSkyBoxRequest::_internal_mutable_position() {
+  
+  if (position_ == nullptr) {
+    auto* p = CreateMaybeMessage<::skybox::Point>(GetArena());
+    position_ = p;
+  }
+  return position_;
+}
+inline ::skybox::Point* GenerateSkyBoxRequest::mutable_position() {
+  // @@protoc_insertion_point(field_mutable:skybox.GenerateSkyBoxRequest.position)
+  return _internal_mutable_position();
+}
+inline void GenerateSkyBoxRequest::set_allocated_position(::skybox::Point* position) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete position_;
+  }
+  if (position) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(position);
+    if (message_arena != submessage_arena) {
+      position = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, position, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  position_ = position;
+  // @@protoc_insertion_point(field_set_allocated:skybox.GenerateSkyBoxRequest.position)
+}
+
+// int32 resolution = 2;
+inline void GenerateSkyBoxRequest::clear_resolution() {
+  resolution_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 GenerateSkyBoxRequest::_internal_resolution() const {
+  return resolution_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 GenerateSkyBoxRequest::resolution() const {
+  // @@protoc_insertion_point(field_get:skybox.GenerateSkyBoxRequest.resolution)
+  return _internal_resolution();
+}
+inline void GenerateSkyBoxRequest::_internal_set_resolution(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  resolution_ = value;
+}
+inline void GenerateSkyBoxRequest::set_resolution(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_resolution(value);
+  // @@protoc_insertion_point(field_set:skybox.GenerateSkyBoxRequest.resolution)
+}
+
+// .skybox.ImageFormat format = 3;
+inline void GenerateSkyBoxRequest::clear_format() {
+  format_ = 0;
+}
+inline ::skybox::ImageFormat GenerateSkyBoxRequest::_internal_format() const {
+  return static_cast< ::skybox::ImageFormat >(format_);
+}
+inline ::skybox::ImageFormat GenerateSkyBoxRequest::format() const {
+  // @@protoc_insertion_point(field_get:skybox.GenerateSkyBoxRequest.format)
+  return _internal_format();
+}
+inline void GenerateSkyBoxRequest::_internal_set_format(::skybox::ImageFormat value) {
+  
+  format_ = value;
+}
+inline void GenerateSkyBoxRequest::set_format(::skybox::ImageFormat value) {
+  _internal_set_format(value);
+  // @@protoc_insertion_point(field_set:skybox.GenerateSkyBoxRequest.format)
+}
+
+// .skybox.QualityPreset quality = 4;
+inline void GenerateSkyBoxRequest::clear_quality() {
+  quality_ = 0;
+}
+inline ::skybox::QualityPreset GenerateSkyBoxRequest::_internal_quality() const {
+  return static_cast< ::skybox::QualityPreset >(quality_);
+}
+inline ::skybox::QualityPreset GenerateSkyBoxRequest::quality() const {
+  // @@protoc_insertion_point(field_get:skybox.GenerateSkyBoxRequest.quality)
+  return _internal_quality();
+}
+inline void GenerateSkyBoxRequest::_internal_set_quality(::skybox::QualityPreset value) {
+  
+  quality_ = value;
+}
+inline void GenerateSkyBoxRequest::set_quality(::skybox::QualityPreset value) {
+  _internal_set_quality(value);
+  // @@protoc_insertion_point(field_set:skybox.GenerateSkyBoxRequest.quality)
+}
+
+// int32 scene_id = 5;
+inline void GenerateSkyBoxRequest::clear_scene_id() {
+  scene_id_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 GenerateSkyBoxRequest::_internal_scene_id() const {
+  return scene_id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 GenerateSkyBoxRequest::scene_id() const {
+  // @@protoc_insertion_point(field_get:skybox.GenerateSkyBoxRequest.scene_id)
+  return _internal_scene_id();
+}
+inline void GenerateSkyBoxRequest::_internal_set_scene_id(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  scene_id_ = value;
+}
+inline void GenerateSkyBoxRequest::set_scene_id(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_scene_id(value);
+  // @@protoc_insertion_point(field_set:skybox.GenerateSkyBoxRequest.scene_id)
+}
+
+// bool supersede = 6;
+inline void GenerateSkyBoxRequest::clear_supersede() {
+  supersede_ = false;
+}
+inline bool GenerateSkyBoxRequest::_internal_supersede() const {
+  return supersede_;
+}
+inline bool GenerateSkyBoxRequest::supersede() const {
+  // @@protoc_insertion_point(field_get:skybox.GenerateSkyBoxRequest.supersede)
+  return _internal_supersede();
+}
+inline void GenerateSkyBoxRequest::_internal_set_supersede(bool value) {
+  
+  supersede_ = value;
+}
+inline void GenerateSkyBoxRequest::set_supersede(bool value) {
+  _internal_set_supersede(value);
+  // @@protoc_insertion_point(field_set:skybox.GenerateSkyBoxRequest.supersede)
+}
+
+// .skybox.IblMode ibl = 7;
+inline void GenerateSkyBoxRequest::clear_ibl() {
+  ibl_ = 0;
+}
+inline ::skybox::IblMode GenerateSkyBoxRequest::_internal_ibl() const {
+  return static_cast< ::skybox::IblMode >(ibl_);
+}
+inline ::skybox::IblMode GenerateSkyBoxRequest::ibl() const {
+  // @@protoc_insertion_point(field_get:skybox.GenerateSkyBoxRequest.ibl)
+  return _internal_ibl();
+}
+inline void GenerateSkyBoxRequest::_internal_set_ibl(::skybox::IblMode value) {
+  
+  ibl_ = value;
+}
+inline void GenerateSkyBoxRequest::set_ibl(::skybox::IblMode value) {
+  _internal_set_ibl(value);
+  // @@protoc_insertion_point(field_set:skybox.GenerateSkyBoxRequest.ibl)
+}
+
+// -------------------------------------------------------------------
+
+// GenerateSkyBoxReply
+
+// int32 job_id = 1;
+inline void GenerateSkyBoxReply::clear_job_id() {
+  job_id_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 GenerateSkyBoxReply::_internal_job_id() const {
+  return job_id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 GenerateSkyBoxReply::job_id() const {
+  // @@protoc_insertion_point(field_get:skybox.GenerateSkyBoxReply.job_id)
+  return _internal_job_id();
+}
+inline void GenerateSkyBoxReply::_internal_set_job_id(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  job_id_ = value;
+}
+inline void GenerateSkyBoxReply::set_job_id(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_job_id(value);
+  // @@protoc_insertion_point(field_set:skybox.GenerateSkyBoxReply.job_id)
+}
+
+// -------------------------------------------------------------------
+
+// GenerateRegionRequest
+
+// .skybox.Point min = 1;
+inline bool GenerateRegionRequest::_internal_has_min() const {
+  return this != internal_default_instance() && min_ != nullptr;
+}
+inline bool GenerateRegionRequest::has_min() const {
+  return _internal_has_min();
+}
+inline void GenerateRegionRequest::clear_min() {
+  if (GetArena() == nullptr && min_ != nullptr) {
+    delete min_;
+  }
+  min_ = nullptr;
+}
+inline const ::skybox::Point& GenerateRegionRequest::_internal_min() const {
+  const ::skybox::Point* p = min_;
+  return p != nullptr ? *p : reinterpret_cast<const ::skybox::Point&>(
+      ::skybox::_Point_default_instance_);
+}
+inline const ::skybox::Point& GenerateRegionRequest::min() const {
+  // @@protoc_insertion_point(field_get:skybox.GenerateRegionRequest.min)
+  return _internal_min();
+}
+inline void GenerateRegionRequest::unsafe_arena_set_allocated_min(
+    ::skybox::Point* min) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(min_);
+  }
+  min_ = min;
+  if (min) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:skybox.GenerateRegionRequest.min)
+}
+inline ::skybox::Point* GenerateRegionRequest::release_min() {
+  
+  ::skybox::Point* temp = min_;
+  min_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::skybox::Point* GenerateRegionRequest::unsafe_arena_release_min() {
+  // @@protoc_insertion_point(field_release:skybox.GenerateRegionRequest.min)
+  
+  ::skybox::Point* temp = min_;
+  min_ = nullptr;
+  return temp;
+}
+inline ::skybox::Point* GenerateRegionRequest::_internal_mutable_min() {
+  
+  if (min_ == nullptr) {
+    auto* p = CreateMaybeMessage<::skybox::Point>(GetArena());
+    min_ = p;
+  }
+  return min_;
+}
+inline ::skybox::Point* GenerateRegionRequest::mutable_min() {
+  // @@protoc_insertion_point(field_mutable:skybox.GenerateRegionRequest.min)
+  return _internal_mutable_min();
+}
+inline void GenerateRegionRequest::set_allocated_min(::skybox::Point* min) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete min_;
+  }
+  if (min) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(min);
+    if (message_arena != submessage_arena) {
+      min = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, min, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  min_ = min;
+  // @@protoc_insertion_point(field_set_allocated:skybox.GenerateRegionRequest.min)
+}
+
+// .skybox.Point max = 2;
+inline bool GenerateRegionRequest::_internal_has_max() const {
+  return this != internal_default_instance() && max_ != nullptr;
+}
+inline bool GenerateRegionRequest::has_max() const {
+  return _internal_has_max();
+}
+inline void GenerateRegionRequest::clear_max() {
+  if (GetArena() == nullptr && max_ != nullptr) {
+    delete max_;
+  }
+  max_ = nullptr;
+}
+inline const ::skybox::Point& GenerateRegionRequest::_internal_max() const {
+  const ::skybox::Point* p = max_;
+  return p != nullptr ? *p : reinterpret_cast<const ::skybox::Point&>(
+      ::skybox::_Point_default_instance_);
+}
+inline const ::skybox::Point& GenerateRegionRequest::max() const {
+  // @@protoc_insertion_point(field_get:skybox.GenerateRegionRequest.max)
+  return _internal_max();
+}
+inline void GenerateRegionRequest::unsafe_arena_set_allocated_max(
+    ::skybox::Point* max) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(max_);
+  }
+  max_ = max;
+  if (max) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:skybox.GenerateRegionRequest.max)
+}
+inline ::skybox::Point* GenerateRegionRequest::release_max() {
+  
+  ::skybox::Point* temp = max_;
+  max_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::skybox::Point* GenerateRegionRequest::unsafe_arena_release_max() {
+  // @@protoc_insertion_point(field_release:skybox.GenerateRegionRequest.max)
+  
+  ::skybox::Point* temp = max_;
+  max_ = nullptr;
+  return temp;
+}
+inline ::skybox::Point* GenerateRegionRequest::_internal_mutable_max() {
+  
+  if (max_ == nullptr) {
+    auto* p = CreateMaybeMessage<::skybox::Point>(GetArena());
+    max_ = p;
+  }
+  return max_;
+}
+inline ::skybox::Point* GenerateRegionRequest::mutable_max() {
+  // @@protoc_insertion_point(field_mutable:skybox.GenerateRegionRequest.max)
+  return _internal_mutable_max();
+}
+inline void GenerateRegionRequest::set_allocated_max(::skybox::Point* max) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete max_;
+  }
+  if (max) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(max);
+    if (message_arena != submessage_arena) {
+      max = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, max, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  max_ = max;
+  // @@protoc_insertion_point(field_set_allocated:skybox.GenerateRegionRequest.max)
+}
+
+// float spacing = 3;
+inline void GenerateRegionRequest::clear_spacing() {
+  spacing_ = 0;
+}
+inline float GenerateRegionRequest::_internal_spacing() const {
+  return spacing_;
+}
+inline float GenerateRegionRequest::spacing() const {
+  // @@protoc_insertion_point(field_get:skybox.GenerateRegionRequest.spacing)
+  return _internal_spacing();
+}
+inline void GenerateRegionRequest::_internal_set_spacing(float value) {
+  
+  spacing_ = value;
+}
+inline void GenerateRegionRequest::set_spacing(float value) {
+  _internal_set_spacing(value);
+  // @@protoc_insertion_point(field_set:skybox.GenerateRegionRequest.spacing)
+}
+
+// repeated .skybox.Point positions = 4;
+inline int GenerateRegionRequest::_internal_positions_size() const {
+  return positions_.size();
+}
+inline int GenerateRegionRequest::positions_size() const {
+  return _internal_positions_size();
+}
+inline void GenerateRegionRequest::clear_positions() {
+  positions_.Clear();
+}
+inline ::skybox::Point* GenerateRegionRequest::mutable_positions(int index) {
+  // @@protoc_insertion_point(field_mutable:skybox.GenerateRegionRequest.positions)
+  return positions_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::skybox::Point >*
+GenerateRegionRequest::mutable_positions() {
+  // @@protoc_insertion_point(field_mutable_list:skybox.GenerateRegionRequest.positions)
+  return &positions_;
+}
+inline const ::skybox::Point& GenerateRegionRequest::_internal_positions(int index) const {
+  return positions_.Get(index);
+}
+inline const ::skybox::Point& GenerateRegionRequest::positions(int index) const {
+  // @@protoc_insertion_point(field_get:skybox.GenerateRegionRequest.positions)
+  return _internal_positions(index);
+}
+inline ::skybox::Point* GenerateRegionRequest::_internal_add_positions() {
+  return positions_.Add();
+}
+inline ::skybox::Point* GenerateRegionRequest::add_positions() {
+  // @@protoc_insertion_point(field_add:skybox.GenerateRegionRequest.positions)
+  return _internal_add_positions();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::skybox::Point >&
+GenerateRegionRequest::positions() const {
+  // @@protoc_insertion_point(field_list:skybox.GenerateRegionRequest.positions)
+  return positions_;
+}
+
+// int32 resolution = 5;
+inline void GenerateRegionRequest::clear_resolution() {
+  resolution_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 GenerateRegionRequest::_internal_resolution() const {
+  return resolution_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 GenerateRegionRequest::resolution() const {
+  // @@protoc_insertion_point(field_get:skybox.GenerateRegionRequest.resolution)
+  return _internal_resolution();
+}
+inline void GenerateRegionRequest::_internal_set_resolution(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  resolution_ = value;
+}
+inline void GenerateRegionRequest::set_resolution(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_resolution(value);
+  // @@protoc_insertion_point(field_set:skybox.GenerateRegionRequest.resolution)
+}
+
+// .skybox.ImageFormat format = 6;
+inline void GenerateRegionRequest::clear_format() {
+  format_ = 0;
+}
+inline ::skybox::ImageFormat GenerateRegionRequest::_internal_format() const {
+  return static_cast< ::skybox::ImageFormat >(format_);
+}
+inline ::skybox::ImageFormat GenerateRegionRequest::format() const {
+  // @@protoc_insertion_point(field_get:skybox.GenerateRegionRequest.format)
+  return _internal_format();
+}
+inline void GenerateRegionRequest::_internal_set_format(::skybox::ImageFormat value) {
+  
+  format_ = value;
+}
+inline void GenerateRegionRequest::set_format(::skybox::ImageFormat value) {
+  _internal_set_format(value);
+  // @@protoc_insertion_point(field_set:skybox.GenerateRegionRequest.format)
+}
+
+// .skybox.QualityPreset quality = 7;
+inline void GenerateRegionRequest::clear_quality() {
+  quality_ = 0;
+}
+inline ::skybox::QualityPreset GenerateRegionRequest::_internal_quality() const {
+  return static_cast< ::skybox::QualityPreset >(quality_);
+}
+inline ::skybox::QualityPreset GenerateRegionRequest::quality() const {
+  // @@protoc_insertion_point(field_get:skybox.GenerateRegionRequest.quality)
+  return _internal_quality();
+}
+inline void GenerateRegionRequest::_internal_set_quality(::skybox::QualityPreset value) {
+  
+  quality_ = value;
+}
+inline void GenerateRegionRequest::set_quality(::skybox::QualityPreset value) {
+  _internal_set_quality(value);
+  // @@protoc_insertion_point(field_set:skybox.GenerateRegionRequest.quality)
+}
+
+// int32 scene_id = 8;
+inline void GenerateRegionRequest::clear_scene_id() {
+  scene_id_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 GenerateRegionRequest::_internal_scene_id() const {
+  return scene_id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 GenerateRegionRequest::scene_id() const {
+  // @@protoc_insertion_point(field_get:skybox.GenerateRegionRequest.scene_id)
+  return _internal_scene_id();
+}
+inline void GenerateRegionRequest::_internal_set_scene_id(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  scene_id_ = value;
+}
+inline void GenerateRegionRequest::set_scene_id(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_scene_id(value);
+  // @@protoc_insertion_point(field_set:skybox.GenerateRegionRequest.scene_id)
+}
+
+// .skybox.IblMode ibl = 9;
+inline void GenerateRegionRequest::clear_ibl() {
+  ibl_ = 0;
+}
+inline ::skybox::IblMode GenerateRegionRequest::_internal_ibl() const {
+  return static_cast< ::skybox::IblMode >(ibl_);
+}
+inline ::skybox::IblMode GenerateRegionRequest::ibl() const {
+  // @@protoc_insertion_point(field_get:skybox.GenerateRegionRequest.ibl)
+  return _internal_ibl();
+}
+inline void GenerateRegionRequest::_internal_set_ibl(::skybox::IblMode value) {
+  
+  ibl_ = value;
+}
+inline void GenerateRegionRequest::set_ibl(::skybox::IblMode value) {
+  _internal_set_ibl(value);
+  // @@protoc_insertion_point(field_set:skybox.GenerateRegionRequest.ibl)
+}
+
+// -------------------------------------------------------------------
+
+// GenerateRegionReply
+
+// int32 job_id = 1;
+inline void GenerateRegionReply::clear_job_id() {
+  job_id_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 GenerateRegionReply::_internal_job_id() const {
+  return job_id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 GenerateRegionReply::job_id() const {
+  // @@protoc_insertion_point(field_get:skybox.GenerateRegionReply.job_id)
+  return _internal_job_id();
+}
+inline void GenerateRegionReply::_internal_set_job_id(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  job_id_ = value;
+}
+inline void GenerateRegionReply::set_job_id(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_job_id(value);
+  // @@protoc_insertion_point(field_set:skybox.GenerateRegionReply.job_id)
+}
+
+// int32 child_count = 2;
+inline void GenerateRegionReply::clear_child_count() {
+  child_count_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 GenerateRegionReply::_internal_child_count() const {
+  return child_count_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 GenerateRegionReply::child_count() const {
+  // @@protoc_insertion_point(field_get:skybox.GenerateRegionReply.child_count)
+  return _internal_child_count();
+}
+inline void GenerateRegionReply::_internal_set_child_count(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  child_count_ = value;
+}
+inline void GenerateRegionReply::set_child_count(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_child_count(value);
+  // @@protoc_insertion_point(field_set:skybox.GenerateRegionReply.child_count)
+}
+
+// -------------------------------------------------------------------
+
+// SetClientWeightRequest
+
+// string client = 1;
+inline void SetClientWeightRequest::clear_client() {
+  client_.ClearToEmpty();
+}
+inline const std::string& SetClientWeightRequest::client() const {
+  // @@protoc_insertion_point(field_get:skybox.SetClientWeightRequest.client)
+  return _internal_client();
+}
+inline void SetClientWeightRequest::set_client(const std::string& value) {
+  _internal_set_client(value);
+  // @@protoc_insertion_point(field_set:skybox.SetClientWeightRequest.client)
+}
+inline std::string* SetClientWeightRequest::mutable_client() {
+  // @@protoc_insertion_point(field_mutable:skybox.SetClientWeightRequest.client)
+  return _internal_mutable_client();
+}
+inline const std::string& SetClientWeightRequest::_internal_client() const {
+  return client_.Get();
+}
+inline void SetClientWeightRequest::_internal_set_client(const std::string& value) {
+  
+  client_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void SetClientWeightRequest::set_client(std::string&& value) {
+  
+  client_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:skybox.SetClientWeightRequest.client)
+}
+inline void SetClientWeightRequest::set_client(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  client_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:skybox.SetClientWeightRequest.client)
+}
+inline void SetClientWeightRequest::set_client(const char* value,
+    size_t size) {
+  
+  client_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:skybox.SetClientWeightRequest.client)
+}
+inline std::string* SetClientWeightRequest::_internal_mutable_client() {
+  
+  return client_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* SetClientWeightRequest::release_client() {
+  // @@protoc_insertion_point(field_release:skybox.SetClientWeightRequest.client)
+  return client_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void SetClientWeightRequest::set_allocated_client(std::string* client) {
+  if (client != nullptr) {
+    
+  } else {
+    
+  }
+  client_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), client,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:skybox.SetClientWeightRequest.client)
+}
+
+// float weight = 2;
+inline void SetClientWeightRequest::clear_weight() {
+  weight_ = 0;
+}
+inline float SetClientWeightRequest::_internal_weight() const {
+  return weight_;
+}
+inline float SetClientWeightRequest::weight() const {
+  // @@protoc_insertion_point(field_get:skybox.SetClientWeightRequest.weight)
+  return _internal_weight();
+}
+inline void SetClientWeightRequest::_internal_set_weight(float value) {
+  
+  weight_ = value;
+}
+inline void SetClientWeightRequest::set_weight(float value) {
+  _internal_set_weight(value);
+  // @@protoc_insertion_point(field_set:skybox.SetClientWeightRequest.weight)
+}
+
+// -------------------------------------------------------------------
+
+// SetClientWeightReply
+
+// float weight = 1;
+inline void SetClientWeightReply::clear_weight() {
+  weight_ = 0;
+}
+inline float SetClientWeightReply::_internal_weight() const {
+  return weight_;
 }
-inline std::string* HelloReply::mutable_message() {
-  // @@protoc_insertion_point(field_mutable:skybox.HelloReply.message)
-  return _internal_mutable_message();
+inline float SetClientWeightReply::weight() const {
+  // @@protoc_insertion_point(field_get:skybox.SetClientWeightReply.weight)
+  return _internal_weight();
 }
-inline const std::string& HelloReply::_internal_message() const {
-  return message_.Get();
+inline void SetClientWeightReply::_internal_set_weight(float value) {
+  
+  weight_ = value;
 }
-inline void HelloReply::_internal_set_message(const std::string& value) {
+inline void SetClientWeightReply::set_weight(float value) {
+  _internal_set_weight(value);
+  // @@protoc_insertion_point(field_set:skybox.SetClientWeightReply.weight)
+}
+
+// -------------------------------------------------------------------
+
+// CancelJobRequest
+
+// int32 job_id = 1;
+inline void CancelJobRequest::clear_job_id() {
+  job_id_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 CancelJobRequest::_internal_job_id() const {
+  return job_id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 CancelJobRequest::job_id() const {
+  // @@protoc_insertion_point(field_get:skybox.CancelJobRequest.job_id)
+  return _internal_job_id();
+}
+inline void CancelJobRequest::_internal_set_job_id(::PROTOBUF_NAMESPACE_ID::int32 value) {
   
-  message_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+  job_id_ = value;
 }
-inline void HelloReply::set_message(std::string&& value) {
+inline void CancelJobRequest::set_job_id(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_job_id(value);
+  // @@protoc_insertion_point(field_set:skybox.CancelJobRequest.job_id)
+}
+
+// -------------------------------------------------------------------
+
+// CancelJobReply
+
+// int32 job_id = 1;
+inline void CancelJobReply::clear_job_id() {
+  job_id_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 CancelJobReply::_internal_job_id() const {
+  return job_id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 CancelJobReply::job_id() const {
+  // @@protoc_insertion_point(field_get:skybox.CancelJobReply.job_id)
+  return _internal_job_id();
+}
+inline void CancelJobReply::_internal_set_job_id(::PROTOBUF_NAMESPACE_ID::int32 value) {
   
-  message_.Set(
+  job_id_ = value;
+}
+inline void CancelJobReply::set_job_id(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_job_id(value);
+  // @@protoc_insertion_point(field_set:skybox.CancelJobReply.job_id)
+}
+
+// .skybox.JobStatus job_status = 2;
+inline void CancelJobReply::clear_job_status() {
+  job_status_ = 0;
+}
+inline ::skybox::JobStatus CancelJobReply::_internal_job_status() const {
+  return static_cast< ::skybox::JobStatus >(job_status_);
+}
+inline ::skybox::JobStatus CancelJobReply::job_status() const {
+  // @@protoc_insertion_point(field_get:skybox.CancelJobReply.job_status)
+  return _internal_job_status();
+}
+inline void CancelJobReply::_internal_set_job_status(::skybox::JobStatus value) {
+  
+  job_status_ = value;
+}
+inline void CancelJobReply::set_job_status(::skybox::JobStatus value) {
+  _internal_set_job_status(value);
+  // @@protoc_insertion_point(field_set:skybox.CancelJobReply.job_status)
+}
+
+// -------------------------------------------------------------------
+
+// ExportTraceRequest
+
+// string file_name = 1;
+inline void ExportTraceRequest::clear_file_name() {
+  file_name_.ClearToEmpty();
+}
+inline const std::string& ExportTraceRequest::file_name() const {
+  // @@protoc_insertion_point(field_get:skybox.ExportTraceRequest.file_name)
+  return _internal_file_name();
+}
+inline void ExportTraceRequest::set_file_name(const std::string& value) {
+  _internal_set_file_name(value);
+  // @@protoc_insertion_point(field_set:skybox.ExportTraceRequest.file_name)
+}
+inline std::string* ExportTraceRequest::mutable_file_name() {
+  // @@protoc_insertion_point(field_mutable:skybox.ExportTraceRequest.file_name)
+  return _internal_mutable_file_name();
+}
+inline const std::string& ExportTraceRequest::_internal_file_name() const {
+  return file_name_.Get();
+}
+inline void ExportTraceRequest::_internal_set_file_name(const std::string& value) {
+  
+  file_name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void ExportTraceRequest::set_file_name(std::string&& value) {
+  
+  file_name_.Set(
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:skybox.HelloReply.message)
+  // @@protoc_insertion_point(field_set_rvalue:skybox.ExportTraceRequest.file_name)
 }
-inline void HelloReply::set_message(const char* value) {
+inline void ExportTraceRequest::set_file_name(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   
-  message_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:skybox.HelloReply.message)
+  file_name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:skybox.ExportTraceRequest.file_name)
 }
-inline void HelloReply::set_message(const char* value,
+inline void ExportTraceRequest::set_file_name(const char* value,
     size_t size) {
   
-  message_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+  file_name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:skybox.HelloReply.message)
+  // @@protoc_insertion_point(field_set_pointer:skybox.ExportTraceRequest.file_name)
 }
-inline std::string* HelloReply::_internal_mutable_message() {
+inline std::string* ExportTraceRequest::_internal_mutable_file_name() {
   
-  return message_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return file_name_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
 }
-inline std::string* HelloReply::release_message() {
-  // @@protoc_insertion_point(field_release:skybox.HelloReply.message)
-  return message_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* ExportTraceRequest::release_file_name() {
+  // @@protoc_insertion_point(field_release:skybox.ExportTraceRequest.file_name)
+  return file_name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void HelloReply::set_allocated_message(std::string* message) {
-  if (message != nullptr) {
+inline void ExportTraceRequest::set_allocated_file_name(std::string* file_name) {
+  if (file_name != nullptr) {
     
   } else {
     
   }
-  message_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), message,
+  file_name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), file_name,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:skybox.HelloReply.message)
+  // @@protoc_insertion_point(field_set_allocated:skybox.ExportTraceRequest.file_name)
+}
+
+// int32 max_events = 2;
+inline void ExportTraceRequest::clear_max_events() {
+  max_events_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 ExportTraceRequest::_internal_max_events() const {
+  return max_events_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 ExportTraceRequest::max_events() const {
+  // @@protoc_insertion_point(field_get:skybox.ExportTraceRequest.max_events)
+  return _internal_max_events();
+}
+inline void ExportTraceRequest::_internal_set_max_events(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  max_events_ = value;
+}
+inline void ExportTraceRequest::set_max_events(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_max_events(value);
+  // @@protoc_insertion_point(field_set:skybox.ExportTraceRequest.max_events)
 }
 
 // -------------------------------------------------------------------
 
-// Point
+// ExportTraceReply
+
+// string trace_json = 1;
+inline void ExportTraceReply::clear_trace_json() {
+  trace_json_.ClearToEmpty();
+}
+inline const std::string& ExportTraceReply::trace_json() const {
+  // @@protoc_insertion_point(field_get:skybox.ExportTraceReply.trace_json)
+  return _internal_trace_json();
+}
+inline void ExportTraceReply::set_trace_json(const std::string& value) {
+  _internal_set_trace_json(value);
+  // @@protoc_insertion_point(field_set:skybox.ExportTraceReply.trace_json)
+}
+inline std::string* ExportTraceReply::mutable_trace_json() {
+  // @@protoc_insertion_point(field_mutable:skybox.ExportTraceReply.trace_json)
+  return _internal_mutable_trace_json();
+}
+inline const std::string& ExportTraceReply::_internal_trace_json() const {
+  return trace_json_.Get();
+}
+inline void ExportTraceReply::_internal_set_trace_json(const std::string& value) {
+  
+  trace_json_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void ExportTraceReply::set_trace_json(std::string&& value) {
+  
+  trace_json_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:skybox.ExportTraceReply.trace_json)
+}
+inline void ExportTraceReply::set_trace_json(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  trace_json_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:skybox.ExportTraceReply.trace_json)
+}
+inline void ExportTraceReply::set_trace_json(const char* value,
+    size_t size) {
+  
+  trace_json_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:skybox.ExportTraceReply.trace_json)
+}
+inline std::string* ExportTraceReply::_internal_mutable_trace_json() {
+  
+  return trace_json_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* ExportTraceReply::release_trace_json() {
+  // @@protoc_insertion_point(field_release:skybox.ExportTraceReply.trace_json)
+  return trace_json_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void ExportTraceReply::set_allocated_trace_json(std::string* trace_json) {
+  if (trace_json != nullptr) {
+    
+  } else {
+    
+  }
+  trace_json_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), trace_json,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:skybox.ExportTraceReply.trace_json)
+}
+
+// int32 event_count = 2;
+inline void ExportTraceReply::clear_event_count() {
+  event_count_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 ExportTraceReply::_internal_event_count() const {
+  return event_count_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 ExportTraceReply::event_count() const {
+  // @@protoc_insertion_point(field_get:skybox.ExportTraceReply.event_count)
+  return _internal_event_count();
+}
+inline void ExportTraceReply::_internal_set_event_count(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  event_count_ = value;
+}
+inline void ExportTraceReply::set_event_count(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_event_count(value);
+  // @@protoc_insertion_point(field_set:skybox.ExportTraceReply.event_count)
+}
+
+// bool truncated = 3;
+inline void ExportTraceReply::clear_truncated() {
+  truncated_ = false;
+}
+inline bool ExportTraceReply::_internal_truncated() const {
+  return truncated_;
+}
+inline bool ExportTraceReply::truncated() const {
+  // @@protoc_insertion_point(field_get:skybox.ExportTraceReply.truncated)
+  return _internal_truncated();
+}
+inline void ExportTraceReply::_internal_set_truncated(bool value) {
+  
+  truncated_ = value;
+}
+inline void ExportTraceReply::set_truncated(bool value) {
+  _internal_set_truncated(value);
+  // @@protoc_insertion_point(field_set:skybox.ExportTraceReply.truncated)
+}
+
+// -------------------------------------------------------------------
+
+// GetStatsRequest
+
+// bool prometheus_text = 1;
+inline void GetStatsRequest::clear_prometheus_text() {
+  prometheus_text_ = false;
+}
+inline bool GetStatsRequest::_internal_prometheus_text() const {
+  return prometheus_text_;
+}
+inline bool GetStatsRequest::prometheus_text() const {
+  // @@protoc_insertion_point(field_get:skybox.GetStatsRequest.prometheus_text)
+  return _internal_prometheus_text();
+}
+inline void GetStatsRequest::_internal_set_prometheus_text(bool value) {
+  
+  prometheus_text_ = value;
+}
+inline void GetStatsRequest::set_prometheus_text(bool value) {
+  _internal_set_prometheus_text(value);
+  // @@protoc_insertion_point(field_set:skybox.GetStatsRequest.prometheus_text)
+}
+
+// -------------------------------------------------------------------
+
+// MetricValue
+
+// string name = 1;
+inline void MetricValue::clear_name() {
+  name_.ClearToEmpty();
+}
+inline const std::string& MetricValue::name() const {
+  // @@protoc_insertion_point(field_get:skybox.MetricValue.name)
+  return _internal_name();
+}
+inline void MetricValue::set_name(const std::string& value) {
+  _internal_set_name(value);
+  // @@protoc_insertion_point(field_set:skybox.MetricValue.name)
+}
+inline std::string* MetricValue::mutable_name() {
+  // @@protoc_insertion_point(field_mutable:skybox.MetricValue.name)
+  return _internal_mutable_name();
+}
+inline const std::string& MetricValue::_internal_name() const {
+  return name_.Get();
+}
+inline void MetricValue::_internal_set_name(const std::string& value) {
+  
+  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void MetricValue::set_name(std::string&& value) {
+  
+  name_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:skybox.MetricValue.name)
+}
+inline void MetricValue::set_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:skybox.MetricValue.name)
+}
+inline void MetricValue::set_name(const char* value,
+    size_t size) {
+  
+  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:skybox.MetricValue.name)
+}
+inline std::string* MetricValue::_internal_mutable_name() {
+  
+  return name_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* MetricValue::release_name() {
+  // @@protoc_insertion_point(field_release:skybox.MetricValue.name)
+  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void MetricValue::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:skybox.MetricValue.name)
+}
+
+// double value = 2;
+inline void MetricValue::clear_value() {
+  value_ = 0;
+}
+inline double MetricValue::_internal_value() const {
+  return value_;
+}
+inline double MetricValue::value() const {
+  // @@protoc_insertion_point(field_get:skybox.MetricValue.value)
+  return _internal_value();
+}
+inline void MetricValue::_internal_set_value(double value) {
+  
+  value_ = value;
+}
+inline void MetricValue::set_value(double value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:skybox.MetricValue.value)
+}
+
+// -------------------------------------------------------------------
+
+// HistogramSummary
+
+// string name = 1;
+inline void HistogramSummary::clear_name() {
+  name_.ClearToEmpty();
+}
+inline const std::string& HistogramSummary::name() const {
+  // @@protoc_insertion_point(field_get:skybox.HistogramSummary.name)
+  return _internal_name();
+}
+inline void HistogramSummary::set_name(const std::string& value) {
+  _internal_set_name(value);
+  // @@protoc_insertion_point(field_set:skybox.HistogramSummary.name)
+}
+inline std::string* HistogramSummary::mutable_name() {
+  // @@protoc_insertion_point(field_mutable:skybox.HistogramSummary.name)
+  return _internal_mutable_name();
+}
+inline const std::string& HistogramSummary::_internal_name() const {
+  return name_.Get();
+}
+inline void HistogramSummary::_internal_set_name(const std::string& value) {
+  
+  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void HistogramSummary::set_name(std::string&& value) {
+  
+  name_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:skybox.HistogramSummary.name)
+}
+inline void HistogramSummary::set_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:skybox.HistogramSummary.name)
+}
+inline void HistogramSummary::set_name(const char* value,
+    size_t size) {
+  
+  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:skybox.HistogramSummary.name)
+}
+inline std::string* HistogramSummary::_internal_mutable_name() {
+  
+  return name_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* HistogramSummary::release_name() {
+  // @@protoc_insertion_point(field_release:skybox.HistogramSummary.name)
+  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void HistogramSummary::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:skybox.HistogramSummary.name)
+}
+
+// double count = 2;
+inline void HistogramSummary::clear_count() {
+  count_ = 0;
+}
+inline double HistogramSummary::_internal_count() const {
+  return count_;
+}
+inline double HistogramSummary::count() const {
+  // @@protoc_insertion_point(field_get:skybox.HistogramSummary.count)
+  return _internal_count();
+}
+inline void HistogramSummary::_internal_set_count(double value) {
+  
+  count_ = value;
+}
+inline void HistogramSummary::set_count(double value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:skybox.HistogramSummary.count)
+}
+
+// double sum = 3;
+inline void HistogramSummary::clear_sum() {
+  sum_ = 0;
+}
+inline double HistogramSummary::_internal_sum() const {
+  return sum_;
+}
+inline double HistogramSummary::sum() const {
+  // @@protoc_insertion_point(field_get:skybox.HistogramSummary.sum)
+  return _internal_sum();
+}
+inline void HistogramSummary::_internal_set_sum(double value) {
+  
+  sum_ = value;
+}
+inline void HistogramSummary::set_sum(double value) {
+  _internal_set_sum(value);
+  // @@protoc_insertion_point(field_set:skybox.HistogramSummary.sum)
+}
+
+// double p50 = 4;
+inline void HistogramSummary::clear_p50() {
+  p50_ = 0;
+}
+inline double HistogramSummary::_internal_p50() const {
+  return p50_;
+}
+inline double HistogramSummary::p50() const {
+  // @@protoc_insertion_point(field_get:skybox.HistogramSummary.p50)
+  return _internal_p50();
+}
+inline void HistogramSummary::_internal_set_p50(double value) {
+  
+  p50_ = value;
+}
+inline void HistogramSummary::set_p50(double value) {
+  _internal_set_p50(value);
+  // @@protoc_insertion_point(field_set:skybox.HistogramSummary.p50)
+}
 
-// float x = 1;
-inline void Point::clear_x() {
-  x_ = 0;
+// double p90 = 5;
+inline void HistogramSummary::clear_p90() {
+  p90_ = 0;
 }
-inline float Point::_internal_x() const {
-  return x_;
+inline double HistogramSummary::_internal_p90() const {
+  return p90_;
 }
-inline float Point::x() const {
-  // @@protoc_insertion_point(field_get:skybox.Point.x)
-  return _internal_x();
+inline double HistogramSummary::p90() const {
+  // @@protoc_insertion_point(field_get:skybox.HistogramSummary.p90)
+  return _internal_p90();
 }
-inline void Point::_internal_set_x(float value) {
+inline void HistogramSummary::_internal_set_p90(double value) {
   
-  x_ = value;
+  p90_ = value;
 }
-inline void Point::set_x(float value) {
-  _internal_set_x(value);
-  // @@protoc_insertion_point(field_set:skybox.Point.x)
+inline void HistogramSummary::set_p90(double value) {
+  _internal_set_p90(value);
+  // @@protoc_insertion_point(field_set:skybox.HistogramSummary.p90)
 }
 
-// float y = 2;
-inline void Point::clear_y() {
-  y_ = 0;
+// double p99 = 6;
+inline void HistogramSummary::clear_p99() {
+  p99_ = 0;
 }
-inline float Point::_internal_y() const {
-  return y_;
+inline double HistogramSummary::_internal_p99() const {
+  return p99_;
 }
-inline float Point::y() const {
-  // @@protoc_insertion_point(field_get:skybox.Point.y)
-  return _internal_y();
+inline double HistogramSummary::p99() const {
+  // @@protoc_insertion_point(field_get:skybox.HistogramSummary.p99)
+  return _internal_p99();
 }
-inline void Point::_internal_set_y(float value) {
+inline void HistogramSummary::_internal_set_p99(double value) {
   
-  y_ = value;
+  p99_ = value;
 }
-inline void Point::set_y(float value) {
-  _internal_set_y(value);
-  // @@protoc_insertion_point(field_set:skybox.Point.y)
+inline void HistogramSummary::set_p99(double value) {
+  _internal_set_p99(value);
+  // @@protoc_insertion_point(field_set:skybox.HistogramSummary.p99)
 }
 
-// float z = 3;
-inline void Point::clear_z() {
-  z_ = 0;
+// double max = 7;
+inline void HistogramSummary::clear_max() {
+  max_ = 0;
 }
-inline float Point::_internal_z() const {
-  return z_;
+inline double HistogramSummary::_internal_max() const {
+  return max_;
 }
-inline float Point::z() const {
-  // @@protoc_insertion_point(field_get:skybox.Point.z)
-  return _internal_z();
+inline double HistogramSummary::max() const {
+  // @@protoc_insertion_point(field_get:skybox.HistogramSummary.max)
+  return _internal_max();
 }
-inline void Point::_internal_set_z(float value) {
+inline void HistogramSummary::_internal_set_max(double value) {
   
-  z_ = value;
+  max_ = value;
 }
-inline void Point::set_z(float value) {
-  _internal_set_z(value);
-  // @@protoc_insertion_point(field_set:skybox.Point.z)
+inline void HistogramSummary::set_max(double value) {
+  _internal_set_max(value);
+  // @@protoc_insertion_point(field_set:skybox.HistogramSummary.max)
 }
 
 // -------------------------------------------------------------------
 
-// GenerateSkyBoxRequest
+// GetStatsReply
 
-// .skybox.Point position = 1;
-inline bool GenerateSkyBoxRequest::_internal_has_position() const {
-  return this != internal_default_instance() && position_ != nullptr;
-}
-inline bool GenerateSkyBoxRequest::has_position() const {
-  return _internal_has_position();
+// repeated .skybox.MetricValue counters = 1;
+inline int GetStatsReply::_internal_counters_size() const {
+  return counters_.size();
 }
-inline void GenerateSkyBoxRequest::clear_position() {
-  if (GetArena() == nullptr && position_ != nullptr) {
-    delete position_;
-  }
-  position_ = nullptr;
+inline int GetStatsReply::counters_size() const {
+  return _internal_counters_size();
 }
-inline const ::skybox::Point& GenerateSkyBoxRequest::_internal_position() const {
-  const ::skybox::Point* p = position_;
-  return p != nullptr ? *p : reinterpret_cast<const ::skybox::Point&>(
-      ::skybox::_Point_default_instance_);
+inline void GetStatsReply::clear_counters() {
+  counters_.Clear();
 }
-inline const ::skybox::Point& GenerateSkyBoxRequest::position() const {
-  // @@protoc_insertion_point(field_get:skybox.GenerateSkyBoxRequest.position)
-  return _internal_position();
+inline ::skybox::MetricValue* GetStatsReply::mutable_counters(int index) {
+  // @@protoc_insertion_point(field_mutable:skybox.GetStatsReply.counters)
+  return counters_.Mutable(index);
 }
-inline void GenerateSkyBoxRequest::unsafe_arena_set_allocated_position(
-    ::skybox::Point* position) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(position_);
-  }
-  position_ = position;
-  if (position) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:skybox.GenerateSkyBoxRequest.position)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::skybox::MetricValue >*
+GetStatsReply::mutable_counters() {
+  // @@protoc_insertion_point(field_mutable_list:skybox.GetStatsReply.counters)
+  return &counters_;
 }
-inline ::skybox::Point* GenerateSkyBoxRequest::release_position() {
-  
-  ::skybox::Point* temp = position_;
-  position_ = nullptr;
-  if (GetArena() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-  return temp;
+inline const ::skybox::MetricValue& GetStatsReply::_internal_counters(int index) const {
+  return counters_.Get(index);
 }
-inline ::skybox::Point* GenerateSkyBoxRequest::unsafe_arena_release_position() {
-  // @@protoc_insertion_point(field_release:skybox.GenerateSkyBoxRequest.position)
-  
-  ::skybox::Point* temp = position_;
-  position_ = nullptr;
-  return temp;
+inline const ::skybox::MetricValue& GetStatsReply::counters(int index) const {
+  // @@protoc_insertion_point(field_get:skybox.GetStatsReply.counters)
+  return _internal_counters(index);
 }
-inline ::skybox::Point* GenerateSkyBoxRequest::_internal_mutable_position() {
-  
-  if (position_ == nullptr) {
-    auto* p = CreateMaybeMessage<::skybox::Point>(GetArena());
-    position_ = p;
-  }
-  return position_;
+inline ::skybox::MetricValue* GetStatsReply::_internal_add_counters() {
+  return counters_.Add();
 }
-inline ::skybox::Point* GenerateSkyBoxRequest::mutable_position() {
-  // @@protoc_insertion_point(field_mutable:skybox.GenerateSkyBoxRequest.position)
-  return _internal_mutable_position();
+inline ::skybox::MetricValue* GetStatsReply::add_counters() {
+  // @@protoc_insertion_point(field_add:skybox.GetStatsReply.counters)
+  return _internal_add_counters();
 }
-inline void GenerateSkyBoxRequest::set_allocated_position(::skybox::Point* position) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  if (message_arena == nullptr) {
-    delete position_;
-  }
-  if (position) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(position);
-    if (message_arena != submessage_arena) {
-      position = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, position, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  position_ = position;
-  // @@protoc_insertion_point(field_set_allocated:skybox.GenerateSkyBoxRequest.position)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::skybox::MetricValue >&
+GetStatsReply::counters() const {
+  // @@protoc_insertion_point(field_list:skybox.GetStatsReply.counters)
+  return counters_;
 }
 
-// -------------------------------------------------------------------
+// repeated .skybox.MetricValue gauges = 2;
+inline int GetStatsReply::_internal_gauges_size() const {
+  return gauges_.size();
+}
+inline int GetStatsReply::gauges_size() const {
+  return _internal_gauges_size();
+}
+inline void GetStatsReply::clear_gauges() {
+  gauges_.Clear();
+}
+inline ::skybox::MetricValue* GetStatsReply::mutable_gauges(int index) {
+  // @@protoc_insertion_point(field_mutable:skybox.GetStatsReply.gauges)
+  return gauges_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::skybox::MetricValue >*
+GetStatsReply::mutable_gauges() {
+  // @@protoc_insertion_point(field_mutable_list:skybox.GetStatsReply.gauges)
+  return &gauges_;
+}
+inline const ::skybox::MetricValue& GetStatsReply::_internal_gauges(int index) const {
+  return gauges_.Get(index);
+}
+inline const ::skybox::MetricValue& GetStatsReply::gauges(int index) const {
+  // @@protoc_insertion_point(field_get:skybox.GetStatsReply.gauges)
+  return _internal_gauges(index);
+}
+inline ::skybox::MetricValue* GetStatsReply::_internal_add_gauges() {
+  return gauges_.Add();
+}
+inline ::skybox::MetricValue* GetStatsReply::add_gauges() {
+  // @@protoc_insertion_point(field_add:skybox.GetStatsReply.gauges)
+  return _internal_add_gauges();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::skybox::MetricValue >&
+GetStatsReply::gauges() const {
+  // @@protoc_insertion_point(field_list:skybox.GetStatsReply.gauges)
+  return gauges_;
+}
 
-// GenerateSkyBoxReply
+// repeated .skybox.HistogramSummary histograms = 3;
+inline int GetStatsReply::_internal_histograms_size() const {
+  return histograms_.size();
+}
+inline int GetStatsReply::histograms_size() const {
+  return _internal_histograms_size();
+}
+inline void GetStatsReply::clear_histograms() {
+  histograms_.Clear();
+}
+inline ::skybox::HistogramSummary* GetStatsReply::mutable_histograms(int index) {
+  // @@protoc_insertion_point(field_mutable:skybox.GetStatsReply.histograms)
+  return histograms_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::skybox::HistogramSummary >*
+GetStatsReply::mutable_histograms() {
+  // @@protoc_insertion_point(field_mutable_list:skybox.GetStatsReply.histograms)
+  return &histograms_;
+}
+inline const ::skybox::HistogramSummary& GetStatsReply::_internal_histograms(int index) const {
+  return histograms_.Get(index);
+}
+inline const ::skybox::HistogramSummary& GetStatsReply::histograms(int index) const {
+  // @@protoc_insertion_point(field_get:skybox.GetStatsReply.histograms)
+  return _internal_histograms(index);
+}
+inline ::skybox::HistogramSummary* GetStatsReply::_internal_add_histograms() {
+  return histograms_.Add();
+}
+inline ::skybox::HistogramSummary* GetStatsReply::add_histograms() {
+  // @@protoc_insertion_point(field_add:skybox.GetStatsReply.histograms)
+  return _internal_add_histograms();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::skybox::HistogramSummary >&
+GetStatsReply::histograms() const {
+  // @@protoc_insertion_point(field_list:skybox.GetStatsReply.histograms)
+  return histograms_;
+}
 
-// int32 job_id = 1;
-inline void GenerateSkyBoxReply::clear_job_id() {
-  job_id_ = 0;
+// string prometheus_text = 4;
+inline void GetStatsReply::clear_prometheus_text() {
+  prometheus_text_.ClearToEmpty();
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GenerateSkyBoxReply::_internal_job_id() const {
-  return job_id_;
+inline const std::string& GetStatsReply::prometheus_text() const {
+  // @@protoc_insertion_point(field_get:skybox.GetStatsReply.prometheus_text)
+  return _internal_prometheus_text();
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GenerateSkyBoxReply::job_id() const {
-  // @@protoc_insertion_point(field_get:skybox.GenerateSkyBoxReply.job_id)
-  return _internal_job_id();
+inline void GetStatsReply::set_prometheus_text(const std::string& value) {
+  _internal_set_prometheus_text(value);
+  // @@protoc_insertion_point(field_set:skybox.GetStatsReply.prometheus_text)
 }
-inline void GenerateSkyBoxReply::_internal_set_job_id(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline std::string* GetStatsReply::mutable_prometheus_text() {
+  // @@protoc_insertion_point(field_mutable:skybox.GetStatsReply.prometheus_text)
+  return _internal_mutable_prometheus_text();
+}
+inline const std::string& GetStatsReply::_internal_prometheus_text() const {
+  return prometheus_text_.Get();
+}
+inline void GetStatsReply::_internal_set_prometheus_text(const std::string& value) {
   
-  job_id_ = value;
+  prometheus_text_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
 }
-inline void GenerateSkyBoxReply::set_job_id(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_job_id(value);
-  // @@protoc_insertion_point(field_set:skybox.GenerateSkyBoxReply.job_id)
+inline void GetStatsReply::set_prometheus_text(std::string&& value) {
+  
+  prometheus_text_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:skybox.GetStatsReply.prometheus_text)
+}
+inline void GetStatsReply::set_prometheus_text(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  prometheus_text_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:skybox.GetStatsReply.prometheus_text)
+}
+inline void GetStatsReply::set_prometheus_text(const char* value,
+    size_t size) {
+  
+  prometheus_text_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:skybox.GetStatsReply.prometheus_text)
+}
+inline std::string* GetStatsReply::_internal_mutable_prometheus_text() {
+  
+  return prometheus_text_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* GetStatsReply::release_prometheus_text() {
+  // @@protoc_insertion_point(field_release:skybox.GetStatsReply.prometheus_text)
+  return prometheus_text_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void GetStatsReply::set_allocated_prometheus_text(std::string* prometheus_text) {
+  if (prometheus_text != nullptr) {
+    
+  } else {
+    
+  }
+  prometheus_text_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), prometheus_text,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:skybox.GetStatsReply.prometheus_text)
 }
 
 // -------------------------------------------------------------------
@@ -1511,6 +5166,180 @@ inline void QueryJobReply::set_job_status(::skybox::JobStatus value) {
   // @@protoc_insertion_point(field_set:skybox.QueryJobReply.job_status)
 }
 
+// repeated float sh_coefficients = 3;
+inline int QueryJobReply::_internal_sh_coefficients_size() const {
+  return sh_coefficients_.size();
+}
+inline int QueryJobReply::sh_coefficients_size() const {
+  return _internal_sh_coefficients_size();
+}
+inline void QueryJobReply::clear_sh_coefficients() {
+  sh_coefficients_.Clear();
+}
+inline float QueryJobReply::_internal_sh_coefficients(int index) const {
+  return sh_coefficients_.Get(index);
+}
+inline float QueryJobReply::sh_coefficients(int index) const {
+  // @@protoc_insertion_point(field_get:skybox.QueryJobReply.sh_coefficients)
+  return _internal_sh_coefficients(index);
+}
+inline void QueryJobReply::set_sh_coefficients(int index, float value) {
+  sh_coefficients_.Set(index, value);
+  // @@protoc_insertion_point(field_set:skybox.QueryJobReply.sh_coefficients)
+}
+inline void QueryJobReply::_internal_add_sh_coefficients(float value) {
+  sh_coefficients_.Add(value);
+}
+inline void QueryJobReply::add_sh_coefficients(float value) {
+  _internal_add_sh_coefficients(value);
+  // @@protoc_insertion_point(field_add:skybox.QueryJobReply.sh_coefficients)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+QueryJobReply::_internal_sh_coefficients() const {
+  return sh_coefficients_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+QueryJobReply::sh_coefficients() const {
+  // @@protoc_insertion_point(field_list:skybox.QueryJobReply.sh_coefficients)
+  return _internal_sh_coefficients();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+QueryJobReply::_internal_mutable_sh_coefficients() {
+  return &sh_coefficients_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+QueryJobReply::mutable_sh_coefficients() {
+  // @@protoc_insertion_point(field_mutable_list:skybox.QueryJobReply.sh_coefficients)
+  return _internal_mutable_sh_coefficients();
+}
+
+// int32 total_count = 4;
+inline void QueryJobReply::clear_total_count() {
+  total_count_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 QueryJobReply::_internal_total_count() const {
+  return total_count_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 QueryJobReply::total_count() const {
+  // @@protoc_insertion_point(field_get:skybox.QueryJobReply.total_count)
+  return _internal_total_count();
+}
+inline void QueryJobReply::_internal_set_total_count(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  total_count_ = value;
+}
+inline void QueryJobReply::set_total_count(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_total_count(value);
+  // @@protoc_insertion_point(field_set:skybox.QueryJobReply.total_count)
+}
+
+// int32 completed_count = 5;
+inline void QueryJobReply::clear_completed_count() {
+  completed_count_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 QueryJobReply::_internal_completed_count() const {
+  return completed_count_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 QueryJobReply::completed_count() const {
+  // @@protoc_insertion_point(field_get:skybox.QueryJobReply.completed_count)
+  return _internal_completed_count();
+}
+inline void QueryJobReply::_internal_set_completed_count(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  completed_count_ = value;
+}
+inline void QueryJobReply::set_completed_count(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_completed_count(value);
+  // @@protoc_insertion_point(field_set:skybox.QueryJobReply.completed_count)
+}
+
+// int32 failed_count = 6;
+inline void QueryJobReply::clear_failed_count() {
+  failed_count_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 QueryJobReply::_internal_failed_count() const {
+  return failed_count_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 QueryJobReply::failed_count() const {
+  // @@protoc_insertion_point(field_get:skybox.QueryJobReply.failed_count)
+  return _internal_failed_count();
+}
+inline void QueryJobReply::_internal_set_failed_count(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  failed_count_ = value;
+}
+inline void QueryJobReply::set_failed_count(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_failed_count(value);
+  // @@protoc_insertion_point(field_set:skybox.QueryJobReply.failed_count)
+}
+
+// repeated int32 child_job_ids = 7;
+inline int QueryJobReply::_internal_child_job_ids_size() const {
+  return child_job_ids_.size();
+}
+inline int QueryJobReply::child_job_ids_size() const {
+  return _internal_child_job_ids_size();
+}
+inline void QueryJobReply::clear_child_job_ids() {
+  child_job_ids_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 QueryJobReply::_internal_child_job_ids(int index) const {
+  return child_job_ids_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 QueryJobReply::child_job_ids(int index) const {
+  // @@protoc_insertion_point(field_get:skybox.QueryJobReply.child_job_ids)
+  return _internal_child_job_ids(index);
+}
+inline void QueryJobReply::set_child_job_ids(int index, ::PROTOBUF_NAMESPACE_ID::int32 value) {
+  child_job_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:skybox.QueryJobReply.child_job_ids)
+}
+inline void QueryJobReply::_internal_add_child_job_ids(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  child_job_ids_.Add(value);
+}
+inline void QueryJobReply::add_child_job_ids(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_add_child_job_ids(value);
+  // @@protoc_insertion_point(field_add:skybox.QueryJobReply.child_job_ids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+QueryJobReply::_internal_child_job_ids() const {
+  return child_job_ids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+QueryJobReply::child_job_ids() const {
+  // @@protoc_insertion_point(field_list:skybox.QueryJobReply.child_job_ids)
+  return _internal_child_job_ids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+QueryJobReply::_internal_mutable_child_job_ids() {
+  return &child_job_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+QueryJobReply::mutable_child_job_ids() {
+  // @@protoc_insertion_point(field_mutable_list:skybox.QueryJobReply.child_job_ids)
+  return _internal_mutable_child_job_ids();
+}
+
+// .skybox.IblStatus ibl_status = 8;
+inline void QueryJobReply::clear_ibl_status() {
+  ibl_status_ = 0;
+}
+inline ::skybox::IblStatus QueryJobReply::_internal_ibl_status() const {
+  return static_cast< ::skybox::IblStatus >(ibl_status_);
+}
+inline ::skybox::IblStatus QueryJobReply::ibl_status() const {
+  // @@protoc_insertion_point(field_get:skybox.QueryJobReply.ibl_status)
+  return _internal_ibl_status();
+}
+inline void QueryJobReply::_internal_set_ibl_status(::skybox::IblStatus value) {
+  
+  ibl_status_ = value;
+}
+inline void QueryJobReply::set_ibl_status(::skybox::IblStatus value) {
+  _internal_set_ibl_status(value);
+  // @@protoc_insertion_point(field_set:skybox.QueryJobReply.ibl_status)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -1526,6 +5355,30 @@ inline void QueryJobReply::set_job_status(::skybox::JobStatus value) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -1538,6 +5391,26 @@ template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::skybox::JobStatus>() {
   return ::skybox::JobStatus_descriptor();
 }
+template <> struct is_proto_enum< ::skybox::ImageFormat> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::skybox::ImageFormat>() {
+  return ::skybox::ImageFormat_descriptor();
+}
+template <> struct is_proto_enum< ::skybox::QualityPreset> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::skybox::QualityPreset>() {
+  return ::skybox::QualityPreset_descriptor();
+}
+template <> struct is_proto_enum< ::skybox::IblMode> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::skybox::IblMode>() {
+  return ::skybox::IblMode_descriptor();
+}
+template <> struct is_proto_enum< ::skybox::IblStatus> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::skybox::IblStatus>() {
+  return ::skybox::IblStatus_descriptor();
+}
 
 PROTOBUF_NAMESPACE_CLOSE
 
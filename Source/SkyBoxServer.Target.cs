@@ -0,0 +1,23 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+using UnrealBuildTool;
+using System.Collections.Generic;
+
+public class SkyBoxServerTarget : TargetRules
+{
+	public SkyBoxServerTarget(TargetInfo Target) : base(Target)
+	{
+		// 渲染节点用的采集服务器：还要用GPU渲染，所以是Game而不是Server类型
+		Type = TargetType.Game;
+		ExtraModuleNames.Add("SkyBox");
+
+		// 用不到的功能都不编，启动更快、占内存更少
+		bBuildDeveloperTools = false;
+		bCompileRecast = false;
+		bCompileSpeedTree = false;
+		bCompileAPEX = false;
+		bCompileNvCloth = false;
+		bCompileCEF3 = false;
+		bUseLoggingInShipping = true;
+	}
+}
@@ -0,0 +1,73 @@
+//SkyBoxLoadGen和SkyBoxReplay共用的延迟直方图
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+
+//和服务端SkyBoxHistogram一样的对数-线性分桶，微秒
+class LatencyHistogram
+{
+public:
+    static const int SubBucketBits = 3;
+    static const int SubBuckets = 1 << SubBucketBits;
+    static const int BucketCount = 40 * SubBuckets;
+public:
+    LatencyHistogram() : m_buckets(BucketCount, 0), m_count(0), m_sum(0), m_max(0) {}
+    void Record(uint64_t micros)
+    {
+        ++m_buckets[BucketIndex(micros)];
+        ++m_count;
+        m_sum += micros;
+        m_max = std::max(m_max, micros);
+    }
+    void Merge(const LatencyHistogram& other)
+    {
+        for (int i = 0; i < BucketCount; ++i)
+            m_buckets[i] += other.m_buckets[i];
+        m_count += other.m_count;
+        m_sum += other.m_sum;
+        m_max = std::max(m_max, other.m_max);
+    }
+    uint64_t Count() const { return m_count; }
+    double MeanMillis() const { return m_count > 0 ? m_sum / 1000.0 / m_count : 0.0; }
+    double MaxMillis() const { return m_max / 1000.0; }
+    double PercentileMillis(double p) const
+    {
+        if (m_count == 0)
+            return 0.0;
+        uint64_t rank = (uint64_t)std::ceil(p * m_count);
+        uint64_t seen = 0;
+        for (int i = 0; i < BucketCount; ++i)
+        {
+            seen += m_buckets[i];
+            if (seen >= rank && m_buckets[i] > 0)
+                return std::min(BucketUpperMicros(i), (double)m_max) / 1000.0;
+        }
+        return MaxMillis();
+    }
+private:
+    static int BucketIndex(uint64_t micros)
+    {
+        if (micros < (uint64_t)SubBuckets)
+            return (int)micros;
+        int msb = 63 - __builtin_clzll(micros);
+        int octave = msb - SubBucketBits + 1;
+        int sub = (int)((micros >> (msb - SubBucketBits)) & (SubBuckets - 1));
+        return std::min(octave * SubBuckets + sub, BucketCount - 1);
+    }
+    static double BucketUpperMicros(int bucket)
+    {
+        int octave = bucket / SubBuckets;
+        int sub = bucket % SubBuckets;
+        if (octave == 0)
+            return sub + 1;
+        return std::ldexp(1.0 + (sub + 1) / (double)SubBuckets, octave + SubBucketBits - 1);
+    }
+private:
+    std::vector<uint64_t> m_buckets;
+    uint64_t m_count;
+    uint64_t m_sum;
+    uint64_t m_max;
+};
@@ -0,0 +1,424 @@
+//SkyBoxService的压测工具：按设定的总速率开环发请求（不等上一个返回），统计吞吐和延迟分位数
+//
+//  SkyBoxLoadGen --target=127.0.0.1:50051 --rate=2000 --duration=60 --mix=generate:1,query:8,hello:1
+//
+//开环：发送时间事先按泊松过程排好，延迟从计划发送的时间算起，服务端变慢时不会因为少发请求而把延迟藏起来
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <grpcpp/grpcpp.h>
+#include "skybox.pb.h"
+#include "skybox.grpc.pb.h"
+#include "LatencyHistogram.h"
+
+typedef std::chrono::steady_clock Clock;
+
+
+enum RpcType
+{
+    Generate = 0,
+    Query,
+    Hello,
+    RpcTypeCount,
+};
+
+static const char* RpcNames[RpcTypeCount] = { "GenerateSkyBox", "QueryJob", "SayHello" };
+
+
+struct LoadConfig
+{
+    std::string target = "127.0.0.1:50051";
+    int channels = 8;  //每个channel一条HTTP/2连接
+    int threads = 4;  //收结果的线程数，每个线程一个CompletionQueue
+    double rate = 100.0;  //所有channel加起来每秒发多少个请求
+    double duration = 30.0;  //秒
+    double warmup = 5.0;  //秒，这段时间发的请求不计入结果
+    int deadline_ms = 10000;
+    double weights[RpcTypeCount] = { 1.0, 8.0, 1.0 };
+    int scene_count = 1;
+    int position_count = 1000;  //位置从这么多个格点里随机挑，格点越少去重命中越多
+    float spacing = 100.0f;
+    int resolution = 0;
+    std::string client = "loadgen";  //x-skybox-client，调度和准入按它算
+    bool uniform = false;  //均匀间隔发送，默认按泊松过程
+    unsigned seed = 1;
+};
+
+
+//一个在途的请求，完成后由收结果的线程删掉
+struct Call
+{
+    RpcType type;
+    Clock::time_point scheduled;
+    bool measured;
+    grpc::ClientContext context;
+    grpc::Status status;
+    skybox::GenerateSkyBoxReply generate_reply;
+    skybox::QueryJobReply query_reply;
+    skybox::HelloReply hello_reply;
+    std::unique_ptr<grpc::ClientAsyncResponseReader<skybox::GenerateSkyBoxReply>> generate_reader;
+    std::unique_ptr<grpc::ClientAsyncResponseReader<skybox::QueryJobReply>> query_reader;
+    std::unique_ptr<grpc::ClientAsyncResponseReader<skybox::HelloReply>> hello_reader;
+};
+
+
+//每个收结果的线程自己的统计，结束后合并，不加锁
+struct ThreadStats
+{
+    LatencyHistogram latency[RpcTypeCount];
+    uint64_t errors[RpcTypeCount] = {};
+    std::map<int, uint64_t> codes;  //非OK的状态码
+};
+
+
+class LoadGenerator
+{
+public:
+    explicit LoadGenerator(const LoadConfig& config) : m_config(config), m_outstanding(0), m_late(0), m_max_lag_us(0) {}
+    int Run();
+private:
+    void Schedule();
+    void Issue(RpcType type, Clock::time_point scheduled, bool measured, int index);
+    void Poll(int index);
+    void RememberJob(int job_id);
+    int PickJob(std::mt19937& rng);
+    void Report(double elapsed);
+private:
+    LoadConfig m_config;
+    std::vector<std::unique_ptr<skybox::SkyBoxService::Stub>> m_stubs;
+    std::vector<std::unique_ptr<grpc::CompletionQueue>> m_queues;
+    std::vector<ThreadStats> m_stats;
+    std::atomic<int64_t> m_outstanding;
+    uint64_t m_late;  //调度线程落后计划超过1ms的次数，说明压测机自己跟不上
+    uint64_t m_max_lag_us;
+    uint64_t m_sent[RpcTypeCount] = {};
+    std::mutex m_jobs_lock;
+    std::vector<int> m_jobs;  //最近拿到的job_id，QueryJob从里面挑
+    size_t m_jobs_next = 0;
+    std::mt19937 m_rng;
+};
+
+int LoadGenerator::Run()
+{
+    grpc::ChannelArguments args;
+    args.SetInt("grpc.use_local_subchannel_pool", 1);  //不然同一个target的channel会共用一条连接
+    for (int i = 0; i < m_config.channels; ++i)
+    {
+        args.SetInt("skybox.loadgen.channel", i);
+        std::shared_ptr<grpc::Channel> channel = grpc::CreateCustomChannel(m_config.target, grpc::InsecureChannelCredentials(), args);
+        m_stubs.push_back(skybox::SkyBoxService::NewStub(channel));
+    }
+    for (int i = 0; i < m_config.threads; ++i)
+        m_queues.emplace_back(new grpc::CompletionQueue());
+    m_stats.resize(m_config.threads);
+    m_rng.seed(m_config.seed);
+
+    std::vector<std::thread> pollers;
+    for (int i = 0; i < m_config.threads; ++i)
+        pollers.emplace_back(&LoadGenerator::Poll, this, i);
+    Clock::time_point start = Clock::now();
+    Schedule();
+    //等在途的请求都回来，最多等一个deadline
+    Clock::time_point drain_deadline = Clock::now() + std::chrono::milliseconds(m_config.deadline_ms + 1000);
+    while (m_outstanding.load() > 0 && Clock::now() < drain_deadline)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    double elapsed = std::chrono::duration<double>(Clock::now() - start).count() - m_config.warmup;
+    for (std::unique_ptr<grpc::CompletionQueue>& queue : m_queues)
+        queue->Shutdown();
+    for (std::thread& poller : pollers)
+        poller.join();
+    Report(std::min(elapsed, m_config.duration));
+    return 0;
+}
+
+void LoadGenerator::Schedule()
+{
+    double total_weight = 0.0;
+    for (int i = 0; i < RpcTypeCount; ++i)
+        total_weight += m_config.weights[i];
+    std::exponential_distribution<double> interval(m_config.rate);
+    std::uniform_real_distribution<double> pick(0.0, total_weight);
+    Clock::time_point start = Clock::now();
+    Clock::time_point measure_from = start + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(m_config.warmup));
+    Clock::time_point end = measure_from + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(m_config.duration));
+    Clock::time_point next = start;
+    int index = 0;
+    while (next < end)
+    {
+        Clock::time_point now = Clock::now();
+        if (next > now)
+        {
+            std::this_thread::sleep_until(next);
+        }
+        else
+        {
+            uint64_t lag = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(now - next).count();
+            if (lag > 1000)
+                ++m_late;
+            m_max_lag_us = std::max(m_max_lag_us, lag);
+        }
+        double r = pick(m_rng);
+        int type = 0;
+        while (type < RpcTypeCount - 1 && r >= m_config.weights[type])
+        {
+            r -= m_config.weights[type];
+            ++type;
+        }
+        bool measured = next >= measure_from;
+        if (measured)
+            ++m_sent[type];
+        Issue((RpcType)type, next, measured, index++);
+        double step = m_config.uniform ? 1.0 / m_config.rate : interval(m_rng);
+        next += std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(step));
+    }
+}
+
+void LoadGenerator::Issue(RpcType type, Clock::time_point scheduled, bool measured, int index)
+{
+    Call* call = new Call();
+    call->type = type;
+    call->scheduled = scheduled;
+    call->measured = measured;
+    call->context.set_deadline(std::chrono::system_clock::now() + std::chrono::milliseconds(m_config.deadline_ms));
+    call->context.AddMetadata("x-skybox-client", m_config.client);
+    skybox::SkyBoxService::Stub* stub = m_stubs[index % m_stubs.size()].get();
+    grpc::CompletionQueue* queue = m_queues[index % m_queues.size()].get();
+    ++m_outstanding;
+    switch (type)
+    {
+    case RpcType::Generate:
+    {
+        //在一个立方体格点里随机挑位置，格点数决定了重复请求的比例
+        int side = std::max(1, (int)std::ceil(std::cbrt((double)m_config.position_count)));
+        std::uniform_int_distribution<int> cell(0, m_config.position_count - 1);
+        int n = cell(m_rng);
+        skybox::GenerateSkyBoxRequest request;
+        request.set_scene_id(m_config.scene_count > 1 ? n % m_config.scene_count : 0);
+        request.mutable_position()->set_x((n % side) * m_config.spacing);
+        request.mutable_position()->set_y((n / side % side) * m_config.spacing);
+        request.mutable_position()->set_z((n / side / side) * m_config.spacing);
+        request.set_resolution(m_config.resolution);
+        call->generate_reader = stub->PrepareAsyncGenerateSkyBox(&call->context, request, queue);
+        call->generate_reader->StartCall();
+        call->generate_reader->Finish(&call->generate_reply, &call->status, call);
+        break;
+    }
+    case RpcType::Query:
+    {
+        skybox::QueryJobRequest request;
+        request.set_job_id(PickJob(m_rng));
+        call->query_reader = stub->PrepareAsyncQueryJob(&call->context, request, queue);
+        call->query_reader->StartCall();
+        call->query_reader->Finish(&call->query_reply, &call->status, call);
+        break;
+    }
+    default:
+    {
+        skybox::HelloRequest request;
+        request.set_name(m_config.client);
+        call->hello_reader = stub->PrepareAsyncSayHello(&call->context, request, queue);
+        call->hello_reader->StartCall();
+        call->hello_reader->Finish(&call->hello_reply, &call->status, call);
+        break;
+    }
+    }
+}
+
+void LoadGenerator::Poll(int index)
+{
+    ThreadStats& stats = m_stats[index];
+    void* tag = NULL;
+    bool ok = false;
+    while (m_queues[index]->Next(&tag, &ok))
+    {
+        Call* call = static_cast<Call*>(tag);
+        uint64_t micros = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - call->scheduled).count();
+        if (call->measured)
+        {
+            if (ok && call->status.ok())
+            {
+                stats.latency[call->type].Record(micros);
+            }
+            else
+            {
+                ++stats.errors[call->type];
+                ++stats.codes[ok ? (int)call->status.error_code() : (int)grpc::StatusCode::UNKNOWN];
+            }
+        }
+        if (call->type == RpcType::Generate && ok && call->status.ok())
+            RememberJob(call->generate_reply.job_id());
+        delete call;
+        --m_outstanding;
+    }
+}
+
+void LoadGenerator::RememberJob(int job_id)
+{
+    const size_t capacity = 4096;
+    std::lock_guard<std::mutex> lock(m_jobs_lock);
+    if (m_jobs.size() < capacity)
+    {
+        m_jobs.push_back(job_id);
+        return;
+    }
+    m_jobs[m_jobs_next] = job_id;
+    m_jobs_next = (m_jobs_next + 1) % capacity;
+}
+
+int LoadGenerator::PickJob(std::mt19937& rng)
+{
+    //调度线程调用；还没拿到job_id时查一个不存在的，服务端一样要走完整个查找
+    std::lock_guard<std::mutex> lock(m_jobs_lock);
+    if (m_jobs.empty())
+        return 1;
+    std::uniform_int_distribution<size_t> pick(0, m_jobs.size() - 1);
+    return m_jobs[pick(rng)];
+}
+
+void LoadGenerator::Report(double elapsed)
+{
+    ThreadStats total;
+    for (const ThreadStats& stats : m_stats)
+    {
+        for (int i = 0; i < RpcTypeCount; ++i)
+        {
+            total.latency[i].Merge(stats.latency[i]);
+            total.errors[i] += stats.errors[i];
+        }
+        for (const std::pair<const int, uint64_t>& code : stats.codes)
+            total.codes[code.first] += code.second;
+    }
+    printf("target=%s channels=%d rate=%.1f/s duration=%.1fs\n", m_config.target.c_str(), m_config.channels, m_config.rate, elapsed);
+    printf("%-16s %10s %10s %8s %10s %9s %9s %9s %9s %9s %9s\n", "rpc", "sent", "ok", "errors", "ok/s", "mean_ms", "p50_ms", "p90_ms", "p99_ms", "p999_ms", "max_ms");
+    LatencyHistogram all;
+    uint64_t sent = 0;
+    uint64_t errors = 0;
+    for (int i = 0; i < RpcTypeCount; ++i)
+    {
+        const LatencyHistogram& h = total.latency[i];
+        all.Merge(h);
+        sent += m_sent[i];
+        errors += total.errors[i];
+        if (m_sent[i] == 0)
+            continue;
+        printf("%-16s %10llu %10llu %8llu %10.1f %9.2f %9.2f %9.2f %9.2f %9.2f %9.2f\n", RpcNames[i],
+            (unsigned long long)m_sent[i], (unsigned long long)h.Count(), (unsigned long long)total.errors[i], elapsed > 0.0 ? h.Count() / elapsed : 0.0,
+            h.MeanMillis(), h.PercentileMillis(0.50), h.PercentileMillis(0.90), h.PercentileMillis(0.99), h.PercentileMillis(0.999), h.MaxMillis());
+    }
+    printf("%-16s %10llu %10llu %8llu %10.1f %9.2f %9.2f %9.2f %9.2f %9.2f %9.2f\n", "all",
+        (unsigned long long)sent, (unsigned long long)all.Count(), (unsigned long long)errors, elapsed > 0.0 ? all.Count() / elapsed : 0.0,
+        all.MeanMillis(), all.PercentileMillis(0.50), all.PercentileMillis(0.90), all.PercentileMillis(0.99), all.PercentileMillis(0.999), all.MaxMillis());
+    for (const std::pair<const int, uint64_t>& code : total.codes)
+        printf("status %d: %llu\n", code.first, (unsigned long long)code.second);
+    if (m_late > 0)
+        printf("WARNING: scheduler fell behind %llu times (max lag %.2fms), add threads or machines\n", (unsigned long long)m_late, m_max_lag_us / 1000.0);
+}
+
+
+static bool ParseMix(const std::string& text, double* weights)
+{
+    //generate:1,query:8,hello:1，没写的类型权重是0
+    for (int i = 0; i < RpcTypeCount; ++i)
+        weights[i] = 0.0;
+    size_t begin = 0;
+    while (begin < text.size())
+    {
+        size_t end = text.find(',', begin);
+        if (end == std::string::npos)
+            end = text.size();
+        std::string item = text.substr(begin, end - begin);
+        size_t colon = item.find(':');
+        if (colon == std::string::npos)
+            return false;
+        std::string name = item.substr(0, colon);
+        double weight = atof(item.c_str() + colon + 1);
+        if (name == "generate")
+            weights[RpcType::Generate] = weight;
+        else if (name == "query")
+            weights[RpcType::Query] = weight;
+        else if (name == "hello")
+            weights[RpcType::Hello] = weight;
+        else
+            return false;
+        begin = end + 1;
+    }
+    return weights[0] + weights[1] + weights[2] > 0.0;
+}
+
+static void Usage()
+{
+    printf("SkyBoxLoadGen [--target=host:port] [--rate=N] [--duration=S] [--warmup=S] [--channels=N] [--threads=N]\n"
+        "              [--mix=generate:1,query:8,hello:1] [--positions=N] [--spacing=F] [--scenes=N] [--resolution=N]\n"
+        "              [--client=ID] [--deadline_ms=N] [--uniform] [--seed=N]\n");
+}
+
+int main(int argc, char** argv)
+{
+    LoadConfig config;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        size_t eq = arg.find('=');
+        std::string key = arg.substr(0, eq);
+        const char* value = eq != std::string::npos ? argv[i] + eq + 1 : "";
+        if (key == "--target")
+            config.target = value;
+        else if (key == "--rate")
+            config.rate = atof(value);
+        else if (key == "--duration")
+            config.duration = atof(value);
+        else if (key == "--warmup")
+            config.warmup = atof(value);
+        else if (key == "--channels")
+            config.channels = atoi(value);
+        else if (key == "--threads")
+            config.threads = atoi(value);
+        else if (key == "--positions")
+            config.position_count = atoi(value);
+        else if (key == "--spacing")
+            config.spacing = (float)atof(value);
+        else if (key == "--scenes")
+            config.scene_count = atoi(value);
+        else if (key == "--resolution")
+            config.resolution = atoi(value);
+        else if (key == "--client")
+            config.client = value;
+        else if (key == "--deadline_ms")
+            config.deadline_ms = atoi(value);
+        else if (key == "--uniform")
+            config.uniform = true;
+        else if (key == "--seed")
+            config.seed = (unsigned)atoi(value);
+        else if (key == "--mix")
+        {
+            if (!ParseMix(value, config.weights))
+            {
+                fprintf(stderr, "bad --mix: %s\n", value);
+                return 1;
+            }
+        }
+        else
+        {
+            Usage();
+            return key == "--help" ? 0 : 1;
+        }
+    }
+    if (config.rate <= 0.0 || config.duration <= 0.0 || config.channels <= 0 || config.threads <= 0 || config.position_count <= 0)
+    {
+        Usage();
+        return 1;
+    }
+    LoadGenerator generator(config);
+    return generator.Run();
+}
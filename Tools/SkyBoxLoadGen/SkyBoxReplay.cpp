@@ -0,0 +1,771 @@
+//按SkyBox.RecordJobs / -SkyBoxRecordJobs=录下的请求重放，用来评估缓存大小、调度策略、rig数的改动
+//
+//  SkyBoxReplay --trace=SkyBoxJobs.sbjt --target=127.0.0.1:50051 --speed=1
+//
+//请求按录制时的到达时间（除以--speed）开环发出，每个请求带上原来的x-skybox-client
+//QueryJob、CancelJob里的job_id换成重放时同一个GenerateSkyBox（GenerateRegion）拿到的job_id：生成请求的回复还没到时先压着，回复到了再发；
+//重放时对应的生成请求都失败了的，用job_id 0照样发出去并单独计数；文件里找不到生成请求的（录制开始前就有的任务）读完文件就定下来跳过
+//所以两次重放发出的请求种类和条数一样，只有被压着的查询、取消的发出时间取决于服务端回复的快慢
+//服务端最好用-SkyBoxSynthetic启动并且是新进程：合成后端不依赖场景和GPU，服务端的分位数是从启动开始累计的
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <grpcpp/grpcpp.h>
+#include "skybox.pb.h"
+#include "skybox.grpc.pb.h"
+#include "LatencyHistogram.h"
+
+typedef std::chrono::steady_clock Clock;
+
+
+//和Source/SkyBox/SkyBoxJobTrace.h里的格式一致
+enum RecordType
+{
+    NewClient = 1,
+    Generate = 2,
+    Query = 3,
+    Region = 4,
+    Cancel = 5,
+    ClientWeight = 6,
+    RecordTypeCount,
+};
+
+static const uint32_t TraceVersion = 2;  //version 1的文件也能读
+static const uint32_t MaxTraceClients = 1 << 20;
+
+
+struct TraceRecord
+{
+    int type = 0;
+    int64_t micros = 0;  //相对开始录制的时间
+    uint32_t client = 0;
+    int scene_id = 0;
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+    int resolution = 0;
+    int format = 0;
+    int quality = 0;
+    int ibl = 0;
+    bool supersede = false;
+    int job_id = 0;  //录制时返回（Generate、Region）或查询、取消（Query、Cancel）的job_id
+    int job_status = 0;
+    float min[3] = { 0.0f, 0.0f, 0.0f };  //Region
+    float max[3] = { 0.0f, 0.0f, 0.0f };
+    float spacing = 0.0f;
+    std::vector<float> positions;  //Region，每个点x y z三个数
+    std::string target;  //ClientWeight
+    float weight = 0.0f;
+};
+
+
+class TraceReader
+{
+public:
+    TraceReader(const std::vector<uint8_t>& data) : m_data(data), m_pos(0), m_ok(true) {}
+    bool Ok() const { return m_ok; }
+    bool AtEnd() const { return m_pos >= m_data.size(); }
+    size_t Remaining() const { return m_pos < m_data.size() ? m_data.size() - m_pos : 0; }
+    uint8_t Byte()
+    {
+        if (m_pos >= m_data.size())
+        {
+            m_ok = false;
+            return 0;
+        }
+        return m_data[m_pos++];
+    }
+    uint32_t Fixed32()
+    {
+        uint32_t value = 0;
+        for (int i = 0; i < 4; ++i)
+            value |= (uint32_t)Byte() << (8 * i);
+        return value;
+    }
+    uint64_t Fixed64()
+    {
+        uint64_t low = Fixed32();
+        return low | ((uint64_t)Fixed32() << 32);
+    }
+    float Float()
+    {
+        uint32_t bits = Fixed32();
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+    uint64_t Varint()
+    {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64 && m_ok; shift += 7)
+        {
+            uint8_t byte = Byte();
+            value |= (uint64_t)(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0)
+                return value;
+        }
+        m_ok = false;
+        return 0;
+    }
+    int64_t SVarint()
+    {
+        uint64_t value = Varint();
+        return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+    }
+    std::string String()
+    {
+        uint64_t size = Varint();
+        if (!m_ok || size > m_data.size() - m_pos)
+        {
+            m_ok = false;
+            return std::string();
+        }
+        std::string value((const char*)&m_data[m_pos], (size_t)size);
+        m_pos += (size_t)size;
+        return value;
+    }
+private:
+    const std::vector<uint8_t>& m_data;
+    size_t m_pos;
+    bool m_ok;
+};
+
+
+//服务端还在写的文件最后一条可能不完整，丢掉就行
+static bool LoadTrace(const std::string& path, std::vector<std::string>& clients, std::vector<TraceRecord>& records)
+{
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file == NULL)
+    {
+        fprintf(stderr, "cannot open %s\n", path.c_str());
+        return false;
+    }
+    std::vector<uint8_t> data;
+    uint8_t buffer[65536];
+    size_t read = 0;
+    while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0)
+        data.insert(data.end(), buffer, buffer + read);
+    fclose(file);
+    TraceReader reader(data);
+    uint8_t magic[4] = { reader.Byte(), reader.Byte(), reader.Byte(), reader.Byte() };
+    uint32_t version = reader.Fixed32();
+    reader.Fixed64();  //开始录制的unix时间，重放用不上
+    if (!reader.Ok() || memcmp(magic, "SBJT", 4) != 0 || version == 0 || version > TraceVersion)
+    {
+        fprintf(stderr, "%s is not a SkyBox job trace (version 1~%u)\n", path.c_str(), TraceVersion);
+        return false;
+    }
+    int64_t micros = 0;
+    while (!reader.AtEnd())
+    {
+        TraceRecord record;
+        record.type = reader.Byte();
+        micros += reader.SVarint();
+        record.micros = micros;
+        record.client = (uint32_t)reader.Varint();
+        if (record.type == RecordType::NewClient)
+        {
+            std::string name = reader.String();
+            if (!reader.Ok())
+                break;
+            //服务端按出现顺序从0编号，不是下一个编号说明文件坏了，不能拿它去resize
+            if (record.client != clients.size() || clients.size() >= MaxTraceClients)
+            {
+                fprintf(stderr, "bad client index %u, stop reading\n", record.client);
+                break;
+            }
+            clients.push_back(name);
+            continue;
+        }
+        if (record.type == RecordType::Generate)
+        {
+            record.scene_id = (int)reader.Varint();
+            record.x = reader.Float();
+            record.y = reader.Float();
+            record.z = reader.Float();
+            record.resolution = (int)reader.Varint();
+            record.format = reader.Byte();
+            record.quality = reader.Byte();
+            if (version >= 2)
+                record.ibl = reader.Byte();
+            record.supersede = reader.Byte() != 0;
+            record.job_id = (int)reader.Varint();
+        }
+        else if (record.type == RecordType::Query || (version >= 2 && record.type == RecordType::Cancel))
+        {
+            record.job_id = (int)reader.Varint();
+            record.job_status = reader.Byte();
+        }
+        else if (version >= 2 && record.type == RecordType::Region)
+        {
+            record.scene_id = (int)reader.Varint();
+            for (int i = 0; i < 3; ++i)
+                record.min[i] = reader.Float();
+            for (int i = 0; i < 3; ++i)
+                record.max[i] = reader.Float();
+            record.spacing = reader.Float();
+            //点数也是文件里读出来的，先和剩下的字节数比，坏文件不会让这里分配一大块内存
+            uint64_t count = reader.Varint();
+            if (!reader.Ok() || count > reader.Remaining() / 12)
+                break;
+            record.positions.resize((size_t)count * 3);
+            for (float& value : record.positions)
+                value = reader.Float();
+            record.resolution = (int)reader.Varint();
+            record.format = reader.Byte();
+            record.quality = reader.Byte();
+            record.ibl = reader.Byte();
+            record.job_id = (int)reader.Varint();
+        }
+        else if (version >= 2 && record.type == RecordType::ClientWeight)
+        {
+            record.target = reader.String();
+            record.weight = reader.Float();
+        }
+        else
+        {
+            fprintf(stderr, "unknown record type %d, stop reading\n", record.type);
+            break;
+        }
+        if (!reader.Ok() || record.client >= clients.size())
+            break;
+        records.push_back(record);
+    }
+    //多个RPC线程并发写，到达时间不一定有序
+    std::stable_sort(records.begin(), records.end(), [](const TraceRecord& a, const TraceRecord& b) { return a.micros < b.micros; });
+    return true;
+}
+
+
+struct ReplayConfig
+{
+    std::string trace;
+    std::string target = "127.0.0.1:50051";
+    double speed = 1.0;  //2表示两倍速重放
+    int channels = 8;
+    int threads = 4;
+    int deadline_ms = 10000;
+    double drain_timeout = 600.0;  //秒，发完之后最多等服务端把队列做完这么久
+};
+
+
+struct Call
+{
+    int type;
+    Clock::time_point scheduled;
+    int recorded_job_id;
+    grpc::ClientContext context;
+    grpc::Status status;
+    skybox::GenerateSkyBoxReply generate_reply;
+    skybox::QueryJobReply query_reply;
+    skybox::GenerateRegionReply region_reply;
+    skybox::CancelJobReply cancel_reply;
+    skybox::SetClientWeightReply weight_reply;
+    std::unique_ptr<grpc::ClientAsyncResponseReader<skybox::GenerateSkyBoxReply>> generate_reader;
+    std::unique_ptr<grpc::ClientAsyncResponseReader<skybox::QueryJobReply>> query_reader;
+    std::unique_ptr<grpc::ClientAsyncResponseReader<skybox::GenerateRegionReply>> region_reader;
+    std::unique_ptr<grpc::ClientAsyncResponseReader<skybox::CancelJobReply>> cancel_reader;
+    std::unique_ptr<grpc::ClientAsyncResponseReader<skybox::SetClientWeightReply>> weight_reader;
+};
+
+
+//按RecordType下标
+struct ThreadStats
+{
+    LatencyHistogram latency[RecordTypeCount];
+    uint64_t errors[RecordTypeCount] = {};
+    std::map<int, uint64_t> codes;
+};
+
+
+//GetStats的一次快照
+struct ServerStats
+{
+    bool ok = false;
+    std::map<std::string, double> counters;
+    std::map<std::string, double> gauges;
+    std::map<std::string, skybox::HistogramSummary> histograms;
+    double Counter(const char* name) const
+    {
+        std::map<std::string, double>::const_iterator itr = counters.find(name);
+        return itr != counters.end() ? itr->second : 0.0;
+    }
+    double Gauge(const char* name) const
+    {
+        std::map<std::string, double>::const_iterator itr = gauges.find(name);
+        return itr != gauges.end() ? itr->second : 0.0;
+    }
+};
+
+
+class Replayer
+{
+public:
+    Replayer(const ReplayConfig& config, const std::vector<std::string>& clients, const std::vector<TraceRecord>& records)
+        : m_config(config), m_clients(clients), m_records(records), m_outstanding(0), m_late(0), m_max_lag_us(0) {}
+    int Run();
+private:
+    void Schedule();
+    void Issue(const TraceRecord& record, Clock::time_point scheduled, int index);
+    void Send(const TraceRecord& record, Clock::time_point scheduled, int index, int replay_job_id);  //调用时已经持有m_jobs_lock
+    void ReleasePending(int recorded_job_id);  //对应的生成请求有了结果，压着的查询、取消发出去
+    void Poll(int index);
+    ServerStats FetchStats();
+    void WaitForDrain();
+    void Report(const ServerStats& before, const ServerStats& after, double send_seconds, double total_seconds);
+private:
+    ReplayConfig m_config;
+    const std::vector<std::string>& m_clients;
+    const std::vector<TraceRecord>& m_records;
+    std::vector<std::unique_ptr<skybox::SkyBoxService::Stub>> m_stubs;
+    std::vector<std::unique_ptr<grpc::CompletionQueue>> m_queues;
+    std::vector<ThreadStats> m_stats;
+    std::atomic<int64_t> m_outstanding;
+    uint64_t m_late;
+    uint64_t m_max_lag_us;
+    //下面这些都由m_jobs_lock保护
+    std::mutex m_jobs_lock;
+    uint64_t m_sent[RecordTypeCount] = {};
+    uint64_t m_skipped[RecordTypeCount] = {};  //Query、Cancel录制时的job_id在文件里没有生成请求
+    uint64_t m_delayed[RecordTypeCount] = {};  //Query、Cancel等生成请求的回复到了才发
+    uint64_t m_unmapped[RecordTypeCount] = {};  //Query、Cancel的生成请求在重放里都失败了，用job_id 0发的
+    uint64_t m_recorded_rejected = 0;
+    bool m_closing = false;  //CompletionQueue要Shutdown了，不能再发
+    std::vector<bool> m_orphans;  //按记录下标，录制时的job_id在它之前没有生成请求
+    std::map<int, int> m_producers_left;  //录制时的job_id -> 还没有结果的生成请求数（包括还没到时间发的）
+    std::map<int, std::vector<int>> m_pending;  //录制时的job_id -> 压着的Query、Cancel的记录下标
+    std::map<int, int> m_job_map;  //录制时的job_id -> 重放拿到的job_id，区域任务的region_id也在这里
+    std::map<int, Clock::time_point> m_job_requested;  //重放的job_id -> 第一次请求的计划时间，查到完成后删掉
+    LatencyHistogram m_completion;  //从第一次GenerateSkyBox到QueryJob第一次看到Succeeded
+};
+
+int Replayer::Run()
+{
+    grpc::ChannelArguments args;
+    args.SetInt("grpc.use_local_subchannel_pool", 1);
+    for (int i = 0; i < m_config.channels; ++i)
+    {
+        args.SetInt("skybox.replay.channel", i);
+        std::shared_ptr<grpc::Channel> channel = grpc::CreateCustomChannel(m_config.target, grpc::InsecureChannelCredentials(), args);
+        m_stubs.push_back(skybox::SkyBoxService::NewStub(channel));
+    }
+    for (int i = 0; i < m_config.threads; ++i)
+        m_queues.emplace_back(new grpc::CompletionQueue());
+    m_stats.resize(m_config.threads);
+    //哪些查询、取消能在重放里找到生成请求，只看文件，和重放时的快慢无关
+    m_orphans.assign(m_records.size(), false);
+    for (size_t i = 0; i < m_records.size(); ++i)
+    {
+        const TraceRecord& record = m_records[i];
+        if ((record.type == RecordType::Generate || record.type == RecordType::Region) && record.job_id != 0)
+            ++m_producers_left[record.job_id];
+        else if (record.type == RecordType::Query || record.type == RecordType::Cancel)
+            m_orphans[i] = m_producers_left.count(record.job_id) == 0;
+    }
+
+    ServerStats before = FetchStats();
+    if (!before.ok)
+        fprintf(stderr, "GetStats failed, server side numbers will be missing\n");
+    std::vector<std::thread> pollers;
+    for (int i = 0; i < m_config.threads; ++i)
+        pollers.emplace_back(&Replayer::Poll, this, i);
+    Clock::time_point start = Clock::now();
+    Schedule();
+    Clock::time_point drain_deadline = Clock::now() + std::chrono::milliseconds(m_config.deadline_ms + 1000);
+    while (m_outstanding.load() > 0 && Clock::now() < drain_deadline)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    double send_seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    {
+        //Poll线程发压着的请求时也持有这个锁，Shutdown之后不会再往队列里加
+        std::lock_guard<std::mutex> lock(m_jobs_lock);
+        m_closing = true;
+        for (std::unique_ptr<grpc::CompletionQueue>& queue : m_queues)
+            queue->Shutdown();
+    }
+    for (std::thread& poller : pollers)
+        poller.join();
+    if (before.ok)
+        WaitForDrain();
+    double total_seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    Report(before, FetchStats(), send_seconds, total_seconds);
+    return 0;
+}
+
+void Replayer::Schedule()
+{
+    Clock::time_point start = Clock::now();
+    int index = 0;
+    for (const TraceRecord& record : m_records)
+    {
+        Clock::time_point next = start + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(record.micros / 1000000.0 / m_config.speed));
+        Clock::time_point now = Clock::now();
+        if (next > now)
+        {
+            std::this_thread::sleep_until(next);
+        }
+        else
+        {
+            uint64_t lag = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(now - next).count();
+            if (lag > 1000)
+                ++m_late;
+            m_max_lag_us = std::max(m_max_lag_us, lag);
+        }
+        Issue(record, next, index++);
+    }
+}
+
+void Replayer::Issue(const TraceRecord& record, Clock::time_point scheduled, int index)
+{
+    std::lock_guard<std::mutex> lock(m_jobs_lock);
+    int replay_job_id = 0;
+    if (record.type == RecordType::Query || record.type == RecordType::Cancel)
+    {
+        if (m_orphans[index])
+        {
+            ++m_skipped[record.type];
+            return;
+        }
+        std::map<int, int>::iterator itr = m_job_map.find(record.job_id);
+        if (itr != m_job_map.end())
+        {
+            replay_job_id = itr->second;
+        }
+        else if (m_producers_left[record.job_id] > 0)
+        {
+            //生成请求还没回来，压着等ReleasePending；算在m_outstanding里，Run不会提前收尾
+            ++m_delayed[record.type];
+            m_pending[record.job_id].push_back(index);
+            ++m_outstanding;
+            return;
+        }
+        else
+        {
+            ++m_unmapped[record.type];
+        }
+    }
+    else if ((record.type == RecordType::Generate || record.type == RecordType::Region) && record.job_id == 0)
+    {
+        ++m_recorded_rejected;
+    }
+    Send(record, scheduled, index, replay_job_id);
+}
+
+void Replayer::ReleasePending(int recorded_job_id)
+{
+    std::lock_guard<std::mutex> lock(m_jobs_lock);
+    std::map<int, std::vector<int>>::iterator pending = m_pending.find(recorded_job_id);
+    if (pending == m_pending.end() || m_closing)
+        return;  //收尾时还压着的留在m_pending里，Report会报出来
+    std::map<int, int>::iterator itr = m_job_map.find(recorded_job_id);
+    if (itr == m_job_map.end() && m_producers_left[recorded_job_id] > 0)
+        return;  //这一个失败了，后面还有同样的生成请求
+    std::vector<int> indices = std::move(pending->second);
+    m_pending.erase(pending);
+    for (int index : indices)
+    {
+        const TraceRecord& record = m_records[index];
+        if (itr == m_job_map.end())
+            ++m_unmapped[record.type];
+        //延迟从这时算起，等生成请求回复的时间不算到查询、取消的延迟里
+        Send(record, Clock::now(), index, itr != m_job_map.end() ? itr->second : 0);
+        --m_outstanding;
+    }
+}
+
+void Replayer::Send(const TraceRecord& record, Clock::time_point scheduled, int index, int replay_job_id)
+{
+    ++m_sent[record.type];
+    Call* call = new Call();
+    call->type = record.type;
+    call->scheduled = scheduled;
+    call->recorded_job_id = record.job_id;
+    call->context.set_deadline(std::chrono::system_clock::now() + std::chrono::milliseconds(m_config.deadline_ms));
+    call->context.AddMetadata("x-skybox-client", m_clients[record.client]);
+    skybox::SkyBoxService::Stub* stub = m_stubs[index % m_stubs.size()].get();
+    grpc::CompletionQueue* queue = m_queues[index % m_queues.size()].get();
+    ++m_outstanding;
+    if (record.type == RecordType::Generate)
+    {
+        skybox::GenerateSkyBoxRequest request;
+        request.set_scene_id(record.scene_id);
+        request.mutable_position()->set_x(record.x);
+        request.mutable_position()->set_y(record.y);
+        request.mutable_position()->set_z(record.z);
+        request.set_resolution(record.resolution);
+        request.set_format((skybox::ImageFormat)record.format);
+        request.set_quality((skybox::QualityPreset)record.quality);
+        request.set_ibl((skybox::IblMode)record.ibl);
+        request.set_supersede(record.supersede);
+        call->generate_reader = stub->PrepareAsyncGenerateSkyBox(&call->context, request, queue);
+        call->generate_reader->StartCall();
+        call->generate_reader->Finish(&call->generate_reply, &call->status, call);
+    }
+    else if (record.type == RecordType::Query)
+    {
+        skybox::QueryJobRequest request;
+        request.set_job_id(replay_job_id);
+        call->query_reader = stub->PrepareAsyncQueryJob(&call->context, request, queue);
+        call->query_reader->StartCall();
+        call->query_reader->Finish(&call->query_reply, &call->status, call);
+    }
+    else if (record.type == RecordType::Region)
+    {
+        skybox::GenerateRegionRequest request;
+        request.set_scene_id(record.scene_id);
+        request.mutable_min()->set_x(record.min[0]);
+        request.mutable_min()->set_y(record.min[1]);
+        request.mutable_min()->set_z(record.min[2]);
+        request.mutable_max()->set_x(record.max[0]);
+        request.mutable_max()->set_y(record.max[1]);
+        request.mutable_max()->set_z(record.max[2]);
+        request.set_spacing(record.spacing);
+        for (size_t i = 0; i + 2 < record.positions.size(); i += 3)
+        {
+            skybox::Point* point = request.add_positions();
+            point->set_x(record.positions[i]);
+            point->set_y(record.positions[i + 1]);
+            point->set_z(record.positions[i + 2]);
+        }
+        request.set_resolution(record.resolution);
+        request.set_format((skybox::ImageFormat)record.format);
+        request.set_quality((skybox::QualityPreset)record.quality);
+        request.set_ibl((skybox::IblMode)record.ibl);
+        call->region_reader = stub->PrepareAsyncGenerateRegion(&call->context, request, queue);
+        call->region_reader->StartCall();
+        call->region_reader->Finish(&call->region_reply, &call->status, call);
+    }
+    else if (record.type == RecordType::Cancel)
+    {
+        skybox::CancelJobRequest request;
+        request.set_job_id(replay_job_id);
+        call->cancel_reader = stub->PrepareAsyncCancelJob(&call->context, request, queue);
+        call->cancel_reader->StartCall();
+        call->cancel_reader->Finish(&call->cancel_reply, &call->status, call);
+    }
+    else
+    {
+        skybox::SetClientWeightRequest request;
+        request.set_client(record.target);
+        request.set_weight(record.weight);
+        call->weight_reader = stub->PrepareAsyncSetClientWeight(&call->context, request, queue);
+        call->weight_reader->StartCall();
+        call->weight_reader->Finish(&call->weight_reply, &call->status, call);
+    }
+}
+
+void Replayer::Poll(int index)
+{
+    ThreadStats& stats = m_stats[index];
+    void* tag = NULL;
+    bool ok = false;
+    while (m_queues[index]->Next(&tag, &ok))
+    {
+        Call* call = static_cast<Call*>(tag);
+        Clock::time_point now = Clock::now();
+        uint64_t micros = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(now - call->scheduled).count();
+        bool success = ok && call->status.ok();
+        if (!success)
+        {
+            ++stats.codes[ok ? (int)call->status.error_code() : (int)grpc::StatusCode::UNKNOWN];
+            ++stats.errors[call->type];
+        }
+        else
+        {
+            stats.latency[call->type].Record(micros);
+        }
+        if (call->type == RecordType::Generate || call->type == RecordType::Region)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_jobs_lock);
+                if (call->recorded_job_id != 0)
+                    --m_producers_left[call->recorded_job_id];
+                if (success)
+                {
+                    int job_id = call->type == RecordType::Generate ? call->generate_reply.job_id() : call->region_reply.job_id();
+                    if (call->recorded_job_id != 0)
+                        m_job_map[call->recorded_job_id] = job_id;
+                    m_job_requested.insert(std::make_pair(job_id, call->scheduled));  //已有的不覆盖，从第一次请求算起
+                }
+            }
+            if (call->recorded_job_id != 0)
+                ReleasePending(call->recorded_job_id);
+        }
+        else if (success && call->type == RecordType::Query && call->query_reply.job_status() == skybox::JobStatus::Succeeded)
+        {
+            std::lock_guard<std::mutex> lock(m_jobs_lock);
+            std::map<int, Clock::time_point>::iterator itr = m_job_requested.find(call->query_reply.job_id());
+            if (itr != m_job_requested.end())
+            {
+                m_completion.Record((uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(now - itr->second).count());
+                m_job_requested.erase(itr);
+            }
+        }
+        delete call;
+        --m_outstanding;
+    }
+}
+
+ServerStats Replayer::FetchStats()
+{
+    ServerStats stats;
+    grpc::ClientContext context;
+    context.set_deadline(std::chrono::system_clock::now() + std::chrono::milliseconds(m_config.deadline_ms));
+    skybox::GetStatsRequest request;
+    skybox::GetStatsReply reply;
+    grpc::Status status = m_stubs[0]->GetStats(&context, request, &reply);
+    if (!status.ok())
+        return stats;
+    stats.ok = true;
+    for (const skybox::MetricValue& value : reply.counters())
+        stats.counters[value.name()] = value.value();
+    for (const skybox::MetricValue& value : reply.gauges())
+        stats.gauges[value.name()] = value.value();
+    for (const skybox::HistogramSummary& summary : reply.histograms())
+        stats.histograms[summary.name()] = summary;
+    return stats;
+}
+
+void Replayer::WaitForDrain()
+{
+    //请求都发完了，服务端队列里可能还有很多任务，做完了才好算吞吐
+    Clock::time_point deadline = Clock::now() + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(m_config.drain_timeout));
+    while (Clock::now() < deadline)
+    {
+        ServerStats stats = FetchStats();
+        if (!stats.ok || stats.Gauge("skybox_queue_depth") + stats.Gauge("skybox_jobs_working") <= 0.0)
+            return;
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    }
+    fprintf(stderr, "server queue did not drain in %.0fs\n", m_config.drain_timeout);
+}
+
+void Replayer::Report(const ServerStats& before, const ServerStats& after, double send_seconds, double total_seconds)
+{
+    ThreadStats total;
+    for (const ThreadStats& stats : m_stats)
+    {
+        for (int type = 0; type < RecordTypeCount; ++type)
+        {
+            total.latency[type].Merge(stats.latency[type]);
+            total.errors[type] += stats.errors[type];
+        }
+        for (const std::pair<const int, uint64_t>& code : stats.codes)
+            total.codes[code.first] += code.second;
+    }
+    double recorded_seconds = m_records.empty() ? 0.0 : m_records.back().micros / 1000000.0;
+    printf("trace=%s records=%llu clients=%llu recorded=%.1fs speed=%.2f target=%s\n", m_config.trace.c_str(),
+        (unsigned long long)m_records.size(), (unsigned long long)m_clients.size(), recorded_seconds, m_config.speed, m_config.target.c_str());
+    printf("sent in %.1fs, drained in %.1fs\n", send_seconds, total_seconds);
+    printf("%-16s %10s %10s %8s %9s %9s %9s %9s %9s\n", "rpc", "sent", "ok", "errors", "mean_ms", "p50_ms", "p90_ms", "p99_ms", "max_ms");
+    const char* names[RecordTypeCount] = { NULL, NULL, "GenerateSkyBox", "QueryJob", "GenerateRegion", "CancelJob", "SetClientWeight" };
+    for (int type = RecordType::Generate; type < RecordTypeCount; ++type)
+    {
+        const LatencyHistogram& h = total.latency[type];
+        if (m_sent[type] == 0 && type > RecordType::Query)
+            continue;
+        printf("%-16s %10llu %10llu %8llu %9.2f %9.2f %9.2f %9.2f %9.2f\n", names[type], (unsigned long long)m_sent[type], (unsigned long long)h.Count(), (unsigned long long)total.errors[type],
+            h.MeanMillis(), h.PercentileMillis(0.50), h.PercentileMillis(0.90), h.PercentileMillis(0.99), h.MaxMillis());
+    }
+    printf("%-16s %10s %10llu %8s %9.2f %9.2f %9.2f %9.2f %9.2f\n", "completion", "", (unsigned long long)m_completion.Count(), "",
+        m_completion.MeanMillis(), m_completion.PercentileMillis(0.50), m_completion.PercentileMillis(0.90), m_completion.PercentileMillis(0.99), m_completion.MaxMillis());
+    if (m_skipped[RecordType::Query] + m_skipped[RecordType::Cancel] > 0)
+        printf("skipped %llu queries and %llu cancels for jobs created before the trace started\n",
+            (unsigned long long)m_skipped[RecordType::Query], (unsigned long long)m_skipped[RecordType::Cancel]);
+    if (m_delayed[RecordType::Query] + m_delayed[RecordType::Cancel] > 0)
+        printf("delayed %llu queries and %llu cancels until their generate reply arrived\n",
+            (unsigned long long)m_delayed[RecordType::Query], (unsigned long long)m_delayed[RecordType::Cancel]);
+    if (m_unmapped[RecordType::Query] + m_unmapped[RecordType::Cancel] > 0)
+        printf("sent %llu queries and %llu cancels with job_id 0 because their generate request failed during replay\n",
+            (unsigned long long)m_unmapped[RecordType::Query], (unsigned long long)m_unmapped[RecordType::Cancel]);
+    uint64_t dropped = 0;
+    for (const std::pair<const int, std::vector<int>>& pending : m_pending)
+        dropped += pending.second.size();
+    if (dropped > 0)
+        printf("WARNING: %llu queries and cancels were still waiting for a generate reply at shutdown\n", (unsigned long long)dropped);
+    uint64_t rejected = total.codes.count((int)grpc::StatusCode::RESOURCE_EXHAUSTED) ? total.codes[(int)grpc::StatusCode::RESOURCE_EXHAUSTED] : 0;
+    printf("rejected: recorded %llu, replayed %llu\n", (unsigned long long)m_recorded_rejected, (unsigned long long)rejected);
+    for (const std::pair<const int, uint64_t>& code : total.codes)
+        printf("status %d: %llu\n", code.first, (unsigned long long)code.second);
+    if (before.ok && after.ok)
+    {
+        //命中和新建都是按位置算的（区域任务的每个点各算一次），分母用它们的和，不用按请求算的generate_requests
+        double hits = after.Counter("skybox_completed_cache_hits_total") - before.Counter("skybox_completed_cache_hits_total")
+            + after.Counter("skybox_queued_hits_total") - before.Counter("skybox_queued_hits_total");
+        double lookups = hits + after.Counter("skybox_jobs_created_total") - before.Counter("skybox_jobs_created_total");
+        double succeeded = after.Counter("skybox_jobs_succeeded_total") - before.Counter("skybox_jobs_succeeded_total");
+        double failed = after.Counter("skybox_jobs_failed_total") - before.Counter("skybox_jobs_failed_total");
+        double cancelled = after.Counter("skybox_jobs_cancelled_total") - before.Counter("skybox_jobs_cancelled_total");
+        printf("server: cache hit rate %.1f%% (%.0f / %.0f positions), jobs succeeded %.0f failed %.0f cancelled %.0f, throughput %.2f jobs/s\n",
+            lookups > 0.0 ? hits * 100.0 / lookups : 0.0, hits, lookups, succeeded, failed, cancelled, total_seconds > 0.0 ? succeeded / total_seconds : 0.0);
+        std::map<std::string, skybox::HistogramSummary>::const_iterator wait_before = before.histograms.find("skybox_queue_wait_seconds");
+        std::map<std::string, skybox::HistogramSummary>::const_iterator wait_after = after.histograms.find("skybox_queue_wait_seconds");
+        if (wait_after != after.histograms.end())
+        {
+            //均值按差值算；分位数是服务端启动以来累计的
+            double count = wait_after->second.count() - (wait_before != before.histograms.end() ? wait_before->second.count() : 0.0);
+            double sum = wait_after->second.sum() - (wait_before != before.histograms.end() ? wait_before->second.sum() : 0.0);
+            printf("server queue wait: mean %.2fms over %.0f jobs, since start p50 %.2fms p90 %.2fms p99 %.2fms max %.2fms\n",
+                count > 0.0 ? sum * 1000.0 / count : 0.0, count, wait_after->second.p50() * 1000.0, wait_after->second.p90() * 1000.0,
+                wait_after->second.p99() * 1000.0, wait_after->second.max() * 1000.0);
+        }
+    }
+    if (m_late > 0)
+        printf("WARNING: scheduler fell behind %llu times (max lag %.2fms), lower --speed\n", (unsigned long long)m_late, m_max_lag_us / 1000.0);
+}
+
+
+static void Usage()
+{
+    printf("SkyBoxReplay --trace=FILE [--target=host:port] [--speed=F] [--channels=N] [--threads=N] [--deadline_ms=N] [--drain_timeout=S]\n");
+}
+
+int main(int argc, char** argv)
+{
+    ReplayConfig config;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        size_t eq = arg.find('=');
+        std::string key = arg.substr(0, eq);
+        const char* value = eq != std::string::npos ? argv[i] + eq + 1 : "";
+        if (key == "--trace")
+            config.trace = value;
+        else if (key == "--target")
+            config.target = value;
+        else if (key == "--speed")
+            config.speed = atof(value);
+        else if (key == "--channels")
+            config.channels = atoi(value);
+        else if (key == "--threads")
+            config.threads = atoi(value);
+        else if (key == "--deadline_ms")
+            config.deadline_ms = atoi(value);
+        else if (key == "--drain_timeout")
+            config.drain_timeout = atof(value);
+        else
+        {
+            Usage();
+            return key == "--help" ? 0 : 1;
+        }
+    }
+    if (config.trace.empty() || config.speed <= 0.0 || config.channels <= 0 || config.threads <= 0)
+    {
+        Usage();
+        return 1;
+    }
+    std::vector<std::string> clients;
+    std::vector<TraceRecord> records;
+    if (!LoadTrace(config.trace, clients, records))
+        return 1;
+    Replayer replayer(config, clients, records);
+    return replayer.Run();
+}
@@ -0,0 +1,11 @@
+#!/bin/sh
+# 在装了grpc_sdk的Linux机器上编译压测和重放工具，用和游戏模块同一份生成的stub
+GRPC_SDK=${GRPC_SDK:-/opt/grpc_sdk/linux_ue423}
+DIR=$(dirname "$0")
+PROTOS=$DIR/../../Source/SkyBox/protos
+export PKG_CONFIG_PATH=$GRPC_SDK/lib/pkgconfig
+for TOOL in SkyBoxLoadGen SkyBoxReplay; do
+    c++ -std=c++14 -O2 -o $TOOL -I"$PROTOS" -I"$DIR" \
+        "$DIR/$TOOL.cpp" "$PROTOS/skybox.pb.cc" "$PROTOS/skybox.grpc.pb.cc" \
+        $(pkg-config --cflags --libs --static grpc++ protobuf) -pthread || exit 1
+done
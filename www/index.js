@@ -8,5 +8,9 @@ handle["/"] = requestHandlers.onSayHello;
 handle["/SayHello"] = requestHandlers.onSayHello;
 handle["/GenerateSkyBox"] = requestHandlers.onGenerateSkyBox;
 handle["/QueryJob"] = requestHandlers.onQueryJob;
+handle["/GenerateRegion"] = requestHandlers.onGenerateRegion;
+handle["/CancelJob"] = requestHandlers.onCancelJob;
+handle["/GetStats"] = requestHandlers.onGetStats;
+handle["/metrics"] = requestHandlers.onMetrics;
 
 server.start(router.route, handle);
\ No newline at end of file
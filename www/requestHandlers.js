@@ -88,6 +88,24 @@ function onGenerateSkyBox(query, response)
     rpcRequest.position.x = queryObj.x;
     rpcRequest.position.y = queryObj.y;
     rpcRequest.position.z = queryObj.z;
+    if ("resolution" in queryObj) {
+        rpcRequest.resolution = queryObj.resolution;
+    }
+    if ("format" in queryObj) {
+        rpcRequest.format = queryObj.format;
+    }
+    if ("quality" in queryObj) {
+        rpcRequest.quality = queryObj.quality;
+    }
+    if ("scene_id" in queryObj) {
+        rpcRequest.scene_id = queryObj.scene_id;
+    }
+    if ("ibl" in queryObj) {
+        rpcRequest.ibl = queryObj.ibl;
+    }
+    if ("supersede" in queryObj) {
+        rpcRequest.supersede = queryObj.supersede == "1" || queryObj.supersede == "true";
+    }
     rpcClient.generateSkyBox(rpcRequest, onRpcReply);
 }
 
@@ -121,6 +139,136 @@ function onQueryJob(query, response)
     rpcClient.queryJob(rpcRequest, onRpcReply);
 }
 
+function onGenerateRegion(query, response)
+{
+    var queryObj = querystring.parse(query);
+
+    //positions=x,y,z;x,y,z;... 或者 min_x/min_y/min_z/max_x/max_y/max_z/spacing
+    var err = null;
+    if (!("positions" in queryObj)) {
+        var names = ["min_x", "min_y", "min_z", "max_x", "max_y", "max_z", "spacing"];
+        for (var i = 0; i < names.length; ++i) {
+            if (!(names[i] in queryObj)) {
+                err = names[i] + " is missing";
+                break;
+            }
+        }
+    }
+    if (err != null) {
+        var obj = { error: err };
+        var responseText = JSON.stringify(obj);
+        respondHttpRequest(response, responseText);
+        return;
+    }
+
+    function onRpcReply(rpcError, rpcReply) {
+        var responseText = "error";
+        if (rpcError) {
+            responseText = rpcError;
+        } else {
+            responseText = JSON.stringify(rpcReply);
+        }
+        respondHttpRequest(response, responseText);
+    }
+
+    var rpcRequest = {}
+    if ("positions" in queryObj) {
+        rpcRequest.positions = queryObj.positions.split(";").map(function (text) {
+            var xyz = text.split(",");
+            return { x: xyz[0], y: xyz[1], z: xyz[2] };
+        });
+    } else {
+        rpcRequest.min = { x: queryObj.min_x, y: queryObj.min_y, z: queryObj.min_z };
+        rpcRequest.max = { x: queryObj.max_x, y: queryObj.max_y, z: queryObj.max_z };
+        rpcRequest.spacing = queryObj.spacing;
+    }
+    if ("resolution" in queryObj) {
+        rpcRequest.resolution = queryObj.resolution;
+    }
+    if ("format" in queryObj) {
+        rpcRequest.format = queryObj.format;
+    }
+    if ("quality" in queryObj) {
+        rpcRequest.quality = queryObj.quality;
+    }
+    if ("scene_id" in queryObj) {
+        rpcRequest.scene_id = queryObj.scene_id;
+    }
+    if ("ibl" in queryObj) {
+        rpcRequest.ibl = queryObj.ibl;
+    }
+    rpcClient.generateRegion(rpcRequest, onRpcReply);
+}
+
+function onCancelJob(query, response)
+{
+    var queryObj = querystring.parse(query);
+
+    var err = null;
+    if (!("job_id" in queryObj)) {
+        err = "job_id is missing";
+    }
+    if (err != null) {
+        var obj = { error: err };
+        var responseText = JSON.stringify(obj);
+        respondHttpRequest(response, responseText);
+        return;
+    }
+
+    function onRpcReply(rpcError, rpcReply) {
+        var responseText = "error";
+        if (rpcError) {
+            responseText = rpcError;
+        } else {
+            responseText = JSON.stringify(rpcReply);
+        }
+        respondHttpRequest(response, responseText);
+    }
+
+    var rpcRequest = {}
+    rpcRequest.job_id = queryObj.job_id;
+    rpcClient.cancelJob(rpcRequest, onRpcReply);
+}
+
+function onGetStats(query, response)
+{
+    function onRpcReply(rpcError, rpcReply) {
+        var responseText = "error";
+        if (rpcError) {
+            responseText = rpcError;
+        } else {
+            responseText = JSON.stringify(rpcReply);
+        }
+        respondHttpRequest(response, responseText);
+    }
+
+    var rpcRequest = {}
+    rpcRequest.prometheus_text = false;
+    rpcClient.getStats(rpcRequest, onRpcReply);
+}
+
+// Prometheus拉取用，直接返回文本格式
+function onMetrics(query, response)
+{
+    function onRpcReply(rpcError, rpcReply) {
+        if (rpcError) {
+            response.writeHead(503, { "Content-Type": "text/plain" });
+            response.write(String(rpcError));
+            response.end();
+            return;
+        }
+        respondHttpRequest(response, rpcReply.prometheus_text);
+    }
+
+    var rpcRequest = {}
+    rpcRequest.prometheus_text = true;
+    rpcClient.getStats(rpcRequest, onRpcReply);
+}
+
 exports.onSayHello = onSayHello;
 exports.onGenerateSkyBox = onGenerateSkyBox;
-exports.onQueryJob = onQueryJob;
\ No newline at end of file
+exports.onQueryJob = onQueryJob;
+exports.onGenerateRegion = onGenerateRegion;
+exports.onCancelJob = onCancelJob;
+exports.onGetStats = onGetStats;
+exports.onMetrics = onMetrics;
\ No newline at end of file